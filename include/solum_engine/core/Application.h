@@ -79,6 +79,7 @@ private:
     WebGPURenderer gpu;
     VoxelStreamingSystem voxelStreaming_;
     BufferManager *buf;
+    BufferHandle uniformBuffer_;
 
     FirstPersonCamera camera;
     std::mutex cameraMutex;
@@ -4,13 +4,14 @@
 #include <cstddef>
 #include <cstdint>
 #include <string>
-#include <unordered_map>
 #include <webgpu/webgpu.hpp>
 #include <vector>
 
+#include "solum_engine/render/ResourceHandle.h"
+
 class BufferManager {
 private:
-    std::unordered_map<std::string, wgpu::Buffer> buffers;
+    ResourceRegistry<wgpu::Buffer> buffers;
 
     wgpu::Device device;
     wgpu::Queue queue;
@@ -18,10 +19,13 @@ private:
 public:
     BufferManager(wgpu::Device d, wgpu::Queue q) : device(d), queue(q) {}
 
-    // Existing methods
+    // Recreating a name destroys the old buffer and issues a new handle; handles to it go stale.
     wgpu::Buffer createBuffer(const std::string& bufferName, const wgpu::BufferDescriptor& config);
     wgpu::Buffer getBuffer(const std::string& bufferName) const;
+    wgpu::Buffer getBuffer(BufferHandle handle) const;
+    BufferHandle getBufferHandle(const std::string& bufferName) const;
     void writeBuffer(const std::string& bufferName, uint64_t bufferOffset, const void* data, size_t size);
+    void writeBuffer(BufferHandle handle, uint64_t bufferOffset, const void* data, size_t size);
 
     void deleteBuffer(const std::string& bufferName);
     void terminate();
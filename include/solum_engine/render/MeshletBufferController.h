@@ -13,6 +13,9 @@
 
 class MeshletBufferController {
 public:
+    // Static index pattern shared by every draw chunk instance.
+    static constexpr const char* kQuadIndexBufferName = "meshlet_quad_index_buffer";
+
     struct ProcessResult {
         bool buffersRecreated = false;
         bool uploadApplied = false;
@@ -26,15 +29,20 @@ public:
     bool hasMeshletManager() const noexcept;
     const char* activeMeshDataBufferName() const noexcept;
     const char* activeMeshMetadataBufferName() const noexcept;
-    const char* activeMeshAabbBufferName() const noexcept;
     const char* activeVisibleMeshletIndexBufferName() const noexcept;
+    const char* activePrepassDrawChunkBufferName() const noexcept;
+    const char* activeMeshGroupBufferName() const noexcept;
+    const char* activeCandidateMeshletBufferName() const noexcept;
 
     uint32_t meshletCount() const noexcept;
-    uint32_t verticesPerMeshlet() const noexcept;
+    uint32_t drawChunkCount() const noexcept;
+    uint32_t meshletGroupCount() const noexcept;
     uint32_t effectiveMeshletCountForPasses() const noexcept;
 
     uint64_t uploadedMeshRevision() const noexcept;
     const std::vector<MeshletAabb>& activeMeshletBounds() const noexcept;
+    // Origin base of the active descriptors; shaders read it from FrameUniforms::meshletOriginBase.
+    const glm::ivec3& activeMeshletOriginBase() const noexcept;
 
     bool isUploadInProgress() const noexcept;
     bool hasPendingOrActiveUpload() const noexcept;
@@ -47,12 +55,11 @@ private:
         uint32_t targetBufferIndex = 0;
         size_t metadataUploadedBytes = 0;
         size_t quadUploadedBytes = 0;
-        size_t aabbUploadedBytes = 0;
+        size_t groupUploadedBytes = 0;
     };
 
     static uint32_t computeRequiredMeshletCapacity(const StreamingMeshUpload& upload) noexcept;
-    static uint32_t computeRequiredQuadCapacity(const StreamingMeshUpload& upload,
-                                                uint32_t requiredMeshletCapacity) noexcept;
+    static uint32_t computeRequiredQuadCapacity(const StreamingMeshUpload& upload) noexcept;
     bool ensureCapacity(const StreamingMeshUpload& upload, bool* buffersRecreated = nullptr);
     bool streamChunkedUploadBytes(ChunkedMeshUploadState& uploadState, size_t budgetBytes);
 
@@ -62,6 +69,7 @@ private:
     uint32_t quadCapacity_ = 0;
     uint64_t uploadedMeshRevision_ = 0;
     std::vector<MeshletAabb> activeMeshletBounds_;
+    glm::ivec3 activeMeshletOriginBase_{0, 0, 0};
 
     std::optional<StreamingMeshUpload> pendingMeshUpload_;
     std::optional<ChunkedMeshUploadState> chunkedMeshUpload_;
@@ -3,6 +3,7 @@
 #include "solum_engine/render/BufferManager.h"
 #include "solum_engine/render/MeshletTypes.h"
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <string>
@@ -13,57 +14,82 @@ public:
     static constexpr uint32_t kBufferSetCount = 2;
     static constexpr const char* kMeshDataBufferName0 = "meshlet_data_buffer_0";
     static constexpr const char* kMeshDataBufferName1 = "meshlet_data_buffer_1";
+    // One MeshletDescriptorGPU per meshlet; also carries the bounds the cull shaders test.
     static constexpr const char* kMeshMetadataBufferName0 = "meshlet_metadata_buffer_0";
     static constexpr const char* kMeshMetadataBufferName1 = "meshlet_metadata_buffer_1";
-    static constexpr const char* kMeshAabbBufferName0 = "meshlet_aabb_buffer_0";
-    static constexpr const char* kMeshAabbBufferName1 = "meshlet_aabb_buffer_1";
+    // Packed draw chunks (see packMeshletDrawChunk) of the meshlets that survived culling.
     static constexpr const char* kVisibleMeshletIndexBufferName0 = "visible_meshlet_indices_buffer_0";
     static constexpr const char* kVisibleMeshletIndexBufferName1 = "visible_meshlet_indices_buffer_1";
+    // Packed draw chunks of last frame's visible meshlets, rasterized into the occlusion depth prepass.
+    static constexpr const char* kPrepassDrawChunkBufferName0 = "meshlet_prepass_draw_chunk_buffer_0";
+    static constexpr const char* kPrepassDrawChunkBufferName1 = "meshlet_prepass_draw_chunk_buffer_1";
+    static constexpr const char* kMeshGroupBufferName0 = "meshlet_group_buffer_0";
+    static constexpr const char* kMeshGroupBufferName1 = "meshlet_group_buffer_1";
+    // Dispatch header followed by the meshlets of the groups that survived the tile-level cull.
+    static constexpr const char* kCandidateMeshletBufferName0 = "meshlet_candidate_buffer_0";
+    static constexpr const char* kCandidateMeshletBufferName1 = "meshlet_candidate_buffer_1";
 
     static const char* meshDataBufferName(uint32_t bufferIndex) noexcept;
     static const char* meshMetadataBufferName(uint32_t bufferIndex) noexcept;
-    static const char* meshAabbBufferName(uint32_t bufferIndex) noexcept;
     static const char* visibleMeshletIndexBufferName(uint32_t bufferIndex) noexcept;
+    static const char* prepassDrawChunkBufferName(uint32_t bufferIndex) noexcept;
+    static const char* meshGroupBufferName(uint32_t bufferIndex) noexcept;
+    static const char* candidateMeshletBufferName(uint32_t bufferIndex) noexcept;
 
     bool initialize(BufferManager* bufferManager, uint32_t maxMeshlets, uint32_t maxQuads);
 
     void clear();
 
-    void adoptPreparedData(std::vector<MeshletMetadataGPU>&& metadata,
+    void adoptPreparedData(std::vector<MeshletDescriptorGPU>&& metadata,
                            std::vector<uint32_t>&& quadData,
-                           std::vector<MeshletAabbGPU>&& aabbs);
+                           std::vector<MeshletGroupGPU>&& groups);
 
     bool upload();
     bool writeMetadataChunk(uint32_t bufferIndex, uint64_t byteOffset, const void* data, size_t sizeBytes);
     bool writeQuadChunk(uint32_t bufferIndex, uint64_t byteOffset, const void* data, size_t sizeBytes);
-    bool writeAabbChunk(uint32_t bufferIndex, uint64_t byteOffset, const void* data, size_t sizeBytes);
-    void activateBuffer(uint32_t bufferIndex, uint32_t meshletCount, uint32_t quadWordCount);
+    bool writeGroupChunk(uint32_t bufferIndex, uint64_t byteOffset, const void* data, size_t sizeBytes);
+    void activateBuffer(uint32_t bufferIndex,
+                        const std::vector<MeshletDescriptorGPU>& metadata,
+                        uint32_t quadWordCount,
+                        uint32_t groupCount);
 
     uint32_t getActiveBufferIndex() const noexcept;
     uint32_t getInactiveBufferIndex() const noexcept;
     const char* getActiveMeshDataBufferName() const noexcept;
     const char* getActiveMeshMetadataBufferName() const noexcept;
-    const char* getActiveMeshAabbBufferName() const noexcept;
     const char* getActiveVisibleMeshletIndexBufferName() const noexcept;
-
-    bool updateVisibleMeshletIndices(const uint32_t* indices, uint32_t visibleCount);
+    const char* getActivePrepassDrawChunkBufferName() const noexcept;
+    const char* getActiveMeshGroupBufferName() const noexcept;
+    const char* getActiveCandidateMeshletBufferName() const noexcept;
 
     uint32_t getMeshletCount() const;
-    uint32_t getVisibleMeshletCount() const;
     uint32_t getQuadCount() const;
-    uint32_t getVerticesPerMeshlet() const;
+    // Instances needed to draw every chunk of the active set.
+    uint32_t getDrawChunkCount() const;
+    uint32_t getGroupCount() const;
 
 private:
+    // Buffers the upload path writes, resolved once when they are created.
+    struct BufferSet {
+        BufferHandle metadata;
+        BufferHandle meshData;
+        BufferHandle visibleIndices;
+        BufferHandle groups;
+    };
+
     BufferManager* bufferManager = nullptr;
+    std::array<BufferSet, kBufferSetCount> bufferSets_{};
     uint32_t meshletCapacity = 0;
     uint32_t quadCapacity = 0;
+    uint32_t drawChunkCapacity = 0;
     uint32_t activeBufferIndex_ = 0;
     uint32_t activeMeshletCount_ = 0;
-    uint32_t activeVisibleMeshletCount_ = 0;
     uint32_t activeQuadWordCount_ = 0;
+    uint32_t activeQuadCount_ = 0;
+    uint32_t activeDrawChunkCount_ = 0;
+    uint32_t activeGroupCount_ = 0;
 
-    std::vector<MeshletMetadataGPU> metadataCpu;
+    std::vector<MeshletDescriptorGPU> metadataCpu;
     std::vector<uint32_t> quadDataCpu;
-    std::vector<MeshletAabbGPU> aabbCpu;
-    std::vector<uint32_t> sequentialVisibleIndicesCpu;
+    std::vector<MeshletGroupGPU> groupCpu;
 };
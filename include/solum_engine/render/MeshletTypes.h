@@ -1,12 +1,33 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cstdint>
+#include <vector>
 #include <glm/glm.hpp>
 
 static constexpr uint32_t MESHLET_QUAD_CAPACITY = 128;
 static constexpr uint32_t MESHLET_VERTEX_CAPACITY = MESHLET_QUAD_CAPACITY * 6;
-static constexpr uint32_t MESHLET_QUAD_DATA_WORD_STRIDE = 2;
+// One word per quad: local offset, AO and flip, and an index into the meshlet's material palette.
+static constexpr uint32_t MESHLET_QUAD_DATA_WORD_STRIDE = 1;
+static constexpr uint32_t MESHLET_QUAD_AO_SHIFT = 15;
+static constexpr uint32_t MESHLET_QUAD_AO_BITS = 9;
+static constexpr uint32_t MESHLET_QUAD_PALETTE_SHIFT = MESHLET_QUAD_AO_SHIFT + MESHLET_QUAD_AO_BITS;
+static constexpr uint32_t MESHLET_QUAD_PALETTE_BITS = 7;
+static_assert(MESHLET_QUAD_CAPACITY <= (1u << MESHLET_QUAD_PALETTE_BITS),
+              "Every quad of a meshlet must be able to own a palette entry");
+// The palette follows the quads as 16-bit material ids, two per word.
+static constexpr uint32_t MESHLET_PALETTE_MATERIALS_PER_WORD = 2;
+static constexpr uint32_t MESHLET_MAX_DATA_WORDS =
+    MESHLET_QUAD_CAPACITY * MESHLET_QUAD_DATA_WORD_STRIDE + MESHLET_QUAD_CAPACITY / MESHLET_PALETTE_MATERIALS_PER_WORD;
+// Meshlets are drawn as runs of fixed-size quad chunks; only the tail of the last chunk is wasted.
+static constexpr uint32_t MESHLET_DRAW_CHUNK_QUADS = 4;
+// Each chunk is one instance of a static indexed grid: 4 shared corners and 6 indices per quad.
+static constexpr uint32_t MESHLET_DRAW_CHUNK_VERTICES = MESHLET_DRAW_CHUNK_QUADS * 4;
+static constexpr uint32_t MESHLET_DRAW_CHUNK_INDICES = MESHLET_DRAW_CHUNK_QUADS * 6;
+static constexpr uint32_t MESHLET_DRAW_CHUNK_INDEX_BITS = 5;
+static_assert((MESHLET_QUAD_CAPACITY / MESHLET_DRAW_CHUNK_QUADS) <= (1u << MESHLET_DRAW_CHUNK_INDEX_BITS),
+              "Draw chunk index must fit its packed bits");
 
 inline uint16_t packMeshletLocalOffset(uint32_t x, uint32_t y, uint32_t z) {
     return static_cast<uint16_t>((x & 0x1Fu) | ((y & 0x1Fu) << 5u) | ((z & 0x1Fu) << 10u));
@@ -20,8 +41,36 @@ inline glm::uvec3 unpackMeshletLocalOffset(uint16_t packedOffset) {
     );
 }
 
-inline uint32_t packMeshletQuadData(uint16_t packedLocalOffset, uint16_t materialId) {
-    return static_cast<uint32_t>(packedLocalOffset) | (static_cast<uint32_t>(materialId) << 16u);
+struct MeshletQuad {
+    uint16_t packedLocalOffset = 0;
+    uint16_t aoData = 0;
+    uint32_t paletteIndex = 0;
+};
+
+// CPU mirror of the decode_* helpers in voxel.wgsl.
+inline uint32_t packMeshletQuad(const MeshletQuad& quad) {
+    return (static_cast<uint32_t>(quad.packedLocalOffset) & ((1u << MESHLET_QUAD_AO_SHIFT) - 1u)) |
+           ((static_cast<uint32_t>(quad.aoData) & ((1u << MESHLET_QUAD_AO_BITS) - 1u)) << MESHLET_QUAD_AO_SHIFT) |
+           ((quad.paletteIndex & ((1u << MESHLET_QUAD_PALETTE_BITS) - 1u)) << MESHLET_QUAD_PALETTE_SHIFT);
+}
+
+inline MeshletQuad unpackMeshletQuad(uint32_t packedQuad) {
+    MeshletQuad quad;
+    quad.packedLocalOffset = static_cast<uint16_t>(packedQuad & ((1u << MESHLET_QUAD_AO_SHIFT) - 1u));
+    quad.aoData = static_cast<uint16_t>((packedQuad >> MESHLET_QUAD_AO_SHIFT) & ((1u << MESHLET_QUAD_AO_BITS) - 1u));
+    quad.paletteIndex = (packedQuad >> MESHLET_QUAD_PALETTE_SHIFT) & ((1u << MESHLET_QUAD_PALETTE_BITS) - 1u);
+    return quad;
+}
+
+inline uint32_t meshletPaletteWordCount(uint32_t materialCount) {
+    return (materialCount + MESHLET_PALETTE_MATERIALS_PER_WORD - 1u) / MESHLET_PALETTE_MATERIALS_PER_WORD;
+}
+
+// Material of a palette entry, given the meshlet's words starting at its data offset.
+inline uint16_t meshletPaletteMaterial(const uint32_t* meshletWords, uint32_t quadCount, uint32_t paletteIndex) {
+    const uint32_t word = meshletWords[quadCount * MESHLET_QUAD_DATA_WORD_STRIDE +
+                                       paletteIndex / MESHLET_PALETTE_MATERIALS_PER_WORD];
+    return static_cast<uint16_t>(word >> ((paletteIndex % MESHLET_PALETTE_MATERIALS_PER_WORD) * 16u));
 }
 
 inline uint16_t packMeshletQuadAoData(uint8_t ao00,
@@ -38,6 +87,48 @@ inline uint16_t packMeshletQuadAoData(uint8_t ao00,
     );
 }
 
+inline uint32_t meshletDrawChunkCount(uint32_t quadCount) {
+    return (quadCount + MESHLET_DRAW_CHUNK_QUADS - 1u) / MESHLET_DRAW_CHUNK_QUADS;
+}
+
+inline uint32_t packMeshletDrawChunk(uint32_t meshletIndex, uint32_t chunkInMeshlet) {
+    return (meshletIndex << MESHLET_DRAW_CHUNK_INDEX_BITS) |
+           (chunkInMeshlet & ((1u << MESHLET_DRAW_CHUNK_INDEX_BITS) - 1u));
+}
+
+// Corners are numbered like face_corner_offset in voxel.wgsl; the diagonal runs from corner 1 to 2.
+// Flipped quads remap their corners in the vertex shader instead of using a second index pattern.
+inline std::array<uint16_t, MESHLET_DRAW_CHUNK_INDICES> buildMeshletDrawChunkIndices() {
+    constexpr std::array<uint16_t, 6> kQuadCornerOrder{0, 1, 2, 2, 1, 3};
+    std::array<uint16_t, MESHLET_DRAW_CHUNK_INDICES> indices{};
+    for (uint32_t quad = 0; quad < MESHLET_DRAW_CHUNK_QUADS; ++quad) {
+        for (uint32_t i = 0; i < kQuadCornerOrder.size(); ++i) {
+            indices[quad * 6u + i] = static_cast<uint16_t>(quad * 4u + kQuadCornerOrder[i]);
+        }
+    }
+    return indices;
+}
+
+// Slots in the GPU visibility history used by two-phase occlusion culling. Keys are hashed into it, so
+// collisions only cost efficiency: the second cull phase still tests every meshlet.
+static constexpr uint32_t MESHLET_VISIBILITY_TABLE_BITS = 1u << 22;
+
+// ordinal separates meshlets that share an origin, face and scale within one snapshot. Mirrored by
+// meshlet_visibility_key in meshlet_descriptor.wgsl, which hashes the decoded descriptor.
+inline uint32_t meshletVisibilityKey(const glm::ivec3& origin,
+                                     uint32_t faceDirection,
+                                     uint32_t voxelScale,
+                                     uint32_t ordinal) {
+    uint32_t h = static_cast<uint32_t>(origin.x) * 73856093u;
+    h ^= static_cast<uint32_t>(origin.y) * 19349663u;
+    h ^= static_cast<uint32_t>(origin.z) * 83492791u;
+    h ^= (faceDirection | (voxelScale << 3u) | (ordinal << 12u)) * 2654435761u;
+    h ^= h >> 16u;
+    h *= 0x7feb352du;
+    h ^= h >> 15u;
+    return h;
+}
+
 struct Meshlet {
     glm::ivec3 origin{ 0, 0, 0 };
     uint32_t faceDirection = 0;
@@ -48,26 +139,248 @@ struct Meshlet {
     std::array<uint16_t, MESHLET_QUAD_CAPACITY> quadAoData{};
 };
 
-struct MeshletMetadataGPU {
-    int32_t originX = 0;
-    int32_t originY = 0;
-    int32_t originZ = 0;
-    uint32_t quadCount = 0;
-    uint32_t faceDirection = 0;
-    uint32_t dataOffset = 0;
-    uint32_t voxelScale = 1;
-    uint32_t pad1 = 0;
+// Appends the meshlet's quad words followed by its material palette and returns the words written.
+inline uint32_t appendMeshletQuadData(const Meshlet& meshlet, std::vector<uint32_t>& outWords) {
+    const uint32_t quadCount = std::min(meshlet.quadCount, MESHLET_QUAD_CAPACITY);
+    std::array<uint16_t, MESHLET_QUAD_CAPACITY> palette{};
+    uint32_t paletteSize = 0;
+    const size_t firstWord = outWords.size();
+
+    for (uint32_t i = 0; i < quadCount; ++i) {
+        const uint16_t materialId = meshlet.quadMaterialIds[i];
+        uint32_t paletteIndex = 0;
+        while (paletteIndex < paletteSize && palette[paletteIndex] != materialId) {
+            ++paletteIndex;
+        }
+        if (paletteIndex == paletteSize) {
+            palette[paletteSize++] = materialId;
+        }
+
+        MeshletQuad quad;
+        quad.packedLocalOffset = meshlet.packedQuadLocalOffsets[i];
+        quad.aoData = meshlet.quadAoData[i];
+        quad.paletteIndex = paletteIndex;
+        outWords.push_back(packMeshletQuad(quad));
+    }
+
+    for (uint32_t i = 0; i < paletteSize; i += MESHLET_PALETTE_MATERIALS_PER_WORD) {
+        const uint32_t high = (i + 1u < paletteSize) ? palette[i + 1u] : 0u;
+        outWords.push_back(static_cast<uint32_t>(palette[i]) | (high << 16u));
+    }
+    return static_cast<uint32_t>(outWords.size() - firstWord);
+}
+
+// Contiguous run of snapshot meshlets sharing one tile LOD cell (or one tile's skirts).
+struct MeshletGroupRange {
+    uint32_t firstMeshlet = 0;
+    uint32_t meshletCount = 0;
 };
 
+// Longer runs are split so one group-cull thread never writes more than this many candidates.
+static constexpr uint32_t MESHLET_GROUP_MAX_MESHLETS = 64;
+// Must match the workgroup size of the per-meshlet entry points in meshlet_cull.wgsl.
+static constexpr uint32_t MESHLET_CULL_WORKGROUP_SIZE = 128;
+// The candidate buffer starts with dispatchWorkgroupsIndirect args plus the candidate count.
+static constexpr uint32_t MESHLET_CANDIDATE_HEADER_WORDS = 4;
+
 struct MeshletAabb {
     glm::vec3 minCorner{0.0f};
     glm::vec3 maxCorner{0.0f};
 };
 
-struct MeshletAabbGPU {
+// Descriptor origins are stored relative to the snapshot's origin base, biased into unsigned fields.
+// The base is the snapshot's center column, so these ranges cover every upload radius in use.
+static constexpr uint32_t MESHLET_DESCRIPTOR_ORIGIN_XY_BITS = 14;
+static constexpr uint32_t MESHLET_DESCRIPTOR_ORIGIN_Z_BITS = 10;
+static constexpr uint32_t MESHLET_DESCRIPTOR_SCALE_BITS = 3;
+static constexpr uint32_t MESHLET_DESCRIPTOR_FACE_BITS = 3;
+static constexpr uint32_t MESHLET_DESCRIPTOR_QUAD_COUNT_BITS = 7;
+static constexpr uint32_t MESHLET_DESCRIPTOR_ORDINAL_BITS = 8;
+static constexpr uint32_t MESHLET_DESCRIPTOR_BOUNDS_BITS = 5;
+static_assert(MESHLET_QUAD_CAPACITY <= (1u << MESHLET_DESCRIPTOR_QUAD_COUNT_BITS),
+              "Meshlet quad count must fit its descriptor bits");
+
+// Decoded form of MeshletDescriptorGPU.
+struct MeshletDescriptor {
+    glm::ivec3 origin{0, 0, 0};
+    uint32_t faceDirection = 0;
+    uint32_t quadCount = 0;
+    uint32_t voxelScale = 1;
+    uint32_t dataOffset = 0;
+    // Only the low MESHLET_DESCRIPTOR_ORDINAL_BITS survive encoding; see meshletVisibilityKey.
+    uint32_t ordinal = 0;
+    // Inclusive range of the quads' local offsets, in voxels of voxelScale.
+    glm::uvec3 boundsMin{0u};
+    glm::uvec3 boundsMax{0u};
+};
+
+// 16-byte per-meshlet record read by the cull and draw shaders (see meshlet_descriptor.wgsl):
+//   originXYScale:   origin x, origin y (biased, relative to the origin base), log2 voxel scale
+//   originZFaceQuads: origin z (biased), face direction, quad count - 1, ordinal
+//   dataOffset:      first quad word in the data buffer; the material palette follows the quads
+//   bounds:          boundsMin xyz then boundsMax xyz, 5 bits each
+struct MeshletDescriptorGPU {
+    uint32_t originXYScale = 0;
+    uint32_t originZFaceQuads = 0;
+    uint32_t dataOffset = 0;
+    uint32_t bounds = 0;
+};
+
+inline uint32_t meshletDescriptorQuadCount(const MeshletDescriptorGPU& descriptor) {
+    return ((descriptor.originZFaceQuads >> (MESHLET_DESCRIPTOR_ORIGIN_Z_BITS + MESHLET_DESCRIPTOR_FACE_BITS)) &
+            ((1u << MESHLET_DESCRIPTOR_QUAD_COUNT_BITS) - 1u)) + 1u;
+}
+
+// Returns false when a field does not fit, e.g. an origin too far from originBase.
+inline bool encodeMeshletDescriptor(const MeshletDescriptor& meshlet,
+                                    const glm::ivec3& originBase,
+                                    MeshletDescriptorGPU& outDescriptor) {
+    constexpr int32_t kXYBias = 1 << (MESHLET_DESCRIPTOR_ORIGIN_XY_BITS - 1u);
+    constexpr int32_t kZBias = 1 << (MESHLET_DESCRIPTOR_ORIGIN_Z_BITS - 1u);
+    constexpr uint32_t kBoundsMax = (1u << MESHLET_DESCRIPTOR_BOUNDS_BITS) - 1u;
+
+    const glm::ivec3 relative = meshlet.origin - originBase;
+    const int64_t biasedX = static_cast<int64_t>(relative.x) + kXYBias;
+    const int64_t biasedY = static_cast<int64_t>(relative.y) + kXYBias;
+    const int64_t biasedZ = static_cast<int64_t>(relative.z) + kZBias;
+    if (biasedX < 0 || biasedX >= 2 * kXYBias ||
+        biasedY < 0 || biasedY >= 2 * kXYBias ||
+        biasedZ < 0 || biasedZ >= 2 * kZBias) {
+        return false;
+    }
+    if (meshlet.faceDirection > 5u || meshlet.quadCount == 0u || meshlet.quadCount > MESHLET_QUAD_CAPACITY) {
+        return false;
+    }
+    if (meshlet.voxelScale == 0u || (meshlet.voxelScale & (meshlet.voxelScale - 1u)) != 0u) {
+        return false;
+    }
+    uint32_t scaleLog2 = 0;
+    while ((1u << scaleLog2) < meshlet.voxelScale) {
+        ++scaleLog2;
+    }
+    if (scaleLog2 >= (1u << MESHLET_DESCRIPTOR_SCALE_BITS)) {
+        return false;
+    }
+    for (glm::length_t axis = 0; axis < 3; ++axis) {
+        if (meshlet.boundsMin[axis] > meshlet.boundsMax[axis] || meshlet.boundsMax[axis] > kBoundsMax) {
+            return false;
+        }
+    }
+
+    const uint32_t ordinal = meshlet.ordinal & ((1u << MESHLET_DESCRIPTOR_ORDINAL_BITS) - 1u);
+    outDescriptor.originXYScale =
+        static_cast<uint32_t>(biasedX) |
+        (static_cast<uint32_t>(biasedY) << MESHLET_DESCRIPTOR_ORIGIN_XY_BITS) |
+        (scaleLog2 << (2u * MESHLET_DESCRIPTOR_ORIGIN_XY_BITS));
+    outDescriptor.originZFaceQuads =
+        static_cast<uint32_t>(biasedZ) |
+        (meshlet.faceDirection << MESHLET_DESCRIPTOR_ORIGIN_Z_BITS) |
+        ((meshlet.quadCount - 1u) << (MESHLET_DESCRIPTOR_ORIGIN_Z_BITS + MESHLET_DESCRIPTOR_FACE_BITS)) |
+        (ordinal << (MESHLET_DESCRIPTOR_ORIGIN_Z_BITS + MESHLET_DESCRIPTOR_FACE_BITS +
+                     MESHLET_DESCRIPTOR_QUAD_COUNT_BITS));
+    outDescriptor.dataOffset = meshlet.dataOffset;
+    outDescriptor.bounds = 0u;
+    for (uint32_t axis = 0; axis < 3u; ++axis) {
+        outDescriptor.bounds |= meshlet.boundsMin[static_cast<glm::length_t>(axis)] <<
+                                (axis * MESHLET_DESCRIPTOR_BOUNDS_BITS);
+        outDescriptor.bounds |= meshlet.boundsMax[static_cast<glm::length_t>(axis)] <<
+                                ((axis + 3u) * MESHLET_DESCRIPTOR_BOUNDS_BITS);
+    }
+    return true;
+}
+
+// CPU mirror of decode_meshlet in meshlet_descriptor.wgsl.
+inline MeshletDescriptor decodeMeshletDescriptor(const MeshletDescriptorGPU& descriptor,
+                                                 const glm::ivec3& originBase) {
+    constexpr uint32_t kXYMask = (1u << MESHLET_DESCRIPTOR_ORIGIN_XY_BITS) - 1u;
+    constexpr uint32_t kZMask = (1u << MESHLET_DESCRIPTOR_ORIGIN_Z_BITS) - 1u;
+    constexpr int32_t kXYBias = 1 << (MESHLET_DESCRIPTOR_ORIGIN_XY_BITS - 1u);
+    constexpr int32_t kZBias = 1 << (MESHLET_DESCRIPTOR_ORIGIN_Z_BITS - 1u);
+    constexpr uint32_t kBoundsMask = (1u << MESHLET_DESCRIPTOR_BOUNDS_BITS) - 1u;
+
+    MeshletDescriptor meshlet;
+    meshlet.origin = originBase + glm::ivec3(
+        static_cast<int32_t>(descriptor.originXYScale & kXYMask) - kXYBias,
+        static_cast<int32_t>((descriptor.originXYScale >> MESHLET_DESCRIPTOR_ORIGIN_XY_BITS) & kXYMask) - kXYBias,
+        static_cast<int32_t>(descriptor.originZFaceQuads & kZMask) - kZBias
+    );
+    meshlet.voxelScale = 1u << ((descriptor.originXYScale >> (2u * MESHLET_DESCRIPTOR_ORIGIN_XY_BITS)) &
+                                ((1u << MESHLET_DESCRIPTOR_SCALE_BITS) - 1u));
+    meshlet.faceDirection = (descriptor.originZFaceQuads >> MESHLET_DESCRIPTOR_ORIGIN_Z_BITS) &
+                            ((1u << MESHLET_DESCRIPTOR_FACE_BITS) - 1u);
+    meshlet.quadCount = meshletDescriptorQuadCount(descriptor);
+    meshlet.ordinal = descriptor.originZFaceQuads >>
+                      (MESHLET_DESCRIPTOR_ORIGIN_Z_BITS + MESHLET_DESCRIPTOR_FACE_BITS + MESHLET_DESCRIPTOR_QUAD_COUNT_BITS);
+    meshlet.dataOffset = descriptor.dataOffset;
+    for (uint32_t axis = 0; axis < 3u; ++axis) {
+        meshlet.boundsMin[static_cast<glm::length_t>(axis)] =
+            (descriptor.bounds >> (axis * MESHLET_DESCRIPTOR_BOUNDS_BITS)) & kBoundsMask;
+        meshlet.boundsMax[static_cast<glm::length_t>(axis)] =
+            (descriptor.bounds >> ((axis + 3u) * MESHLET_DESCRIPTOR_BOUNDS_BITS)) & kBoundsMask;
+    }
+    return meshlet;
+}
+
+// Exact world bounds of the quads. Every quad lies on the face plane of its voxel, so along the face
+// axis the box collapses onto the planes instead of spanning whole voxels.
+inline MeshletAabb meshletDescriptorAabb(const MeshletDescriptor& meshlet) {
+    const glm::vec3 origin = glm::vec3(meshlet.origin);
+    const float voxelScale = static_cast<float>(std::max(meshlet.voxelScale, 1u));
+    glm::vec3 minCorner = origin + glm::vec3(meshlet.boundsMin) * voxelScale;
+    glm::vec3 maxCorner = origin + (glm::vec3(meshlet.boundsMax) + glm::vec3(1.0f)) * voxelScale;
+    if (meshlet.faceDirection <= 5u) {
+        const glm::length_t axis = static_cast<glm::length_t>(meshlet.faceDirection / 2u);
+        if ((meshlet.faceDirection % 2u) == 0u) {
+            minCorner[axis] += voxelScale;
+        } else {
+            maxCorner[axis] -= voxelScale;
+        }
+    }
+    return MeshletAabb{minCorner, maxCorner};
+}
+
+// Bounds of a meshlet group plus its range in the compacted metadata array.
+struct MeshletGroupGPU {
     glm::vec4 minCorner{0.0f};
     glm::vec4 maxCorner{0.0f};
+    uint32_t firstMeshlet = 0;
+    uint32_t meshletCount = 0;
+    uint32_t pad0 = 0;
+    uint32_t pad1 = 0;
 };
 
-static_assert(sizeof(MeshletMetadataGPU) == 32, "Meshlet metadata layout must match shader");
-static_assert(sizeof(MeshletAabbGPU) == 32, "Meshlet AABB GPU layout must remain tightly packed");
+// CPU mirror of is_backfacing in meshlet_cull.wgsl. Every quad of a meshlet shares one face direction
+// (0..5 = +X, -X, +Y, -Y, +Z, -Z) and lies on a plane bounded by the AABB along that axis, so the whole
+// meshlet faces away once the camera is behind the nearest of those planes.
+inline bool isMeshletBackfacing(uint32_t faceDirection, const MeshletAabb& aabb, const glm::vec3& cameraPosition) {
+    if (faceDirection > 5u) {
+        return false;
+    }
+    const glm::length_t axis = static_cast<glm::length_t>(faceDirection / 2u);
+    const bool positive = (faceDirection % 2u) == 0u;
+    return positive ? cameraPosition[axis] <= aabb.minCorner[axis]
+                    : cameraPosition[axis] >= aabb.maxCorner[axis];
+}
+
+static_assert(sizeof(MeshletDescriptorGPU) == 16, "Meshlet descriptor layout must match shader");
+static_assert(sizeof(MeshletGroupGPU) == 48, "Meshlet group layout must match shader");
+
+// CPU reference for the draw-chunk compaction done by meshlet_cull.wgsl. Appends one packed entry per
+// chunk of each listed meshlet (all meshlets when meshletIndices is null) and returns the instance count
+// that draws every entry in outChunks.
+inline uint32_t appendMeshletDrawChunks(const std::vector<MeshletDescriptorGPU>& metadata,
+                                        const uint32_t* meshletIndices,
+                                        uint32_t meshletIndexCount,
+                                        std::vector<uint32_t>& outChunks) {
+    for (uint32_t i = 0; i < meshletIndexCount; ++i) {
+        const uint32_t meshletIndex = (meshletIndices != nullptr) ? meshletIndices[i] : i;
+        if (meshletIndex >= metadata.size()) {
+            continue;
+        }
+        const uint32_t chunkCount = meshletDrawChunkCount(meshletDescriptorQuadCount(metadata[meshletIndex]));
+        for (uint32_t chunk = 0; chunk < chunkCount; ++chunk) {
+            outChunks.push_back(packMeshletDrawChunk(meshletIndex, chunk));
+        }
+    }
+    return static_cast<uint32_t>(outChunks.size());
+}
@@ -10,6 +10,7 @@
 #include <cstddef>
 #include <cstdint>
 
+#include "solum_engine/render/ResourceHandle.h"
 #include "solum_engine/render/VertexAttributes.h"
 
 struct PipelineConfig {
@@ -43,10 +44,28 @@ struct ComputePipelineConfig {
 };
 
 class PipelineManager {
-    std::unordered_map<std::string, wgpu::RenderPipeline> pipelines;
-    std::unordered_map<std::string, wgpu::ComputePipeline> computePipelines;
+    // The registry owns the group under slotName, so its handle survives swaps to other groups.
+    struct CachedBindGroup {
+        std::vector<uint64_t> key;
+        std::string slotName;
+        BindGroupHandle handle;
+    };
+
+    // Enough for both meshlet buffer sets plus a resize in flight.
+    static constexpr std::size_t kMaxCachedBindGroupsPerName = 4;
+
+    ResourceRegistry<wgpu::RenderPipeline> pipelines;
+    ResourceRegistry<wgpu::ComputePipeline> computePipelines;
+    // Layouts are only touched while building pipelines and bind groups.
     std::unordered_map<std::string, wgpu::BindGroupLayout> bindGroupLayouts;
-    std::unordered_map<std::string, wgpu::BindGroup> bindGroups;
+    std::unordered_map<std::string, uint64_t> bindGroupLayoutGenerations;
+    ResourceRegistry<wgpu::BindGroup> bindGroups;
+    // Groups built by getOrCreateBindGroup, keyed by layout and resource generations.
+    std::unordered_map<std::string, std::vector<CachedBindGroup>> bindGroupCache;
+    // Handle of the cached group currently made current under each name.
+    std::unordered_map<std::string, BindGroupHandle> currentCachedBindGroups;
+    uint64_t nextCachedBindGroupSerial = 1;
+    uint64_t nextLayoutGeneration = 1;
     wgpu::Device device;
     wgpu::TextureFormat surfaceFormat;
 
@@ -61,14 +80,31 @@ public:
     wgpu::BindGroup createBindGroup(const std::string& bindGroupName,
                                     const std::string& bindGroupLayoutName,
                                     const std::vector<wgpu::BindGroupEntry>& bindings);
+    // Makes the group for these resources current under bindGroupName, reusing a cached one when
+    // the layout and every binding's resource key, offset and size match. Keys are the bound
+    // resources' handle keys and run parallel to bindings. A cached group keeps one handle while
+    // it stays cached, so swapping back to it hands out the handle it had before.
+    wgpu::BindGroup getOrCreateBindGroup(const std::string& bindGroupName,
+                                         const std::string& bindGroupLayoutName,
+                                         const std::vector<wgpu::BindGroupEntry>& bindings,
+                                         const std::vector<uint64_t>& resourceKeys);
     wgpu::RenderPipeline getPipeline(const std::string& pipelineName) const;
+    wgpu::RenderPipeline getPipeline(PipelineHandle handle) const;
+    PipelineHandle getPipelineHandle(const std::string& pipelineName) const;
     wgpu::ComputePipeline getComputePipeline(const std::string& pipelineName) const;
+    wgpu::ComputePipeline getComputePipeline(ComputePipelineHandle handle) const;
+    ComputePipelineHandle getComputePipelineHandle(const std::string& pipelineName) const;
     wgpu::BindGroupLayout getBindGroupLayout(const std::string& bindGroupLayoutName) const;
     wgpu::BindGroup getBindGroup(const std::string& bindGroupName) const;
+    wgpu::BindGroup getBindGroup(BindGroupHandle handle) const;
+    BindGroupHandle getBindGroupHandle(const std::string& bindGroupName) const;
+    // Also drops every cached group under this name.
     void deleteBindGroup(const std::string& bindGroupName);
 
     void terminate();
 private:
+    void releaseCachedBindGroups(const std::string& bindGroupName);
+
     wgpu::ShaderModule loadShaderModule(const std::filesystem::path& path, wgpu::Device device);
 };
 
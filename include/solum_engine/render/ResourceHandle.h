@@ -0,0 +1,146 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <webgpu/webgpu.hpp>
+
+// Slot index plus the generation the slot had when the handle was issued. A handle goes stale as
+// soon as its resource is replaced or removed, and stale lookups return null rather than whatever
+// reuses the slot.
+template <typename Resource>
+struct ResourceHandle {
+    uint32_t index = 0;
+    uint32_t generation = 0;
+
+    bool valid() const noexcept { return generation != 0u; }
+    explicit operator bool() const noexcept { return valid(); }
+
+    // Never repeats while the registry lives, so it can key caches built from the resource.
+    uint64_t key() const noexcept {
+        return valid() ? ((static_cast<uint64_t>(generation) << 32u) | index) : 0u;
+    }
+
+    bool operator==(const ResourceHandle& other) const noexcept {
+        return index == other.index && generation == other.generation;
+    }
+    bool operator!=(const ResourceHandle& other) const noexcept { return !(*this == other); }
+};
+
+using BufferHandle = ResourceHandle<wgpu::Buffer>;
+using TextureHandle = ResourceHandle<wgpu::Texture>;
+using TextureViewHandle = ResourceHandle<wgpu::TextureView>;
+using SamplerHandle = ResourceHandle<wgpu::Sampler>;
+using PipelineHandle = ResourceHandle<wgpu::RenderPipeline>;
+using ComputePipelineHandle = ResourceHandle<wgpu::ComputePipeline>;
+using BindGroupHandle = ResourceHandle<wgpu::BindGroup>;
+
+// Slot array of wgpu objects with a name index on the side. Per-frame code resolves a handle once
+// when the resource is created and then looks it up by index; names are only for setup and
+// debugging. The registry never releases anything itself: removal hands the object back.
+template <typename Resource>
+class ResourceRegistry {
+public:
+    using Handle = ResourceHandle<Resource>;
+
+    // Any resource already under this name is unregistered and returned through replaced.
+    Handle insert(const std::string& name, Resource resource, Resource& replaced) {
+        replaced = remove(name);
+
+        uint32_t index = 0;
+        if (!freeSlots_.empty()) {
+            index = freeSlots_.back();
+            freeSlots_.pop_back();
+        } else {
+            index = static_cast<uint32_t>(slots_.size());
+            slots_.emplace_back();
+        }
+
+        Slot& slot = slots_[index];
+        slot.resource = resource;
+        slot.live = true;
+        const Handle handle{index, slot.generation};
+        names_[name] = handle;
+        return handle;
+    }
+
+    Resource get(Handle handle) const noexcept {
+        return contains(handle) ? slots_[handle.index].resource : Resource{nullptr};
+    }
+
+    Resource get(const std::string& name) const {
+        return get(find(name));
+    }
+
+    Handle find(const std::string& name) const {
+        auto it = names_.find(name);
+        return it != names_.end() ? it->second : Handle{};
+    }
+
+    bool contains(Handle handle) const noexcept {
+        return handle.valid() &&
+               handle.index < slots_.size() &&
+               slots_[handle.index].live &&
+               slots_[handle.index].generation == handle.generation;
+    }
+
+    // Null when nothing is registered under the name.
+    Resource remove(const std::string& name) {
+        auto it = names_.find(name);
+        if (it == names_.end()) {
+            return nullptr;
+        }
+        const Handle handle = it->second;
+        names_.erase(it);
+        return releaseSlot(handle);
+    }
+
+    template <typename Fn>
+    void forEach(Fn&& fn) {
+        for (Slot& slot : slots_) {
+            if (slot.live && slot.resource) {
+                fn(slot.resource);
+            }
+        }
+    }
+
+    // Retires every slot; handles issued before the call stay stale.
+    void clear() {
+        names_.clear();
+        freeSlots_.clear();
+        for (uint32_t index = 0; index < slots_.size(); ++index) {
+            if (slots_[index].live) {
+                releaseSlot(Handle{index, slots_[index].generation});
+            } else {
+                freeSlots_.push_back(index);
+            }
+        }
+    }
+
+private:
+    struct Slot {
+        Resource resource = nullptr;
+        uint32_t generation = 1;
+        bool live = false;
+    };
+
+    Resource releaseSlot(Handle handle) {
+        if (!contains(handle)) {
+            return nullptr;
+        }
+        Slot& slot = slots_[handle.index];
+        Resource resource = slot.resource;
+        slot.resource = nullptr;
+        slot.live = false;
+        slot.generation = (slot.generation == std::numeric_limits<uint32_t>::max()) ? 1u : slot.generation + 1u;
+        freeSlots_.push_back(handle.index);
+        return resource;
+    }
+
+    std::vector<Slot> slots_;
+    std::vector<uint32_t> freeSlots_;
+    std::unordered_map<std::string, Handle> names_;
+};
@@ -33,6 +33,8 @@ struct RuntimeTimingSnapshot {
     uint64_t streamSkipUnchanged = 0;
     uint64_t streamSkipThrottle = 0;
     uint64_t streamSnapshotsPrepared = 0;
+    // Meshlets dropped because they do not fit a meshlet descriptor.
+    uint64_t streamMeshletsRejected = 0;
     uint64_t mainUploadsApplied = 0;
 
     bool worldHasPendingJobs = false;
@@ -3,13 +3,14 @@
 #include <cstdint>
 #include <cstddef>
 #include <string>
-#include <unordered_map>
 #include <webgpu/webgpu.hpp>
 
+#include "solum_engine/render/ResourceHandle.h"
+
 class TextureManager {
-    std::unordered_map<std::string, wgpu::Texture> textures;
-    std::unordered_map<std::string, wgpu::TextureView> textureViews;
-    std::unordered_map<std::string, wgpu::Sampler> samplers;
+    ResourceRegistry<wgpu::Texture> textures;
+    ResourceRegistry<wgpu::TextureView> textureViews;
+    ResourceRegistry<wgpu::Sampler> samplers;
 
     wgpu::Device device;
     wgpu::Queue queue;
@@ -23,6 +24,12 @@ public:
     wgpu::TextureView getTextureView(const std::string& viewName) const;
     wgpu::Sampler getSampler(const std::string& samplerName) const;
 
+    wgpu::Texture getTexture(TextureHandle handle) const;
+    wgpu::TextureView getTextureView(TextureViewHandle handle) const;
+    TextureHandle getTextureHandle(const std::string& textureName) const;
+    TextureViewHandle getTextureViewHandle(const std::string& viewName) const;
+    SamplerHandle getSamplerHandle(const std::string& samplerName) const;
+
     void writeTexture(const wgpu::TexelCopyTextureInfo& destination,
                       const void* data,
                       size_t size,
@@ -36,6 +36,9 @@ struct FrameUniforms {
     // occlusionParams[2]: near-distance occlusion skip (world units)
     // occlusionParams[3]: minimum projected AABB span (pixels) before occlusion tests
     float occlusionParams[4] = { 1.0f, 0.01f, 20.0f, 1.0f };
+
+    // xyz: world block position the active meshlet descriptors are relative to (see MeshletDescriptorGPU)
+    int32_t meshletOriginBase[4] = { 0, 0, 0, 0 };
 };
 
 static_assert((sizeof(FrameUniforms) % 16) == 0, "FrameUniforms must remain 16-byte aligned for WGSL uniforms");
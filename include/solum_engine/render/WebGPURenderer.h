@@ -8,6 +8,9 @@
 #include <memory>
 #include <optional>
 #include <utility>
+#include <vector>
+
+#include <glm/glm.hpp>
 
 #include "solum_engine/platform/WebGPUContext.h"
 #include "solum_engine/render/BufferManager.h"
@@ -20,9 +23,11 @@
 #include "solum_engine/render/TextureManager.h"
 #include "solum_engine/render/Uniforms.h"
 #include "solum_engine/render/pipelines/BoundsDebugPipeline.h"
+#include "solum_engine/render/pipelines/FarFieldPipeline.h"
 #include "solum_engine/render/pipelines/MeshletCullingPipeline.h"
 #include "solum_engine/render/pipelines/MeshletOcclusionPipeline.h"
 #include "solum_engine/render/pipelines/VoxelPipeline.h"
+#include "solum_engine/voxel/FarFieldTerrain.h"
 #include "solum_engine/voxel/StreamingUpload.h"
 
 class World;
@@ -36,12 +41,17 @@ private:
     std::unique_ptr<MaterialManager> materialManager;
 
     MeshletBufferController meshletBuffers_;
+    BufferHandle uniformBuffer_;
 
     std::optional<RenderServices> services_;
     std::optional<VoxelPipeline> voxelPipeline_;
     std::optional<MeshletOcclusionPipeline> meshletOcclusionPipeline_;
     std::optional<MeshletCullingPipeline> meshletCullingPipeline_;
     std::optional<BoundsDebugPipeline> boundsDebugPipeline_;
+    std::optional<FarFieldPipeline> farFieldPipeline_;
+
+    FarFieldTerrain farFieldTerrain_;
+    std::vector<uint32_t> farFieldDirtySlots_;
 
     DebugBoundsManager debugBoundsManager_;
     RuntimeTimingTracker timingTracker_;
@@ -61,6 +71,8 @@ public:
 
     PipelineManager* getPipelineManager();
     BufferManager* getBufferManager();
+    // FrameUniforms buffer shared by every pipeline.
+    BufferHandle uniformBuffer() const noexcept;
     TextureManager* getTextureManager();
     WebGPUContext* getContext();
     GLFWwindow* getWindow();
@@ -78,6 +90,11 @@ public:
     bool isMeshUploadInProgress() const noexcept;
     uint64_t uploadedMeshRevision() const noexcept;
 
+    // Far-field heightfield starts where voxel meshes stop.
+    void setFarFieldInnerRadius(int32_t radiusBlocks);
+    float farFieldViewDistance() const noexcept;
+    void updateFarField(const glm::vec3& cameraPosition);
+
     void renderFrame(FrameUniforms& uniforms);
 
     void terminate();
@@ -40,4 +40,8 @@ private:
     bool enabled_ = false;
     uint32_t vertexCount_ = 0;
     uint64_t vertexCapacityBytes_ = 0;
+
+    PipelineHandle pipeline_;
+    BindGroupHandle bindGroup_;
+    BufferHandle vertexBuffer_;
 };
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "solum_engine/render/pipelines/AbstractRenderPipeline.h"
+#include "solum_engine/voxel/FarFieldTerrain.h"
+
+#include <cstdint>
+#include <vector>
+
+// GPU mirror of one FarFieldTerrain slot.
+struct FarFieldTileRecord {
+    int32_t originX = 0;
+    int32_t originY = 0;
+    uint32_t spacing = 0;
+    uint32_t active = 0;
+    float minZ = 0.0f;
+    float maxZ = 0.0f;
+    uint32_t pad0 = 0;
+    uint32_t pad1 = 0;
+};
+
+static_assert(sizeof(FarFieldTileRecord) == 32, "FarFieldTileRecord must match the WGSL FarFieldTile layout");
+
+// Draws far-field heightfield tiles inside the voxel pass. A compute pass frustum-culls tile
+// slots into a compacted list, then one indirect draw instances the fixed tile grid.
+class FarFieldPipeline : public AbstractRenderPipeline {
+public:
+    static constexpr uint32_t kTileVertexCount =
+        FarFieldTerrain::kTileCells * FarFieldTerrain::kTileCells * 6u +
+        4u * FarFieldTerrain::kTileCells * 6u;
+
+    explicit FarFieldPipeline(RenderServices& r) : AbstractRenderPipeline(r) {}
+
+    bool build() override;
+    bool build(uint32_t tileCapacity);
+
+    void uploadTiles(const FarFieldTerrain& terrain, const std::vector<uint32_t>& dirtySlots);
+    void encodeCull(wgpu::CommandEncoder encoder);
+    void draw(wgpu::RenderPassEncoder& renderPass);
+
+    bool createResources() override;
+    void removeResources() override;
+    bool createPipeline() override;
+    bool createBindGroup() override;
+    bool render(
+        wgpu::TextureView targetView,
+        wgpu::CommandEncoder encoder,
+        const std::function<void(wgpu::RenderPassEncoder&)>& overlayCallback = {}
+    ) override;
+
+private:
+    static constexpr const char* kTileBufferName = "far_field_tile_buffer";
+    static constexpr const char* kSampleBufferName = "far_field_sample_buffer";
+    static constexpr const char* kVisibleTileBufferName = "far_field_visible_tile_buffer";
+    static constexpr const char* kParamsBufferName = "far_field_params_buffer";
+    static constexpr const char* kIndirectArgsBufferName = "far_field_indirect_args_buffer";
+    static constexpr const char* kIndirectResetBufferName = "far_field_indirect_reset_buffer";
+    static constexpr const char* kCullBglName = "far_field_cull_bgl";
+    static constexpr const char* kCullBgName = "far_field_cull_bg";
+    static constexpr const char* kCullPipelineName = "far_field_cull_pipeline";
+    static constexpr const char* kDrawBglName = "far_field_draw_bgl";
+    static constexpr const char* kDrawBgName = "far_field_draw_bg";
+    static constexpr const char* kDrawPipelineName = "far_field_pipeline";
+
+    static constexpr uint32_t kCullWorkgroupSize = 64u;
+
+    uint32_t tileCapacity_ = 1u;
+    uint32_t tileSlotCount_ = 0u;
+
+    // Resolved when the resources are created so per-frame uploads and passes skip name lookups.
+    ComputePipelineHandle cullPipeline_;
+    PipelineHandle drawPipeline_;
+    BindGroupHandle cullBindGroup_;
+    BindGroupHandle drawBindGroup_;
+    BufferHandle tileBuffer_;
+    BufferHandle sampleBuffer_;
+    BufferHandle paramsBuffer_;
+    BufferHandle indirectArgsBuffer_;
+    BufferHandle indirectResetBuffer_;
+};
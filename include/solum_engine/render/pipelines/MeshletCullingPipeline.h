@@ -6,24 +6,33 @@
 #include <cstdint>
 #include <string>
 
+// Two-level meshlet cull: a pass over per-tile-cell groups compacts the meshlets of surviving
+// groups into a candidate list, then an indirect dispatch culls only those candidates.
 class MeshletCullingPipeline : public AbstractRenderPipeline {
 public:
     static constexpr const char* kCullParamsBufferName = "meshlet_cull_params_buffer";
     static constexpr const char* kIndirectArgsBufferName = "meshlet_cull_indirect_args_buffer";
     static constexpr const char* kIndirectResetBufferName = "meshlet_cull_indirect_reset_buffer";
+    static constexpr const char* kPrepassIndirectArgsBufferName = "meshlet_cull_prepass_indirect_args_buffer";
+    static constexpr uint32_t kIndirectArgsWordCount = 5u;
 
     explicit MeshletCullingPipeline(RenderServices& r) : AbstractRenderPipeline(r) {}
 
     bool build() override;
-    bool build(const MeshletBufferController& meshletBuffers,
-               uint32_t occlusionHiZMipCount,
-               const char* occlusionHiZViewName);
-    bool refreshBindGroup(const MeshletBufferController& meshletBuffers,
-                          const char* occlusionHiZViewName);
+    // Binds the Hi-Z pyramid and layout buffers owned by MeshletOcclusionPipeline.
+    bool build(const MeshletBufferController& meshletBuffers, uint32_t occlusionHiZMipCount);
+    bool refreshBindGroup(const MeshletBufferController& meshletBuffers);
 
-    void updateCullParams(uint32_t meshletCount, uint32_t occlusionHiZMipCount);
+    void updateCullParams(uint32_t meshletCount, uint32_t groupCount, uint32_t occlusionHiZMipCount);
+    // Phase one: compacts last frame's visible meshlets into the depth prepass draw list.
+    void encodeHistory(wgpu::CommandEncoder encoder, const MeshletBufferController& meshletBuffers);
+    // Phase two: culls candidates against the Hi-Z and records visibility for the next frame.
     void encode(wgpu::CommandEncoder encoder, const MeshletBufferController& meshletBuffers);
 
+    // Draw args written by encode() and encodeHistory() respectively.
+    BufferHandle indirectArgsBuffer() const noexcept { return indirectArgsBuffer_; }
+    BufferHandle prepassIndirectArgsBuffer() const noexcept { return prepassIndirectArgsBuffer_; }
+
     bool createResources() override;
     void removeResources() override;
     bool createPipeline() override;
@@ -35,16 +44,41 @@ public:
     ) override;
 
 private:
-    bool createBindGroupForMeshBuffers(const std::string& meshletAabbBufferName,
+    bool createBindGroupForMeshBuffers(const std::string& metadataBufferName,
                                        const std::string& visibleIndicesBufferName,
-                                       const char* occlusionHiZViewName);
+                                       const std::string& prepassChunksBufferName,
+                                       const std::string& groupBufferName,
+                                       const std::string& candidateBufferName);
+    void dispatchCull(wgpu::CommandEncoder encoder,
+                      const MeshletBufferController& meshletBuffers,
+                      ComputePipelineHandle groupPipelineHandle,
+                      ComputePipelineHandle meshletPipelineHandle,
+                      BufferHandle argsBufferHandle);
 
     static constexpr const char* kCullBglName = "meshlet_cull_bgl";
     static constexpr const char* kCullBgName = "meshlet_cull_bg";
     static constexpr const char* kCullPipelineName = "meshlet_cull_pipeline";
-    static constexpr const char* kDefaultHiZViewName = "meshlet_occlusion_hiz_view";
+    static constexpr const char* kHistoryPipelineName = "meshlet_cull_history_pipeline";
+    static constexpr const char* kGroupCullBglName = "meshlet_group_cull_bgl";
+    static constexpr const char* kGroupCullBgName = "meshlet_group_cull_bg";
+    static constexpr const char* kGroupCullPipelineName = "meshlet_group_cull_pipeline";
+    static constexpr const char* kGroupHistoryPipelineName = "meshlet_group_cull_history_pipeline";
+    static constexpr const char* kCandidateResetBufferName = "meshlet_candidate_reset_buffer";
+    static constexpr const char* kVisibilityBufferName = "meshlet_visibility_buffer";
 
-    static constexpr uint32_t kMeshletCullWorkgroupSize = 128u;
+    static constexpr uint32_t kGroupCullWorkgroupSize = 64u;
 
-    std::string activeHiZViewName_ = kDefaultHiZViewName;
+    // Resolved when the resources are created so the per-frame encode skips name lookups.
+    ComputePipelineHandle cullPipeline_;
+    ComputePipelineHandle historyPipeline_;
+    ComputePipelineHandle groupCullPipeline_;
+    ComputePipelineHandle groupHistoryPipeline_;
+    BindGroupHandle cullBindGroup_;
+    BindGroupHandle groupCullBindGroup_;
+    BufferHandle cullParamsBuffer_;
+    BufferHandle indirectArgsBuffer_;
+    BufferHandle indirectResetBuffer_;
+    BufferHandle prepassIndirectArgsBuffer_;
+    BufferHandle candidateResetBuffer_;
+    BufferHandle candidateBuffer_;
 };
@@ -3,6 +3,7 @@
 #include "solum_engine/render/MeshletBufferController.h"
 #include "solum_engine/render/pipelines/AbstractRenderPipeline.h"
 
+#include <array>
 #include <cstdint>
 #include <string>
 
@@ -11,8 +12,12 @@ public:
     static constexpr uint32_t kOcclusionDepthDownsample = 2u;
     static constexpr const char* kOcclusionDepthTextureName = "meshlet_occlusion_depth_texture";
     static constexpr const char* kOcclusionDepthViewName = "meshlet_occlusion_depth_view";
-    static constexpr const char* kOcclusionHiZTextureName = "meshlet_occlusion_hiz_texture";
-    static constexpr const char* kOcclusionHiZViewName = "meshlet_occlusion_hiz_view";
+    // Hi-Z pyramid and its per-mip layout (HiZParams in meshlet_hiz.wgsl), bound by the cull passes.
+    static constexpr const char* kHiZPyramidBufferName = "meshlet_hiz_pyramid_buffer";
+    static constexpr const char* kHiZParamsBufferName = "meshlet_hiz_spd_params_buffer";
+    // A half-resolution depth buffer up to this extent keeps mip 6 within one 64x64 SPD tail tile.
+    static constexpr uint32_t kMaxOcclusionDepthExtent = 4096u;
+    static constexpr uint32_t kMaxHiZMips = 13u;
 
     explicit MeshletOcclusionPipeline(RenderServices& r) : AbstractRenderPipeline(r) {}
 
@@ -21,8 +26,11 @@ public:
     bool recreateResources(const MeshletBufferController& meshletBuffers);
     bool refreshMeshBindGroup(const MeshletBufferController& meshletBuffers);
 
+    // Rasterizes the meshlets compacted by the culling history pass, with args read from indirectArgsBuffer.
     void encodeDepthPrepass(wgpu::CommandEncoder encoder,
-                            const MeshletBufferController& meshletBuffers);
+                            const MeshletBufferController& meshletBuffers,
+                            BufferHandle indirectArgsBuffer);
+    // Builds every Hi-Z mip in one dispatch.
     void encodeHierarchyPass(wgpu::CommandEncoder encoder);
 
     uint32_t hizMipCount() const noexcept { return occlusionHiZMipCount_; }
@@ -39,21 +47,41 @@ public:
 
 private:
     bool createBindGroupForMeshBuffers(const std::string& meshDataBufferName,
-                                       const std::string& metadataBufferName);
+                                       const std::string& metadataBufferName,
+                                       const std::string& drawChunkBufferName);
+    bool createHierarchyBindGroup();
     static uint32_t computeMipCount(uint32_t width, uint32_t height);
 
+    struct HiZMipLayout {
+        uint32_t offset = 0;
+        uint32_t width = 1;
+        uint32_t height = 1;
+    };
+
     uint32_t occlusionHiZMipCount_ = 1u;
     uint32_t occlusionDepthWidth_ = 1u;
     uint32_t occlusionDepthHeight_ = 1u;
+    std::array<HiZMipLayout, kMaxHiZMips> hizMipLayouts_{};
+
+    // Resolved when the resources are created so the per-frame passes skip name lookups.
+    PipelineHandle prepassPipeline_;
+    ComputePipelineHandle spdPipeline_;
+    BindGroupHandle prepassBindGroup_;
+    BindGroupHandle spdBindGroup_;
+    TextureViewHandle occlusionDepthView_;
+    BufferHandle quadIndexBuffer_;
 
     static constexpr const char* kDepthPrepassBglName = "meshlet_depth_prepass_bgl";
     static constexpr const char* kDepthPrepassBgName = "meshlet_depth_prepass_bg";
     static constexpr const char* kDepthPrepassPipelineName = "meshlet_depth_prepass_pipeline";
 
-    static constexpr const char* kHiZSeedBglName = "meshlet_hiz_seed_bgl";
-    static constexpr const char* kHiZDownsampleBglName = "meshlet_hiz_downsample_bgl";
-    static constexpr const char* kHiZSeedPipelineName = "meshlet_hiz_seed_pipeline";
-    static constexpr const char* kHiZDownsamplePipelineName = "meshlet_hiz_downsample_pipeline";
+    static constexpr const char* kHiZSpdBglName = "meshlet_hiz_spd_bgl";
+    static constexpr const char* kHiZSpdBgName = "meshlet_hiz_spd_bg";
+    static constexpr const char* kHiZSpdPipelineName = "meshlet_hiz_spd_pipeline";
+    static constexpr const char* kHiZSyncBufferName = "meshlet_hiz_spd_sync_buffer";
 
-    static constexpr uint32_t kOcclusionHiZWorkgroupSize = 8u;
+    // Depth texels reduced by one SPD workgroup along each axis.
+    static constexpr uint32_t kHiZSpdTileTexels = 64u;
+    // Counter word plus a 64x64 mip 6 exchange image.
+    static constexpr uint32_t kHiZSyncWordCount = 1u + 64u * 64u;
 };
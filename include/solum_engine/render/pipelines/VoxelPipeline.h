@@ -9,8 +9,9 @@ class VoxelPipeline : public AbstractRenderPipeline {
 public:
     explicit VoxelPipeline(RenderServices& r) : AbstractRenderPipeline(r) {}
 
-    void setDrawConfig(uint32_t meshletVertexCount, uint32_t meshletCount);
-    void setIndirectDrawBuffer(const std::string& bufferName, uint64_t offset = 0u);
+    // Instance count for the non-indirect fallback draw over the visible chunk list.
+    void setDrawConfig(uint32_t drawChunkCount);
+    void setIndirectDrawBuffer(BufferHandle buffer, uint64_t offset = 0u);
     void clearIndirectDrawBuffer();
 
     bool createResources() override;
@@ -32,9 +33,15 @@ public:
         const std::function<void(wgpu::RenderPassEncoder&)>& overlayCallback = {}
     ) override;
 private:
-    uint32_t meshletVertexCount = 0;
-    uint32_t meshletCount = 0;
+    uint32_t drawChunkCount = 0;
     bool useIndirectDraw_ = false;
-    std::string indirectDrawBufferName_;
+    BufferHandle indirectDrawBuffer_;
     uint64_t indirectDrawOffset_ = 0u;
+
+    // Resolved when the resources are created so render() skips name lookups.
+    PipelineHandle pipeline_;
+    BindGroupHandle bindGroup_;
+    TextureViewHandle multisampleView_;
+    TextureViewHandle depthView_;
+    BufferHandle quadIndexBuffer_;
 };
@@ -7,6 +7,13 @@
 
 #include "solum_engine/voxel/BlockMaterial.h"
 
+struct LocalBlockEdit {
+    uint8_t x = 0;
+    uint8_t y = 0;
+    uint8_t z = 0;
+    BlockMaterial block{};
+};
+
 class Chunk {
 public:
     static constexpr size_t SIZE = 16;
@@ -19,9 +26,24 @@ public:
     BlockMaterial getBlock(uint8_t x, uint8_t y, uint8_t z, uint8_t mipLevel = 0) const;
     void setBlock(uint8_t x, uint8_t y, uint8_t z, const BlockMaterial blockID);
     bool isAllAir() const noexcept { return solidVoxelCount_ == 0; }
+    bool isAllSolid() const noexcept { return solidVoxelCount_ >= VOLUME; }
+    // Writes every edit at mip 0, then rebuilds each touched coarser voxel once per level.
+    // Returns how many voxels changed; partial chunks are left untouched like setBlock.
+    size_t applyEdits(const LocalBlockEdit* edits, size_t count);
+
+    // Replaces the chunk contents with a dense mip-level grid (x fastest, then y, then z).
+    // Finer levels are released and coarser levels are derived from the filled one.
+    void fillMipLevel(uint8_t mipLevel, const std::vector<BlockMaterial>& blocks);
+    uint8_t minResidentMip() const noexcept { return minResidentMip_; }
+    bool isMipResident(uint8_t mipLevel) const noexcept { return mipLevel >= minResidentMip_; }
+    // Frees every level finer than mipLevel; coarser levels stay valid.
+    void releaseMipsBelow(uint8_t mipLevel);
     static constexpr uint8_t mipSize(uint8_t mipLevel) {
         return (mipLevel > MAX_MIP_LEVEL) ? 1u : static_cast<uint8_t>(SIZE >> mipLevel);
     }
+    // Conservative: true when any block under this mip voxel is solid at the finest resident
+    // level. Unlike the downsampled blocks, a false here means the whole footprint is air.
+    bool isOccupied(uint8_t x, uint8_t y, uint8_t z, uint8_t mipLevel) const;
 
 private:
     struct MipStorage {
@@ -32,12 +54,23 @@ private:
     };
 
     std::array<MipStorage, MAX_MIP_LEVEL + 1> mips_{};
+    // One bit per voxel of mips 1..3 (512 + 64 + 8 bits); mip 4 is just solidVoxelCount_.
+    std::array<uint64_t, 10> occupancy_{};
     uint16_t solidVoxelCount_ = 0;
+    uint8_t minResidentMip_ = 0;
 
     static uint16_t getVoxelIndex(uint8_t x, uint8_t y, uint8_t z, uint8_t size);
     static uint32_t getPaletteIndex(const MipStorage& storage, uint16_t voxelIndex);
     static void setPaletteIndex(MipStorage& storage, uint16_t voxelIndex, uint32_t paletteIndex);
     static void resizeBitArray(MipStorage& storage, uint8_t newBitsPerBlock);
+    static void resetStorage(MipStorage& storage, uint8_t mipLevel);
+    static void fillStorageFromDense(MipStorage& storage, const std::vector<BlockMaterial>& blocks);
+
+    bool occupancyBit(uint8_t mipLevel, uint16_t voxelIndex) const;
+    void setOccupancyBit(uint8_t mipLevel, uint16_t voxelIndex, bool occupied);
+    bool anyChildOccupied(uint8_t mipLevel, uint8_t px, uint8_t py, uint8_t pz) const;
+    void updateOccupancyAbove(uint8_t x, uint8_t y, uint8_t z, bool solid);
+    void rebuildOccupancy();
 
     static bool isSolid(BlockMaterial block);
     static BlockMaterial airBlock();
@@ -1,12 +1,16 @@
 #pragma once
 #include "solum_engine/voxel/Chunk.h"
 #include "solum_engine/voxel/BlockMaterial.h"
+#include <algorithm>
 #include <array>
 #include <cstdint>
 
 class Column {
 public:
     static constexpr size_t HEIGHT = 32;
+    static constexpr int32_t HEIGHT_BLOCKS = static_cast<int32_t>(HEIGHT * Chunk::SIZE);
+    // Surface height of an all-air stack, and min/max z of an all-air column.
+    static constexpr int16_t kNoSolidZ = -1;
     static constexpr uint32_t allChunksEmptyMask() {
         const uint32_t clampedBits = (HEIGHT >= 32) ? 32u : static_cast<uint32_t>(HEIGHT);
         return (clampedBits == 0u) ? 0u : (0xFFFFFFFFu >> (32u - clampedBits));
@@ -35,37 +39,151 @@ public:
         }
 
         const uint8_t local_z = static_cast<uint8_t>(z % Chunk::SIZE);
-        Chunk& chunk = chunks_[chunk_z];
-        const bool wasEmpty = chunk.isAllAir();
-        chunk.setBlock(x, y, local_z, blockID);
-        const bool isEmpty = chunk.isAllAir();
+        chunks_[chunk_z].setBlock(x, y, local_z, blockID);
+        updateChunkMasks(chunk_z);
+    }
 
-        if (wasEmpty == isEmpty) {
-            return;
+    // Keeps the surface metadata current, unlike setBlock.
+    size_t applyChunkEdits(uint8_t chunk_z, const LocalBlockEdit* edits, size_t count) {
+        if (chunk_z >= HEIGHT) {
+            return 0;
         }
 
-        const uint32_t bit = (1u << chunk_z);
-        if (isEmpty) {
-            emptyChunkMask_ |= bit;
-        } else {
-            emptyChunkMask_ &= ~bit;
+        const size_t changed = chunks_[chunk_z].applyEdits(edits, count);
+        updateChunkMasks(chunk_z);
+        if (changed == 0) {
+            return 0;
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            const LocalBlockEdit& edit = edits[i];
+            if (edit.x >= Chunk::SIZE || edit.y >= Chunk::SIZE || edit.z >= Chunk::SIZE) {
+                continue;
+            }
+            const int16_t z = static_cast<int16_t>(chunk_z * Chunk::SIZE + edit.z);
+            int16_t& surface = surfaceHeights_[surfaceIndex(edit.x, edit.y)];
+            if (isSolidBlock(edit.block)) {
+                surface = std::max(surface, z);
+            } else if (z == surface) {
+                surface = findTopSolidZ(edit.x, edit.y, z);
+            }
         }
+        refreshSolidRange();
+        return changed;
     }
 
     Chunk& getChunk(uint8_t chunk_z) { return chunks_[chunk_z]; }
     const Chunk& getChunk(uint8_t chunk_z) const { return chunks_[chunk_z]; }
     uint32_t getEmptyChunkMask() const noexcept { return emptyChunkMask_; }
+    uint32_t getFullChunkMask() const noexcept { return fullChunkMask_; }
+
+    // Surface metadata describes the finest data the column was generated or edited at;
+    // releasing fine mips keeps it. Rebuilt by rebuildSurfaceMetadata after bulk setBlock writes.
+    int16_t surfaceHeight(uint8_t x, uint8_t y) const noexcept {
+        return (x < Chunk::SIZE && y < Chunk::SIZE) ? surfaceHeights_[surfaceIndex(x, y)] : kNoSolidZ;
+    }
+    const std::array<int16_t, Chunk::SIZE * Chunk::SIZE>& surfaceHeights() const noexcept { return surfaceHeights_; }
+    int16_t minSolidZ() const noexcept { return minSolidZ_; }
+    int16_t maxSolidZ() const noexcept { return maxSolidZ_; }
 
-    void rebuildEmptyChunkMask() noexcept {
+    // Finest mip stored by every chunk; non-zero for columns generated at coarse resolution.
+    uint8_t minResidentMip() const noexcept {
+        uint8_t mip = 0;
+        for (const Chunk& chunk : chunks_) {
+            mip = std::max(mip, chunk.minResidentMip());
+        }
+        return mip;
+    }
+
+    void releaseMipsBelow(uint8_t mipLevel) {
+        for (Chunk& chunk : chunks_) {
+            chunk.releaseMipsBelow(mipLevel);
+        }
+    }
+
+    void rebuildChunkMasks() noexcept {
         emptyChunkMask_ = 0u;
+        fullChunkMask_ = 0u;
         for (uint8_t chunk_z = 0; chunk_z < HEIGHT; ++chunk_z) {
-            if (chunks_[chunk_z].isAllAir()) {
-                emptyChunkMask_ |= (1u << chunk_z);
+            updateChunkMasks(chunk_z);
+        }
+    }
+
+    void rebuildSurfaceMetadata() {
+        rebuildChunkMasks();
+        for (uint8_t y = 0; y < Chunk::SIZE; ++y) {
+            for (uint8_t x = 0; x < Chunk::SIZE; ++x) {
+                surfaceHeights_[surfaceIndex(x, y)] = findTopSolidZ(x, y, HEIGHT_BLOCKS - 1);
             }
         }
+        refreshSolidRange();
     }
 
 private:
+    static constexpr size_t surfaceIndex(uint8_t x, uint8_t y) { return static_cast<size_t>(y) * Chunk::SIZE + x; }
+    static bool isSolidBlock(BlockMaterial block) { return block.unpack().id != 0u; }
+
+    void updateChunkMasks(uint8_t chunk_z) noexcept {
+        const uint32_t bit = (1u << chunk_z);
+        const Chunk& chunk = chunks_[chunk_z];
+        emptyChunkMask_ = chunk.isAllAir() ? (emptyChunkMask_ | bit) : (emptyChunkMask_ & ~bit);
+        fullChunkMask_ = chunk.isAllSolid() ? (fullChunkMask_ | bit) : (fullChunkMask_ & ~bit);
+    }
+
+    // Highest solid z at or below fromZ, skipping empty and full chunks without sampling.
+    int16_t findTopSolidZ(uint8_t x, uint8_t y, int32_t fromZ) const {
+        for (int32_t z = fromZ; z >= 0; --z) {
+            const uint32_t bit = 1u << (z / static_cast<int32_t>(Chunk::SIZE));
+            if ((fullChunkMask_ & bit) != 0u) {
+                return static_cast<int16_t>(z);
+            }
+            if ((emptyChunkMask_ & bit) != 0u) {
+                z -= z % static_cast<int32_t>(Chunk::SIZE);
+                continue;
+            }
+            if (isSolidBlock(getBlock(x, y, static_cast<uint16_t>(z)))) {
+                return static_cast<int16_t>(z);
+            }
+        }
+        return kNoSolidZ;
+    }
+
+    void refreshSolidRange() {
+        maxSolidZ_ = *std::max_element(surfaceHeights_.begin(), surfaceHeights_.end());
+        minSolidZ_ = kNoSolidZ;
+        for (uint8_t chunk_z = 0; chunk_z < HEIGHT && minSolidZ_ == kNoSolidZ; ++chunk_z) {
+            if ((emptyChunkMask_ & (1u << chunk_z)) != 0u) {
+                continue;
+            }
+            const int32_t baseZ = static_cast<int32_t>(chunk_z * Chunk::SIZE);
+            if ((fullChunkMask_ & (1u << chunk_z)) != 0u) {
+                minSolidZ_ = static_cast<int16_t>(baseZ);
+                break;
+            }
+            for (int32_t z = baseZ; z < baseZ + static_cast<int32_t>(Chunk::SIZE) && minSolidZ_ == kNoSolidZ; ++z) {
+                for (uint8_t y = 0; y < Chunk::SIZE && minSolidZ_ == kNoSolidZ; ++y) {
+                    for (uint8_t x = 0; x < Chunk::SIZE; ++x) {
+                        if (isSolidBlock(getBlock(x, y, static_cast<uint16_t>(z)))) {
+                            minSolidZ_ = static_cast<int16_t>(z);
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
     std::array<Chunk, HEIGHT> chunks_;
     uint32_t emptyChunkMask_ = allChunksEmptyMask();
+    uint32_t fullChunkMask_ = 0u;
+    // Top solid z per (x, y), x fastest.
+    std::array<int16_t, Chunk::SIZE * Chunk::SIZE> surfaceHeights_ = makeEmptySurface();
+    int16_t minSolidZ_ = kNoSolidZ;
+    int16_t maxSolidZ_ = kNoSolidZ;
+
+    static constexpr std::array<int16_t, Chunk::SIZE * Chunk::SIZE> makeEmptySurface() {
+        std::array<int16_t, Chunk::SIZE * Chunk::SIZE> heights{};
+        heights.fill(kNoSolidZ);
+        return heights;
+    }
 };
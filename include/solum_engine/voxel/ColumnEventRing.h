@@ -0,0 +1,75 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "solum_engine/resources/Coords.h"
+
+enum class ColumnEventType : uint8_t {
+    // New or finer data became resident.
+    Generated = 0,
+    // Fine mips were released; coarser data is still resident.
+    Evicted,
+    // Blocks changed in place.
+    Edited
+};
+
+// Column faces whose one-block border changed, so neighbors reading it as padding are stale too.
+inline constexpr uint8_t kColumnBorderMinusX = 1u << 0;
+inline constexpr uint8_t kColumnBorderPlusX = 1u << 1;
+inline constexpr uint8_t kColumnBorderMinusY = 1u << 2;
+inline constexpr uint8_t kColumnBorderPlusY = 1u << 3;
+inline constexpr uint8_t kColumnBorderAll = 0x0Fu;
+
+// One bit per chunk z in the column that changed.
+inline constexpr uint32_t kColumnChunksAll = ~uint32_t{0};
+
+struct ColumnEvent {
+    ColumnCoord coord{};
+    ColumnEventType type = ColumnEventType::Generated;
+    uint8_t borderMask = kColumnBorderAll;
+    uint32_t chunkZMask = kColumnChunksAll;
+};
+
+// Bounded single-producer, multi-subscriber feed of column notifications. Subscribers
+// own their cursor and never block the producer; one that falls more than a ring behind
+// is told so and must resync from World state.
+class ColumnEventRing {
+public:
+    // Rounded up to a power of two.
+    explicit ColumnEventRing(std::size_t capacity);
+
+    ColumnEventRing(const ColumnEventRing&) = delete;
+    ColumnEventRing& operator=(const ColumnEventRing&) = delete;
+
+    // Callers must serialize publishers; World publishes under its write lock.
+    void publish(const ColumnEvent& event);
+
+    // Sequence number of the next event; a new subscriber starts its cursor here.
+    uint64_t head() const noexcept { return head_.load(std::memory_order_acquire); }
+    std::size_t capacity() const noexcept { return slots_.size(); }
+
+    // Appends up to maxCount events after `cursor` and advances it. Returns false when
+    // events were overwritten before being read; the cursor then jumps to head and the
+    // partially read output must be discarded.
+    bool read(uint64_t& cursor, std::vector<ColumnEvent>& outEvents, std::size_t maxCount) const;
+
+private:
+    // Seqlock per slot: version is the event's sequence + 1 once published, kWriting while
+    // the producer overwrites it.
+    struct Slot {
+        std::atomic<uint64_t> version{0};
+        std::atomic<uint64_t> packedCoord{0};
+        std::atomic<uint8_t> type{0};
+        std::atomic<uint8_t> borderMask{0};
+        std::atomic<uint32_t> chunkZMask{0};
+    };
+
+    static constexpr uint64_t kWriting = ~uint64_t{0};
+
+    std::vector<Slot> slots_;
+    uint64_t mask_ = 0;
+    std::atomic<uint64_t> head_{0};
+};
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+// Coarse heightfield tiles covering the ring beyond the voxel mesh radius, sampled straight
+// from the terrain heightmap. Tiles form a quadtree around the camera and sit in fixed slots,
+// so the renderer re-uploads only the slots that changed.
+class FarFieldTerrain {
+public:
+    struct Config {
+        // Horizontal radius around the camera already covered by voxel meshes.
+        int32_t innerRadiusBlocks = 2048;
+        int32_t outerRadiusBlocks = 16384;
+        // Band inside the inner radius drawn by both layers; depth testing resolves it.
+        int32_t seamOverlapBlocks = 48;
+        // Sample spacing of the finest level; every coarser level doubles it.
+        int32_t baseSampleSpacing = 8;
+        // A tile splits while the camera is closer than this many tile widths.
+        float lodDistanceFactor = 2.0f;
+        // Lowers the heightfield so voxel surfaces win depth ties in the seam band.
+        float sinkBlocks = 4.0f;
+        uint32_t maxTiles = 1024;
+        uint32_t maxTileBuildsPerUpdate = 16;
+    };
+
+    static constexpr uint32_t kTileCells = 32;
+    static constexpr uint32_t kTileSamplesPerAxis = kTileCells + 1;
+    static constexpr uint32_t kTileSampleCount = kTileSamplesPerAxis * kTileSamplesPerAxis;
+
+    struct Tile {
+        glm::ivec2 origin{0, 0};
+        int32_t spacing = 0;
+        int32_t minZ = 0;
+        int32_t maxZ = 0;
+        bool active = false;
+        // Row-major; surface height in the low 16 bits, material id in the high 16.
+        std::vector<uint32_t> samples;
+    };
+
+    FarFieldTerrain();
+    explicit FarFieldTerrain(Config config);
+
+    void setInnerRadiusBlocks(int32_t radiusBlocks);
+
+    // Appends the slots whose tile was built or retired by this call.
+    void update(const glm::vec3& cameraPosition, std::vector<uint32_t>& outDirtySlots);
+
+    const Config& config() const noexcept { return config_; }
+    const Tile& tile(uint32_t slot) const { return tiles_[slot]; }
+    // Slots at or past this index have never held a tile.
+    uint32_t slotCount() const noexcept { return static_cast<uint32_t>(tiles_.size()); }
+    bool hasPendingBuilds() const noexcept { return !pendingBuilds_.empty(); }
+    float seamRadiusBlocks() const noexcept;
+    // Farthest horizontal distance a tile can reach from the camera.
+    float viewDistanceBlocks() const noexcept;
+
+private:
+    struct TileKey {
+        int32_t level = 0;
+        int32_t x = 0;
+        int32_t y = 0;
+
+        bool operator==(const TileKey& other) const noexcept {
+            return level == other.level && x == other.x && y == other.y;
+        }
+    };
+
+    struct TileKeyHash {
+        std::size_t operator()(const TileKey& key) const noexcept;
+    };
+
+    int32_t tileSizeBlocks(int32_t level) const noexcept;
+    void selectTiles(const glm::ivec2& center);
+    void selectTilesRecursive(const glm::ivec2& center, const TileKey& key, float skipRadius);
+    bool allocateSlot(uint32_t& outSlot);
+    void buildTile(const TileKey& key, Tile& tile) const;
+    void retireStaleTiles(std::vector<uint32_t>& outDirtySlots);
+
+    static void sanitizeConfig(Config& config);
+
+    Config config_;
+    std::vector<Tile> tiles_;
+    std::vector<uint32_t> freeSlots_;
+    std::unordered_map<TileKey, uint32_t, TileKeyHash> residentTiles_;
+    std::unordered_set<TileKey, TileKeyHash> desiredTiles_;
+    std::vector<TileKey> pendingBuilds_;
+    glm::ivec2 selectionAnchor_{0, 0};
+    bool hasSelection_ = false;
+};
@@ -1,9 +1,12 @@
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
-#include <deque>
+#include <list>
+#include <mutex>
 #include <shared_mutex>
 #include <unordered_map>
 #include <unordered_set>
@@ -15,6 +18,8 @@
 #include "solum_engine/render/MeshletTypes.h"
 #include "solum_engine/resources/Coords.h"
 #include "solum_engine/voxel/Chunk.h"
+#include "solum_engine/voxel/ColumnEventRing.h"
+#include "solum_engine/voxel/StreamingPolicy.h"
 
 class World;
 
@@ -125,9 +130,34 @@ public:
         float lodSseHysteresisPixels = 0.25f;
         float lodSseMinDepthBlocks = 4.0f;
         float lodSseFallbackProjectionScale = 390.0f;
+        // Projection scale residentMipRadii sizes the mip rings for (about 1080p at a 70 degree
+        // vertical FOV). Past it, LOD selection is clamped to the mip that is resident instead
+        // of meshing upsampled coarse data.
+        float lodMipRingProjectionScale = 800.0f;
+        // How long a cell waits for its one-column border before meshing against unknown neighbors.
+        float meshDependencyDeadlineSeconds = 0.5f;
+        // Finished chunk-cell meshes kept by padded input hash; 0 disables the cache.
+        std::size_t meshCacheCapacity = 2048;
+        // Target wall time of one updatePlayerPosition call (the StreamMeshUpdate stage);
+        // whatever scheduling leaves of it goes to integrating finished cells.
+        float meshUpdateTargetMs = 8.0f;
+        float completionBudgetMinMs = 1.0f;
+        StreamingPolicy::Config streamingPolicy{};
         jobsystem::JobSystem::Config jobConfig{};
     };
 
+    struct ObserverConfig {
+        // Mesh radius in chunks; 0 or anything larger uses the last lodChunkRadii entry.
+        int32_t maxRadiusChunks = 0;
+        // 0 uses Config::lodSseTargetPixels.
+        float lodSseTargetPixels = 0.0f;
+    };
+
+    // Column radius inside which mip i must stay resident (entry i) for every LOD the SSE
+    // test can pick up to lodMipRingProjectionScale; the last entry covers the whole mesh
+    // window. Feed it to World::Config::mipGenerationRadii.
+    static std::vector<int32_t> residentMipRadii(Config config);
+
     explicit MeshManager(const World& world);
     MeshManager(const World& world, Config config);
     ~MeshManager();
@@ -137,78 +167,201 @@ public:
     MeshManager(MeshManager&&) = delete;
     MeshManager& operator=(MeshManager&&) = delete;
 
+    // Drives kPrimaryStreamingObserver, then schedules remeshes and integrates finished
+    // cells for every observer. Call once per streaming tick after any updateObserver calls.
     void updatePlayerPosition(const glm::vec3& playerWorldPosition, float sseProjectionScale);
+    void updateView(const StreamingView& view);
+
+    // Extra interest centers sharing the tile store. Each tile renders the finest LOD any
+    // observer asks for, and copyMeshletsAround serves each observer's own window.
+    StreamingObserverId registerObserver(const ObserverConfig& observerConfig);
+    void removeObserver(StreamingObserverId id);
+    void updateObserver(StreamingObserverId id, const glm::vec3& worldPosition, float sseProjectionScale);
+    void updateObserverView(StreamingObserverId id, const StreamingView& view);
+    // Queues a remesh of exactly the LOD cells whose padded footprint reads these columns.
+    void markColumnsDirty(const std::vector<ColumnCoord>& columns);
 
     std::vector<Meshlet> copyMeshlets() const;
-    std::vector<Meshlet> copyMeshletsAround(const ColumnCoord& centerColumn, int32_t columnRadius) const;
+    // Euclidean column radius, like the generation and meshing windows. outGroups, when given,
+    // receives one range per non-empty LOD cell and per tile's skirts.
+    std::vector<Meshlet> copyMeshletsAround(const ColumnCoord& centerColumn,
+                                            int32_t columnRadius,
+                                            std::vector<MeshletGroupRange>* outGroups = nullptr) const;
     uint64_t meshRevision() const noexcept;
     bool hasPendingJobs() const;
 
 private:
     struct CompletedTileCellResult {
         TileLodCellCoord coord;
+        // LOD cells along z that were meshed; the cell's other z cells keep their meshlets.
+        uint32_t zMask = 0u;
         std::vector<Meshlet> meshlets;
     };
 
+    static constexpr size_t kMaxLodLevels = static_cast<size_t>(Chunk::MAX_MIP_LEVEL) + 1;
+
     struct MeshTileLodState {
-        std::unordered_map<uint32_t, std::vector<Meshlet>> cellMeshes;
+        // Indexed by cellY * cellsPerAxis + cellX; sized when the LOD is first scheduled.
+        std::vector<std::vector<Meshlet>> cellMeshes;
+        std::vector<uint8_t> cellMeshed;
+        int32_t meshedCellCount = 0;
         int32_t expectedCellCount = 0;
     };
 
+    // One slot of the toroidal tile grid; coord names the tile currently owning it.
     struct MeshTileState {
-        std::unordered_map<uint8_t, MeshTileLodState> lodStates;
+        MeshTileCoord coord{};
+        bool occupied = false;
+        std::array<MeshTileLodState, kMaxLodLevels> lodStates{};
         int8_t desiredLod = -1;
         int8_t renderedLod = -1;
     };
 
     struct MeshGenerationResult;
 
-    void scheduleTilesAround(const ChunkCoord& centerChunk,
-                             const glm::vec3& playerWorldPosition,
-                             float sseProjectionScale,
+    // Inputs to one observer's SSE LOD selection, copied out so selection runs unlocked.
+    struct ObserverLodParams {
+        ChunkCoord centerChunk{0, 0, 0};
+        glm::vec3 position{0.0f, 0.0f, 0.0f};
+        float sseProjectionScale = 390.0f;
+        int32_t maxRadiusChunks = 0;
+        float lodSseTargetPixels = 4.0f;
+    };
+
+    struct ObserverState {
+        ObserverLodParams lod{};
+        bool hasCenter = false;
+        bool hasSseProjectionScale = false;
+        StreamingPolicy policy;
+        ChunkCoord lodRefreshScanCenterChunk{0, 0, 0};
+        bool hasLodRefreshScanCenter = false;
+        int32_t lodRefreshScanNextIndex = 0;
+        // Only tiles this observer wants meshed; absent means no request.
+        std::unordered_map<MeshTileCoord, int8_t> desiredLodByTile;
+    };
+
+    // Inclusive column bounds of a cell's footprint.
+    struct CellColumnBounds {
+        int32_t minX = 0;
+        int32_t maxX = 0;
+        int32_t minY = 0;
+        int32_t maxY = 0;
+    };
+
+    // Chunk masks of one column, cached per meshing job; known is false for ungenerated columns.
+    struct ColumnChunkMasks {
+        uint32_t emptyMask = 0u;
+        uint32_t fullMask = 0u;
+        bool known = false;
+    };
+
+    enum class CellDependencyState : uint8_t {
+        FootprintMissing,
+        BorderMissing,
+        Ready
+    };
+
+    struct MeshCacheEntry {
+        ChunkCoord cellCoord{};
+        uint8_t lodLevel = 0;
+        std::vector<Meshlet> meshlets;
+        std::list<uint64_t>::iterator lruIt;
+    };
+
+    struct DeferredCellState {
+        std::chrono::steady_clock::time_point firstDeferred{};
+        jobsystem::Priority priority = jobsystem::Priority::Low;
+        bool forceRemesh = false;
+        int32_t activeWindowExtraChunks = 0;
+        uint32_t zMask = 0u;
+    };
+
+    struct DirtyCellState {
+        jobsystem::Priority priority = jobsystem::Priority::Low;
+        uint32_t zMask = 0u;
+    };
+
+    void scheduleTilesAround(StreamingObserverId observerId,
+                             const ObserverLodParams& observerLod,
                              const ChunkCoord* previousCenterChunk,
                              int32_t centerShiftChunks);
-    void scheduleRemeshForNewColumns(const ColumnCoord& centerColumn);
+    void scheduleRemeshForNewColumns();
     void scheduleTileLodMeshing(const TileLodCoord& coord,
                                 jobsystem::Priority priority,
                                 bool forceRemesh,
                                 int32_t activeWindowExtraChunks);
+    // zMask picks the LOD cells along z to mesh; a cell that was never meshed is meshed whole.
     void scheduleTileLodCellMeshing(const TileLodCellCoord& coord,
                                     jobsystem::Priority priority,
                                     bool forceRemesh,
-                                    int32_t activeWindowExtraChunks);
-    void applyCompletedTileResultsBudgeted();
+                                    int32_t activeWindowExtraChunks,
+                                    uint32_t zMask);
+    void scheduleDirtyCells();
+    void retryDeferredCells();
+    void applyCompletedTileResultsBudgeted(float budgetMs);
+    void markColumnEventsDirty(const std::vector<ColumnEvent>& events);
 
-    void onTileLodCellMeshed(const TileLodCellCoord& coord, std::vector<Meshlet>&& meshlets);
+    void onTileLodCellMeshed(const TileLodCellCoord& coord, uint32_t zMask, std::vector<Meshlet>&& meshlets);
 
     int8_t desiredLodForTile(const MeshTileCoord& tileCoord,
-                             const ChunkCoord& centerChunk,
-                             const glm::vec3& playerWorldPosition,
-                             float sseProjectionScale,
+                             const ObserverLodParams& observerLod,
                              int32_t extraChunks) const;
     float tileDepthEstimateBlocks(const MeshTileCoord& tileCoord,
                                   const glm::vec3& playerWorldPosition,
                                   int32_t extraChunks) const;
     float projectedSsePixels(uint8_t lodLevel, float depthBlocks, float sseProjectionScale) const;
+    // Finest LOD whose mip is resident over the tile's whole padded footprint.
+    int8_t finestResidentLodForTile(const MeshTileCoord& tileCoord, const ObserverLodParams& observerLod) const;
     int8_t applyLodHysteresis(const MeshTileCoord& tileCoord,
                               int8_t candidateLod,
                               int8_t previousLod,
-                              const glm::vec3& playerWorldPosition,
-                              float sseProjectionScale) const;
+                              const ObserverLodParams& observerLod) const;
     bool isTileWithinActiveWindowLocked(const MeshTileCoord& tileCoord, int32_t extraChunks) const;
-    bool isTileFootprintGenerated(const MeshTileCoord& tileCoord) const;
+    int8_t combinedDesiredLodLocked(const MeshTileCoord& tileCoord) const;
+    void refreshTilesLocked(int32_t pruneExtraChunks);
+    int32_t tileScore(const StreamingPolicy& policy, const MeshTileCoord& tileCoord) const;
+    void tileBoundsBlocks(const MeshTileCoord& tileCoord, glm::vec2& outMin, glm::vec2& outMax) const;
+    CellColumnBounds cellColumnBounds(const TileLodCellCoord& coord) const;
+    TileLodCellCoord cellForColumn(const ColumnCoord& column, uint8_t lodLevel) const;
+    CellDependencyState cellDependencyState(const TileLodCellCoord& coord) const;
+    bool lookupColumnChunkMasks(const ColumnCoord& column,
+                                std::unordered_map<ColumnCoord, ColumnChunkMasks>& maskCache,
+                                ColumnChunkMasks& outMasks) const;
     bool isLodCellAllAir(const ChunkCoord& cellCoord,
                          uint8_t lodLevel,
-                         std::unordered_map<ColumnCoord, uint32_t>& emptyMaskCache) const;
+                         std::unordered_map<ColumnCoord, ColumnChunkMasks>& maskCache) const;
+    // Every chunk in the cell is solid and so is every chunk its face padding reads from,
+    // so the mesher would emit nothing.
+    bool isLodCellEnclosed(const ChunkCoord& cellCoord,
+                           uint8_t lodLevel,
+                           std::unordered_map<ColumnCoord, ColumnChunkMasks>& maskCache) const;
     int8_t chooseRenderableLodForTileLocked(const MeshTileState& state) const;
-    void refreshRenderedLodsLocked();
+
+    size_t tileSlotIndex(const MeshTileCoord& tileCoord) const;
+    MeshTileState* findTileLocked(const MeshTileCoord& tileCoord);
+    const MeshTileState* findTileLocked(const MeshTileCoord& tileCoord) const;
+    MeshTileState* acquireTileLocked(const MeshTileCoord& tileCoord);
+    static void resetTileLocked(MeshTileState& tileState);
+    void prepareLodCellsLocked(MeshTileLodState& lodState, uint8_t lodLevel) const;
+    // Tiles reaching into the disc around centerColumn, or every tile when it is null.
+    std::vector<Meshlet> collectMeshletsLocked(const ColumnCoord* centerColumn,
+                                               int32_t columnRadius,
+                                               std::vector<MeshletGroupRange>* outGroups) const;
 
     std::vector<Meshlet> meshLodCell(const ChunkCoord& cellCoord, uint8_t lodLevel) const;
+    bool tryGetCachedMesh(uint64_t contentHash,
+                          const ChunkCoord& cellCoord,
+                          uint8_t lodLevel,
+                          std::vector<Meshlet>& outMeshlets) const;
+    void storeCachedMesh(uint64_t contentHash,
+                         const ChunkCoord& cellCoord,
+                         uint8_t lodLevel,
+                         const std::vector<Meshlet>& meshlets) const;
 
     int32_t cellSpanChunksForLod(uint8_t lodLevel) const;
     int32_t cellSpanLodCellsForLod(uint8_t lodLevel) const;
     int32_t cellCountPerAxisForLod(uint8_t lodLevel) const;
-    uint32_t packCellKey(uint16_t cellX, uint16_t cellY) const;
+    size_t cellSlotIndex(const TileLodCellCoord& coord) const;
     static bool tileInBounds(const MeshTileCoord& tileCoord,
                              int32_t minTileX,
                              int32_t maxTileX,
@@ -219,6 +372,9 @@ private:
 
     static uint8_t chunkSpanForLod(uint8_t lodLevel);
     static int32_t chunkZCountForLod(uint8_t lodLevel);
+    static uint32_t allCellZMask(uint8_t lodLevel);
+    // LOD cell z bits covering any of the given column chunk z bits.
+    static uint32_t cellZMaskForChunks(uint32_t chunkZMask, uint8_t lodLevel);
     static jobsystem::Priority priorityFromLodLevel(uint8_t lodLevel);
     static void sanitizeConfig(Config& config);
 
@@ -226,27 +382,32 @@ private:
     Config config_;
     jobsystem::JobSystem jobs_;
     int32_t meshTileSizeChunks_ = 1;
+    std::vector<int32_t> residentMipRadii_;
 
     mutable std::shared_mutex meshMutex_;
-    std::unordered_set<ColumnCoord> knownGeneratedColumns_;
     std::unordered_set<TileLodCellCoord> pendingTileJobs_;
-    std::unordered_set<TileLodCellCoord> deferredRemeshTileLods_;
+    // z cells to remesh once the cell's in-flight job lands.
+    std::unordered_map<TileLodCellCoord, uint32_t> deferredRemeshTileLods_;
+    std::unordered_map<TileLodCellCoord, DeferredCellState> deferredCells_;
+    std::unordered_map<TileLodCellCoord, DirtyCellState> dirtyCells_;
     std::unordered_map<MeshTileCoord, std::vector<CompletedTileCellResult>> completedTileResultsByTile_;
-    std::deque<MeshTileCoord> completedTileResultOrder_;
-    std::unordered_set<MeshTileCoord> completedTileResultQueued_;
-    std::unordered_map<MeshTileCoord, MeshTileState> meshTiles_;
+    // Camera-centered ring buffer of tiles with power-of-two extent, indexed by wrapped tile coords.
+    std::vector<MeshTileState> tileGrid_;
+    int32_t tileGridExtent_ = 1;
+    int32_t tileGridWindowExtraChunks_ = 0;
+    // Live tiles whose grid slot is held by another live tile; only distant observers need these.
+    std::unordered_map<MeshTileCoord, MeshTileState> overflowTiles_;
+    std::unordered_map<StreamingObserverId, ObserverState> observers_;
+    StreamingObserverId nextObserverId_ = kPrimaryStreamingObserver + 1;
+
+    mutable std::mutex meshCacheMutex_;
+    mutable std::list<uint64_t> meshCacheLru_;
+    mutable std::unordered_map<uint64_t, MeshCacheEntry> meshCache_;
 
     std::atomic<uint64_t> meshRevision_{0};
-    std::atomic<uint64_t> processedWorldGenerationRevision_{0};
+    // Only touched by the thread calling updatePlayerPosition.
+    uint64_t columnEventCursor_ = 0;
     std::atomic<bool> shuttingDown_{false};
 
-    ChunkCoord lastScheduledCenterChunk_{0, 0, 0};
-    bool hasLastScheduledCenter_ = false;
-
-    ChunkCoord lodRefreshScanCenterChunk_{0, 0, 0};
-    bool hasLodRefreshScanCenter_ = false;
-    int32_t lodRefreshScanNextIndex_ = 0;
-    glm::vec3 lastPlayerWorldPosition_{0.0f, 0.0f, 0.0f};
-    float lastSseProjectionScale_ = 390.0f;
-    bool hasLastSseProjectionScale_ = false;
+    float smoothedSchedulingMs_ = 0.0f;
 };
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+
+#include <glm/glm.hpp>
+
+#include "solum_engine/jobsystem/job_system.hpp"
+
+using StreamingObserverId = uint32_t;
+// Always registered; driven by the single-camera updatePlayerPosition/updateView entry points.
+inline constexpr StreamingObserverId kPrimaryStreamingObserver = 0;
+
+// Camera state the world and mesh schedulers rank their queued work against.
+struct StreamingView {
+    glm::vec3 position{0.0f, 0.0f, 0.0f};
+    glm::vec3 forward{0.0f, 0.0f, 0.0f};
+    glm::vec3 velocity{0.0f, 0.0f, 0.0f};
+};
+
+// Scores horizontal positions by distance from the camera or from where it will be
+// shortly, stretched for anything outside the view cone. Lower scores stream first.
+class StreamingPolicy {
+public:
+    struct Config {
+        float lookaheadSeconds = 1.0f;
+        float maxLookaheadBlocks = 512.0f;
+        // Cosine of the half-angle that keeps full priority.
+        float viewConeCosine = 0.5f;
+        // Distance multiplier for work directly behind the camera.
+        float behindDistanceScale = 3.0f;
+        // The camera turns faster than terrain streams, so nearby work is never demoted.
+        float nearRadiusBlocks = 48.0f;
+    };
+
+    StreamingPolicy();
+    explicit StreamingPolicy(Config config);
+
+    void setView(const StreamingView& view);
+    bool hasView() const noexcept { return hasView_; }
+    const StreamingView& view() const noexcept { return view_; }
+
+    float effectiveDistanceBlocks(const glm::vec2& pointXY) const;
+    float effectiveDistanceToRectBlocks(const glm::vec2& minXY, const glm::vec2& maxXY) const;
+    jobsystem::Priority demoteOutOfView(jobsystem::Priority priority,
+                                        const glm::vec2& minXY,
+                                        const glm::vec2& maxXY) const;
+    // True when rankings under `view` differ enough that queued work should be rescored.
+    bool differsSignificantly(const StreamingView& view) const;
+
+private:
+    float directionScale(const glm::vec2& pointXY) const;
+
+    static void sanitizeConfig(Config& config);
+
+    Config config_;
+    StreamingView view_{};
+    bool hasView_ = false;
+    glm::vec2 forwardXY_{0.0f, 0.0f};
+    float forwardWeight_ = 0.0f;
+    glm::vec2 predictedXY_{0.0f, 0.0f};
+};
@@ -7,14 +7,18 @@
 #include "solum_engine/resources/Coords.h"
 
 struct StreamingMeshUpload {
-    std::vector<MeshletMetadataGPU> metadata;
+    std::vector<MeshletDescriptorGPU> metadata;
     std::vector<uint32_t> quadData;
-    std::vector<MeshletAabbGPU> meshletAabbsGpu;
     std::vector<MeshletAabb> meshletBounds;
+    // Tile-level cull groups over the metadata array; never more entries than meshlets.
+    std::vector<MeshletGroupGPU> meshletGroups;
     uint32_t totalMeshletCount = 0;
+    // Words in quadData: the quads plus each meshlet's material palette.
     uint32_t totalQuadCount = 0;
     uint32_t requiredMeshletCapacity = 0;
     uint32_t requiredQuadCapacity = 0;
     uint64_t meshRevision = 0;
     ColumnCoord centerColumn{0, 0};
+    // World block position the descriptor origins are relative to.
+    glm::ivec3 meshletOriginBase{0, 0, 0};
 };
@@ -7,9 +7,18 @@ class TerrainGenerator {
 private:
     FastNoise::SmartNode<> fnGenerator;
 
+    void generateCoarseColumn(const glm::ivec3& origin, Column& col, uint8_t mipLevel);
+
 public:
     TerrainGenerator() : fnGenerator(FastNoise::New<FastNoise::Perlin>()) {}
 
 
     void generateColumn(const glm::ivec3& origin, Column& col);
+    // minMip > 0 evaluates terrain directly at that mip and leaves finer levels unresident.
+    void generateColumn(const glm::ivec3& origin, Column& col, uint8_t minMip);
+
+    // Noise-free surface height straight from the heightmap, for terrain drawn beyond generated columns.
+    static int sampleHeightmapSurface(int worldX, int worldY);
+    // Material id the generator puts on a surface whose normal has this |z| component.
+    static uint16_t surfaceMaterialIdForFlatness(float flatness);
 };
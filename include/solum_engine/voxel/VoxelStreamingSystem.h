@@ -10,17 +10,33 @@
 #include <mutex>
 #include <optional>
 #include <thread>
+#include <unordered_map>
 
 #include <glm/glm.hpp>
 
 #include "solum_engine/render/RuntimeTiming.h"
 #include "solum_engine/resources/Coords.h"
+#include "solum_engine/voxel/StreamingPolicy.h"
 #include "solum_engine/voxel/StreamingUpload.h"
 
 class MeshManager;
 class World;
 
 class VoxelStreamingSystem {
+public:
+    // Extra interest center (remote player, spectator, offscreen camera) sharing the
+    // primary camera's world and mesh tiles.
+    struct ObserverConfig {
+        // 0 loads the meshed area plus a margin for mesh prefetch.
+        int32_t columnLoadRadius = 0;
+        // 0 or anything larger uses the primary camera's mesh radius.
+        int32_t meshRadiusChunks = 0;
+        // 0 uses the primary camera's SSE target.
+        float lodSseTargetPixels = 0.0f;
+        // Off for observers that only need terrain resident.
+        bool wantsMeshUploads = true;
+    };
+
 private:
     enum class TimingStage : std::size_t {
         MainUpdateWorldStreaming = 0,
@@ -46,11 +62,41 @@ private:
         uint64_t streamSkipUnchanged = 0;
         uint64_t streamSkipThrottle = 0;
         uint64_t streamSnapshotsPrepared = 0;
+        uint64_t streamMeshletsRejected = 0;
+    };
+
+    // Streaming-thread only: smoothed camera velocity for lookahead scheduling.
+    struct ViewVelocityTracker {
+        glm::vec3 velocity{0.0f, 0.0f, 0.0f};
+        glm::vec3 lastPosition{0.0f, 0.0f, 0.0f};
+        std::optional<std::chrono::steady_clock::time_point> lastTime;
+    };
+
+    struct StreamingObserver {
+        ObserverConfig config{};
+        StreamingObserverId worldObserver = kPrimaryStreamingObserver;
+        StreamingObserverId meshObserver = kPrimaryStreamingObserver;
+        int32_t uploadColumnRadius = 1;
+        bool hasPosition = false;
+        glm::vec3 position{0.0f, 0.0f, 0.0f};
+        glm::vec3 forward{0.0f, 0.0f, 0.0f};
+        float sseProjectionScale = 390.0f;
+        std::optional<StreamingMeshUpload> pendingMeshUpload;
+    };
+
+    // Streaming-thread only.
+    struct StreamerObserverState {
+        ViewVelocityTracker view{};
+        uint64_t lastPreparedRevision = 0;
+        ColumnCoord lastPreparedCenter{0, 0};
+        bool hasLastPrepared = false;
+        std::optional<std::chrono::steady_clock::time_point> lastSnapshotTime;
     };
 
     std::unique_ptr<World> world_;
     std::unique_ptr<MeshManager> meshManager_;
     int32_t uploadColumnRadius_ = 1;
+    int32_t maxMeshRadiusChunks_ = 1;
 
     std::thread streamingThread_;
     mutable std::mutex streamingMutex_;
@@ -58,6 +104,7 @@ private:
     bool streamingStopRequested_ = false;
     bool hasLatestStreamingCamera_ = false;
     glm::vec3 latestStreamingCamera_{0.0f, 0.0f, 0.0f};
+    glm::vec3 latestStreamingForward_{0.0f, 0.0f, 0.0f};
     float latestStreamingSseProjectionScale_ = 390.0f;
     std::optional<StreamingMeshUpload> pendingMeshUpload_;
     uint64_t streamerLastPreparedRevision_ = 0;
@@ -65,17 +112,28 @@ private:
     bool streamerHasLastPreparedCenter_ = false;
     std::optional<std::chrono::steady_clock::time_point> streamerLastSnapshotTime_;
     std::atomic<bool> mainUploadInProgress_{false};
+    ViewVelocityTracker streamerPrimaryView_{};
+    // Guarded by streamingMutex_.
+    std::unordered_map<StreamingObserverId, StreamingObserver> observers_;
+    StreamingObserverId nextObserverId_ = kPrimaryStreamingObserver + 1;
+    std::unordered_map<StreamingObserverId, StreamerObserverState> streamerObservers_;
 
     std::array<TimingAccumulator, static_cast<std::size_t>(TimingStage::Count)> timingAccumulators_{};
     std::atomic<uint64_t> streamSkipNoCamera_{0};
     std::atomic<uint64_t> streamSkipUnchanged_{0};
     std::atomic<uint64_t> streamSkipThrottle_{0};
     std::atomic<uint64_t> streamSnapshotsPrepared_{0};
+    std::atomic<uint64_t> streamMeshletsRejected_{0};
     std::mutex timingSnapshotMutex_;
     TimingRawTotals lastTimingRawTotals_{};
     std::optional<std::chrono::steady_clock::time_point> lastTimingSampleTime_;
 
     void streamingThreadMain();
+    void updateExtraObservers();
+    void prepareExtraObserverUploads();
+    static StreamingView updateStreamingView(ViewVelocityTracker& tracker,
+                                             const glm::vec3& cameraPosition,
+                                             const glm::vec3& cameraForward);
     static int32_t cameraColumnChebyshevDistance(const ColumnCoord& a, const ColumnCoord& b);
 
     void recordTimingNs(TimingStage stage, uint64_t ns) noexcept;
@@ -94,10 +152,21 @@ public:
     void stop();
 
     void setMainUploadInProgress(bool inProgress) noexcept;
-    void updateCamera(const glm::vec3& cameraPosition, float sseProjectionScale);
+    void updateCamera(const glm::vec3& cameraPosition, const glm::vec3& cameraForward, float sseProjectionScale);
     std::optional<StreamingMeshUpload> consumePendingMeshUpload();
+
+    std::optional<StreamingObserverId> addObserver(const ObserverConfig& config);
+    void removeObserver(StreamingObserverId id);
+    void updateObserver(StreamingObserverId id,
+                        const glm::vec3& position,
+                        const glm::vec3& forward,
+                        float sseProjectionScale);
+    // Latest snapshot of the observer's own upload window; revision and center are its own.
+    std::optional<StreamingMeshUpload> consumeObserverMeshUpload(StreamingObserverId id);
     void recordMainUpdateDurationNs(uint64_t ns) noexcept;
 
     RuntimeTimingSnapshot getRuntimeTimingSnapshot();
     const World* world() const noexcept;
+    // Radius, in chunks, of the outermost voxel LOD disc.
+    int32_t meshRadiusChunks() const noexcept;
 };
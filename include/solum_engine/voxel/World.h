@@ -1,12 +1,13 @@
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <limits>
-#include <queue>
 #include <shared_mutex>
+#include <span>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -14,20 +15,32 @@
 #include <glm/glm.hpp>
 
 #include "solum_engine/jobsystem/job_system.hpp"
+#include "solum_engine/resources/Constants.h"
 #include "solum_engine/resources/Coords.h"
 #include "solum_engine/voxel/BlockMaterial.h"
 #include "solum_engine/voxel/ChunkMesher.h"
+#include "solum_engine/voxel/ColumnEventRing.h"
+#include "solum_engine/voxel/StreamingPolicy.h"
 
 class Column;
 class Region;
 
 class World;
 
+enum class BlockLookupResult : uint8_t {
+    Resident = 0,
+    // Column is generated but the requested mip was released or never generated;
+    // the returned block is upsampled from the finest resident mip.
+    NotResident,
+    Unknown
+};
+
 class WorldSection : public IBlockSource {
 public:
     struct Sample {
         BlockMaterial block{};
         bool known = false;
+        bool resident = false;
     };
 
     WorldSection(const World& world, const BlockCoord& origin, const glm::ivec3& extent, uint8_t mipLevel = 0);
@@ -49,11 +62,59 @@ private:
     uint8_t mipLevel_ = 0;
 };
 
+struct BlockEdit {
+    BlockCoord coord{};
+    BlockMaterial block{};
+};
+
+struct RaycastQuery {
+    glm::vec3 origin{0.0f, 0.0f, 0.0f};
+    glm::vec3 direction{0.0f, 0.0f, 1.0f};
+    float maxDistance = 0.0f;
+};
+
+struct RaycastHit {
+    bool hit = false;
+    BlockCoord block{};
+    // Face the ray entered through; zero when it starts inside a solid block.
+    glm::ivec3 normal{0, 0, 0};
+    float distance = 0.0f;
+    BlockMaterial material{};
+    // Finest resident mip the hit was resolved at; non-zero inside coarse-only columns.
+    uint8_t mipLevel = 0;
+};
+
+struct ColumnSurfaceInfo {
+    // Highest solid block z per local (x, y), x fastest; -1 for all-air stacks.
+    std::array<int16_t, cfg::CHUNK_SIZE * cfg::CHUNK_SIZE> topSolidZ{};
+    uint32_t emptyChunkMask = 0;
+    // Chunks with every block solid.
+    uint32_t fullChunkMask = 0;
+    // -1 when the column has no solid blocks.
+    int32_t minSolidZ = -1;
+    int32_t maxSolidZ = -1;
+};
+
+struct BlockQueryHit {
+    BlockCoord coord{};
+    BlockMaterial block{};
+};
+
 class World : public IBlockSource {
 public:
     struct Config {
+        // Euclidean column radius of the circular active window.
         int32_t columnLoadRadius = 1;
+        // Entry i is the (Euclidean) column radius inside which mip i must be resident.
+        // Columns beyond every entry are generated directly at the next coarser mip.
+        // Empty generates every column at full resolution.
+        std::vector<int32_t> mipGenerationRadii{};
+        // Extra columns past a mip ring before that mip is released again.
+        int32_t mipReleaseHysteresis = 2;
         std::size_t maxInFlightColumnJobs = 0;
+        // Column events kept for subscribers that fall behind before they must resync.
+        std::size_t columnEventCapacity = 1u << 16;
+        StreamingPolicy::Config streamingPolicy{};
         jobsystem::JobSystem::Config jobConfig{};
     };
 
@@ -66,18 +127,53 @@ public:
     World(World&&) = delete;
     World& operator=(World&&) = delete;
 
+    // Drives kPrimaryStreamingObserver, whose radius is Config::columnLoadRadius.
     void updatePlayerPosition(const glm::vec3& playerWorldPosition);
+    // Re-ranks queued generation work when the view direction or velocity changes.
+    void updateView(const StreamingView& view);
+
+    // Extra interest centers sharing this world. Work is keyed per column, so
+    // overlapping windows generate each column once at the finest mip any of them needs.
+    StreamingObserverId registerObserver(int32_t columnLoadRadius);
+    void removeObserver(StreamingObserverId id);
+    void updateObserver(StreamingObserverId id, const glm::vec3& worldPosition);
+    void updateObserverView(StreamingObserverId id, const StreamingView& view);
+
+    // Applies a batch under one write lock, grouped per chunk so each touched mip voxel is
+    // rebuilt once, and publishes one Edited event per changed column. Edits to columns
+    // without resident mip 0 are dropped. Edited columns keep mip 0 resident from then on, since
+    // regenerating them would lose the edits. Returns the number of voxels that changed.
+    std::size_t applyEdits(std::span<const BlockEdit> edits);
+
+    // Hierarchical DDA: skips empty and ungenerated chunks whole, then the largest empty
+    // mip cell, and only visits single blocks next to geometry. Ungenerated columns read as air.
+    RaycastHit raycast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance) const;
+    // Casts the whole batch under one read lock; outHits must be at least as long as queries.
+    void raycast(std::span<const RaycastQuery> queries, std::span<RaycastHit> outHits) const;
+    // Appends solid blocks in the inclusive box, stopping after maxHits. Pass maxHits = 1
+    // for a plain overlap test. Returns how many hits were appended.
+    std::size_t queryBox(const BlockCoord& minCorner,
+                         const BlockCoord& maxCorner,
+                         std::vector<BlockQueryHit>& outHits,
+                         std::size_t maxHits = std::numeric_limits<std::size_t>::max()) const;
 
     BlockMaterial getBlock(const BlockCoord& coord) const override;
     BlockMaterial getBlock(const BlockCoord& coord, uint8_t mipLevel) const;
     bool tryGetBlock(const BlockCoord& coord, BlockMaterial& outBlock) const;
     bool tryGetBlock(const BlockCoord& coord, BlockMaterial& outBlock, uint8_t mipLevel) const;
+    BlockLookupResult lookupBlock(const BlockCoord& coord, BlockMaterial& outBlock, uint8_t mipLevel) const;
     bool isColumnGenerated(const ColumnCoord& coord) const;
+    // Inclusive column rectangle, checked under a single lock.
+    bool isColumnRangeGenerated(const ColumnCoord& minCorner, const ColumnCoord& maxCorner) const;
     bool tryGetColumnEmptyChunkMask(const ColumnCoord& coord, uint32_t& outMask) const;
+    bool tryGetColumnChunkMasks(const ColumnCoord& coord, uint32_t& outEmptyMask, uint32_t& outFullMask) const;
+    bool tryGetColumnSurface(const ColumnCoord& coord, ColumnSurfaceInfo& outSurface) const;
+    // Highest solid block at (worldX, worldY); false for ungenerated columns. outZ is -1
+    // when the whole stack is air.
+    bool tryGetSurfaceHeight(int32_t worldX, int32_t worldY, int32_t& outZ) const;
     uint64_t generationRevision() const;
-    uint64_t copyGeneratedColumnsSince(uint64_t afterRevision,
-                                       std::vector<ColumnCoord>& outColumns,
-                                       std::size_t maxCount = std::numeric_limits<std::size_t>::max()) const;
+    // Subscribers keep their own cursor; copyGeneratedColumns is the resync path after a lap.
+    const ColumnEventRing& columnEvents() const noexcept { return columnEvents_; }
     void copyGeneratedColumns(std::vector<ColumnCoord>& outColumns) const;
 
     WorldSection createSection(const BlockCoord& origin, const glm::ivec3& extent) const;
@@ -90,12 +186,27 @@ private:
     struct ScheduledColumnJob {
         ColumnCoord coord{};
         jobsystem::Priority priority = jobsystem::Priority::Low;
+        uint8_t minMip = 0;
+    };
+    struct Observer {
+        int32_t columnLoadRadius = 0;
+        ColumnCoord center{0, 0};
+        bool hasCenter = false;
+        StreamingPolicy policy;
     };
     friend class WorldSection;
 
-    void scheduleColumnsAround(const ColumnCoord& centerColumn);
-    void scheduleColumnsDelta(const ColumnCoord& previousCenter, const ColumnCoord& newCenter);
+    void scheduleColumnsAround(const ColumnCoord& centerColumn, int32_t radius);
+    void scheduleColumnsDelta(const ColumnCoord& previousCenter, const ColumnCoord& newCenter, int32_t radius);
+    void releaseColumnsLeavingMipRings(const ColumnCoord& previousCenter, const ColumnCoord& newCenter);
+    void releaseFineMipsInColumnsLocked(const std::vector<ColumnCoord>& coords);
+    void releaseFineMipsLocked(const ColumnCoord& coord, Column& column);
     void enqueueColumnGenerationLocked(const ColumnCoord& coord);
+    void pushQueuedColumnLocked(const ColumnCoord& coord);
+    void popQueuedColumnLocked();
+    void rescoreQueuedColumnsLocked();
+    int32_t queueScoreLocked(const ColumnCoord& coord) const;
+    static int64_t observerScore(const Observer& observer, const ColumnCoord& coord);
     void enqueueColumnGenerationBatch(const std::vector<ColumnCoord>& coords);
     void pruneQueuedColumnsOutsideActiveWindowLocked();
     void collectColumnJobsToScheduleLocked(std::vector<ScheduledColumnJob>& outJobs);
@@ -104,24 +215,32 @@ private:
 
     void onColumnGenerated(const ColumnCoord& coord, Column&& column);
 
-    bool tryGetBlockLocked(const BlockCoord& coord, BlockMaterial& outBlock, uint8_t mipLevel) const;
+    BlockLookupResult tryGetBlockLocked(const BlockCoord& coord, BlockMaterial& outBlock, uint8_t mipLevel) const;
+    RaycastHit raycastLocked(const RaycastQuery& query) const;
     bool isColumnGeneratedLocked(const ColumnCoord& coord) const;
+    bool columnNeedsGenerationLocked(const ColumnCoord& coord) const;
+    uint8_t requiredMipForColumnLocked(const ColumnCoord& coord, int32_t extraRadius = 0) const;
+    uint8_t requiredMipForObserver(const Observer& observer, const ColumnCoord& coord, int32_t extraRadius) const;
+    Column* findColumnLocked(const ColumnCoord& coord);
+    const Column* findGeneratedColumnLocked(const ColumnCoord& coord) const;
     bool isWithinActiveWindowLocked(const ColumnCoord& coord, int32_t extraRadius) const;
+    static bool isWithinObserverWindow(const Observer& observer, const ColumnCoord& coord, int32_t extraRadius);
     Region* getOrCreateRegionLocked(const RegionCoord& coord);
 
-    static jobsystem::Priority priorityFromDistanceSq(int32_t distanceSq);
+    static jobsystem::Priority priorityFromScore(int32_t score);
 
     struct QueuedColumnEntry {
         ColumnCoord coord{};
-        int32_t distanceSq = 0;
+        // Squared effective distance in columns from StreamingPolicy; lower runs first.
+        int32_t score = 0;
         uint64_t centerVersion = 0;
         uint64_t sequence = 0;
     };
 
     struct QueuedColumnEntryCompare {
         bool operator()(const QueuedColumnEntry& a, const QueuedColumnEntry& b) const noexcept {
-            if (a.distanceSq != b.distanceSq) {
-                return a.distanceSq > b.distanceSq;
+            if (a.score != b.score) {
+                return a.score > b.score;
             }
             return a.sequence > b.sequence;
         }
@@ -133,20 +252,19 @@ private:
     mutable std::shared_mutex worldMutex_;
     std::unordered_map<RegionCoord, std::unique_ptr<Region>> regions_;
     std::unordered_set<ColumnCoord> generatedColumns_;
-    std::vector<ColumnCoord> generatedColumnHistory_;
+    std::unordered_map<ColumnCoord, uint8_t> partialColumnMips_;
+    // Columns changed by applyEdits; their fine mips are never released.
+    std::unordered_set<ColumnCoord> editedColumns_;
     std::unordered_set<ColumnCoord> pendingColumnJobs_;
     std::unordered_set<ColumnCoord> queuedColumnJobs_;
-    std::priority_queue<
-        QueuedColumnEntry,
-        std::vector<QueuedColumnEntry>,
-        QueuedColumnEntryCompare
-    > queuedColumnHeap_;
+    // Binary heap under QueuedColumnEntryCompare, kept as a vector so it can be rescored in place.
+    std::vector<QueuedColumnEntry> queuedColumnHeap_;
+    std::unordered_map<StreamingObserverId, Observer> observers_;
+    StreamingObserverId nextObserverId_ = kPrimaryStreamingObserver + 1;
+    ColumnEventRing columnEvents_;
     std::atomic<uint64_t> generationRevision_{0};
     std::atomic<bool> shuttingDown_{false};
     std::size_t maxInFlightColumnJobs_ = 1;
     uint64_t queueSequence_ = 0;
     uint64_t queueCenterVersion_ = 0;
-
-    ColumnCoord lastScheduledCenter_{0, 0};
-    bool hasLastScheduledCenter_ = false;
 };
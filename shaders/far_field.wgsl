@@ -0,0 +1,134 @@
+// #include "uniforms.wgsl"
+
+struct FarFieldTile {
+    originX: i32,
+    originY: i32,
+    spacing: u32,
+    active: u32,
+    minZ: f32,
+    maxZ: f32,
+    pad0: u32,
+    pad1: u32,
+};
+
+struct FarFieldParams {
+    tileSlotCount: u32,
+    seamRadius: f32,
+    outerRadius: f32,
+    sinkDepth: f32,
+};
+
+@group(0) @binding(0) var<uniform> frameUniforms: FrameUniforms;
+@group(0) @binding(1) var<storage, read> tiles: array<FarFieldTile>;
+@group(0) @binding(2) var<storage, read> tileSamples: array<u32>;
+@group(0) @binding(3) var<storage, read> visibleTileSlots: array<u32>;
+@group(0) @binding(4) var<uniform> params: FarFieldParams;
+@group(0) @binding(5) var<storage, read> materialToTexture: array<u32, 65536>;
+@group(0) @binding(6) var materialTextures: texture_2d_array<f32>;
+@group(0) @binding(7) var materialSampler: sampler;
+
+const kTileCells: u32 = 32u;
+const kTileSamplesPerAxis: u32 = 33u;
+const kGridVertexCount: u32 = kTileCells * kTileCells * 6u;
+const kSkirtDepthInSpacings: f32 = 2.0;
+// Matches the voxel pass clear color so the horizon fades into the background.
+const kHorizonColor: vec3f = vec3f(0.2, 0.2, 0.3);
+const kHorizonFadeStart: f32 = 0.75;
+
+struct VertexInput {
+    @builtin(instance_index) instance_idx: u32,
+    @builtin(vertex_index) vertex_idx: u32,
+};
+
+struct VertexOutput {
+    @builtin(position) position: vec4f,
+    @location(0) worldPosition: vec3f,
+    @location(1) @interpolate(flat) materialId: u32,
+};
+
+// Two triangles per cell: [0,1,2] and [0,2,3] over corners (0,0) (1,0) (1,1) (0,1).
+fn cell_corner(triangleVertex: u32) -> vec2u {
+    switch triangleVertex {
+        case 0u: { return vec2u(0u, 0u); }
+        case 1u: { return vec2u(1u, 0u); }
+        case 2u: { return vec2u(1u, 1u); }
+        case 3u: { return vec2u(0u, 0u); }
+        case 4u: { return vec2u(1u, 1u); }
+        default: { return vec2u(0u, 1u); }
+    }
+}
+
+@vertex
+fn vs_main(in: VertexInput) -> VertexOutput {
+    var out: VertexOutput;
+
+    let slot = visibleTileSlots[in.instance_idx];
+    let tile = tiles[slot];
+    let triangleVertex = in.vertex_idx % 6u;
+    let corner = cell_corner(triangleVertex);
+
+    var samplePosition = vec2u(0u, 0u);
+    var drop = 0.0;
+    if (in.vertex_idx < kGridVertexCount) {
+        let cell = in.vertex_idx / 6u;
+        samplePosition = vec2u(cell % kTileCells, cell / kTileCells) + corner;
+    } else {
+        // Skirts hang from each tile edge to hide cracks against neighbours of another LOD.
+        let skirtVertex = in.vertex_idx - kGridVertexCount;
+        let edge = skirtVertex / (kTileCells * 6u);
+        let along = ((skirtVertex / 6u) % kTileCells) + corner.x;
+        switch edge {
+            case 0u: { samplePosition = vec2u(along, 0u); }
+            case 1u: { samplePosition = vec2u(along, kTileCells); }
+            case 2u: { samplePosition = vec2u(0u, along); }
+            default: { samplePosition = vec2u(kTileCells, along); }
+        }
+        drop = f32(corner.y) * f32(tile.spacing) * kSkirtDepthInSpacings;
+    }
+
+    let sampleIndex = slot * kTileSamplesPerAxis * kTileSamplesPerAxis +
+        samplePosition.y * kTileSamplesPerAxis + samplePosition.x;
+    let sampleWord = tileSamples[sampleIndex];
+    let height = f32(sampleWord & 0xffffu);
+
+    let spacing = f32(tile.spacing);
+    let worldPosition = vec3f(
+        f32(tile.originX) + f32(samplePosition.x) * spacing,
+        f32(tile.originY) + f32(samplePosition.y) * spacing,
+        height + 1.0 - params.sinkDepth - drop
+    );
+
+    let worldSpacePosition = frameUniforms.modelMatrix * vec4f(worldPosition, 1.0);
+    out.position = frameUniforms.projectionMatrix * frameUniforms.viewMatrix * worldSpacePosition;
+    out.worldPosition = worldSpacePosition.xyz;
+    out.materialId = (sampleWord >> 16u) & 0xffffu;
+    return out;
+}
+
+@fragment
+fn fs_main(in: VertexOutput) -> @location(0) vec4f {
+    let dx = dpdx(in.worldPosition);
+    let dy = dpdy(in.worldPosition);
+    let normal = normalize(cross(dx, dy));
+
+    let lightDir = normalize(vec3f(1.0, 0.5, 1.0));
+    let ndotl = abs(dot(normal, lightDir));
+    let ambient = 0.3;
+    let shade = ambient + (1.0 - ambient) * ndotl;
+
+    let textureLayer = materialToTexture[min(in.materialId, 65535u)];
+    let baseColor = textureSample(materialTextures, materialSampler, in.worldPosition.xy, i32(textureLayer)).rgb;
+
+    // Voxel meshes own everything inside the seam; the overlap band beyond it is settled by depth.
+    let cameraXY = frameUniforms.inverseViewMatrix[3].xy;
+    let horizontalDistance = length(in.worldPosition.xy - cameraXY);
+    if (horizontalDistance < params.seamRadius) {
+        discard;
+    }
+    if (horizontalDistance > params.outerRadius) {
+        discard;
+    }
+
+    let fade = smoothstep(params.outerRadius * kHorizonFadeStart, params.outerRadius, horizontalDistance);
+    return vec4f(mix(baseColor * shade, kHorizonColor, fade), 1.0);
+}
@@ -0,0 +1,121 @@
+// #include "uniforms.wgsl"
+
+struct FarFieldTile {
+    originX: i32,
+    originY: i32,
+    spacing: u32,
+    active: u32,
+    minZ: f32,
+    maxZ: f32,
+    pad0: u32,
+    pad1: u32,
+};
+
+struct FarFieldParams {
+    tileSlotCount: u32,
+    seamRadius: f32,
+    outerRadius: f32,
+    sinkDepth: f32,
+};
+
+@group(0) @binding(0) var<uniform> frameUniforms: FrameUniforms;
+@group(0) @binding(1) var<storage, read> tiles: array<FarFieldTile>;
+@group(0) @binding(2) var<storage, read_write> visibleTileSlots: array<u32>;
+@group(0) @binding(3) var<storage, read_write> drawArgsWords: array<atomic<u32>, 4>;
+@group(0) @binding(4) var<uniform> params: FarFieldParams;
+
+const kTileCells: f32 = 32.0;
+const kSkirtDepthInSpacings: f32 = 2.0;
+const kCullEpsilon: f32 = 0.0001;
+var<workgroup> clipFromWorldWg: mat4x4f;
+
+fn corner_position(minCorner: vec3f, maxCorner: vec3f, index: u32) -> vec3f {
+    switch index {
+        case 0u: { return vec3f(minCorner.x, minCorner.y, minCorner.z); }
+        case 1u: { return vec3f(maxCorner.x, minCorner.y, minCorner.z); }
+        case 2u: { return vec3f(maxCorner.x, maxCorner.y, minCorner.z); }
+        case 3u: { return vec3f(minCorner.x, maxCorner.y, minCorner.z); }
+        case 4u: { return vec3f(minCorner.x, minCorner.y, maxCorner.z); }
+        case 5u: { return vec3f(maxCorner.x, minCorner.y, maxCorner.z); }
+        case 6u: { return vec3f(maxCorner.x, maxCorner.y, maxCorner.z); }
+        default: { return vec3f(minCorner.x, maxCorner.y, maxCorner.z); }
+    }
+}
+
+fn is_in_frustum(minCorner: vec3f, maxCorner: vec3f, clipFromWorld: mat4x4f) -> bool {
+    var allOutsideLeft = true;
+    var allOutsideRight = true;
+    var allOutsideBottom = true;
+    var allOutsideTop = true;
+    var allOutsideNear = true;
+    var allOutsideFar = true;
+
+    for (var cornerIndex: u32 = 0u; cornerIndex < 8u; cornerIndex = cornerIndex + 1u) {
+        let corner = corner_position(minCorner, maxCorner, cornerIndex);
+        let clip = clipFromWorld * vec4f(corner, 1.0);
+
+        allOutsideLeft = allOutsideLeft && ((clip.x + clip.w) < -kCullEpsilon);
+        allOutsideRight = allOutsideRight && ((clip.w - clip.x) < -kCullEpsilon);
+        allOutsideBottom = allOutsideBottom && ((clip.y + clip.w) < -kCullEpsilon);
+        allOutsideTop = allOutsideTop && ((clip.w - clip.y) < -kCullEpsilon);
+        allOutsideNear = allOutsideNear && (clip.z < -kCullEpsilon);
+        allOutsideFar = allOutsideFar && ((clip.w - clip.z) < -kCullEpsilon);
+    }
+
+    return !(allOutsideLeft ||
+             allOutsideRight ||
+             allOutsideBottom ||
+             allOutsideTop ||
+             allOutsideNear ||
+             allOutsideFar);
+}
+
+// Tiles the fragment stage would discard entirely: inside the voxel seam disc or past the horizon.
+fn is_outside_band(minXY: vec2f, maxXY: vec2f, cameraXY: vec2f) -> bool {
+    let farthest = max(abs(minXY - cameraXY), abs(maxXY - cameraXY));
+    if (length(farthest) < params.seamRadius) {
+        return true;
+    }
+
+    let nearest = clamp(cameraXY, minXY, maxXY);
+    return distance(nearest, cameraXY) > params.outerRadius;
+}
+
+@compute @workgroup_size(64, 1, 1)
+fn cs_main(
+    @builtin(global_invocation_id) gid: vec3u,
+    @builtin(local_invocation_index) localIndex: u32
+) {
+    if (localIndex == 0u) {
+        clipFromWorldWg = frameUniforms.projectionMatrix * frameUniforms.viewMatrix * frameUniforms.modelMatrix;
+    }
+    workgroupBarrier();
+
+    let slot = gid.x;
+    if (slot >= params.tileSlotCount) {
+        return;
+    }
+
+    let tile = tiles[slot];
+    if (tile.active == 0u) {
+        return;
+    }
+
+    let spacing = f32(tile.spacing);
+    let minXY = vec2f(f32(tile.originX), f32(tile.originY));
+    let maxXY = minXY + vec2f(spacing * kTileCells);
+    let cameraXY = frameUniforms.inverseViewMatrix[3].xy;
+    if (is_outside_band(minXY, maxXY, cameraXY)) {
+        return;
+    }
+
+    // Matches the vertex stage: surface sits one block above the sampled height, lowered by the sink.
+    let minZ = tile.minZ + 1.0 - params.sinkDepth - spacing * kSkirtDepthInSpacings;
+    let maxZ = tile.maxZ + 1.0 - params.sinkDepth;
+    if (!is_in_frustum(vec3f(minXY, minZ), vec3f(maxXY, maxZ), clipFromWorldWg)) {
+        return;
+    }
+
+    let visibleIndex = atomicAdd(&drawArgsWords[1], 1u);
+    visibleTileSlots[visibleIndex] = slot;
+}
@@ -0,0 +1,163 @@
+// Bounds tests shared by the meshlet and meshlet-group cull shaders. Includers declare
+// frameUniforms, cullParams, hizPyramid and hizParams (see meshlet_hiz.wgsl).
+
+struct MeshletAabb {
+    minCorner: vec4f,
+    maxCorner: vec4f,
+};
+
+struct CullParams {
+    meshletCount: u32,
+    hizMipCount: u32,
+    groupCount: u32,
+    pad0: u32,
+};
+
+const kCullEpsilon: f32 = 0.0001;
+// Must match MESHLET_CULL_WORKGROUP_SIZE in MeshletTypes.h.
+const kMeshletCullWorkgroupSize: u32 = 128u;
+
+fn corner_position(minCorner: vec3f, maxCorner: vec3f, index: u32) -> vec3f {
+    switch index {
+        case 0u: { return vec3f(minCorner.x, minCorner.y, minCorner.z); }
+        case 1u: { return vec3f(maxCorner.x, minCorner.y, minCorner.z); }
+        case 2u: { return vec3f(maxCorner.x, maxCorner.y, minCorner.z); }
+        case 3u: { return vec3f(minCorner.x, maxCorner.y, minCorner.z); }
+        case 4u: { return vec3f(minCorner.x, minCorner.y, maxCorner.z); }
+        case 5u: { return vec3f(maxCorner.x, minCorner.y, maxCorner.z); }
+        case 6u: { return vec3f(maxCorner.x, maxCorner.y, maxCorner.z); }
+        default: { return vec3f(minCorner.x, maxCorner.y, maxCorner.z); }
+    }
+}
+
+fn is_visible(aabb: MeshletAabb, clipFromLocal: mat4x4f) -> bool {
+    let minCorner = aabb.minCorner.xyz;
+    let maxCorner = aabb.maxCorner.xyz;
+
+    var allOutsideLeft = true;
+    var allOutsideRight = true;
+    var allOutsideBottom = true;
+    var allOutsideTop = true;
+    var allOutsideNear = true;
+    var allOutsideFar = true;
+
+    for (var cornerIndex: u32 = 0u; cornerIndex < 8u; cornerIndex = cornerIndex + 1u) {
+        let corner = corner_position(minCorner, maxCorner, cornerIndex);
+        let clip = clipFromLocal * vec4f(corner, 1.0);
+
+        allOutsideLeft = allOutsideLeft && ((clip.x + clip.w) < -kCullEpsilon);
+        allOutsideRight = allOutsideRight && ((clip.w - clip.x) < -kCullEpsilon);
+        allOutsideBottom = allOutsideBottom && ((clip.y + clip.w) < -kCullEpsilon);
+        allOutsideTop = allOutsideTop && ((clip.w - clip.y) < -kCullEpsilon);
+        allOutsideNear = allOutsideNear && (clip.z < -kCullEpsilon);
+        allOutsideFar = allOutsideFar && ((clip.w - clip.z) < -kCullEpsilon);
+
+        if (!allOutsideLeft &&
+            !allOutsideRight &&
+            !allOutsideBottom &&
+            !allOutsideTop &&
+            !allOutsideNear &&
+            !allOutsideFar) {
+            return true;
+        }
+    }
+
+    return !(allOutsideLeft ||
+             allOutsideRight ||
+             allOutsideBottom ||
+             allOutsideTop ||
+             allOutsideNear ||
+             allOutsideFar);
+}
+
+// Mip texel covering uv: the mip 0 texel shifted down by the level, as the pyramid was built.
+fn uv_to_hiz_texel(uv: vec2f, level: u32) -> vec2u {
+    let base = hizParams.mips[0];
+    let maxBase = vec2f(f32(base.width - 1u), f32(base.height - 1u));
+    let baseTexel = vec2u(clamp(uv * vec2f(f32(base.width), f32(base.height)), vec2f(0.0), maxBase));
+    let mip = hizParams.mips[level];
+    return min(baseTexel >> vec2u(level), vec2u(mip.width, mip.height) - vec2u(1u));
+}
+
+fn load_hiz(level: u32, texel: vec2u) -> f32 {
+    let mip = hizParams.mips[level];
+    return hizPyramid[mip.offset + texel.y * mip.width + texel.x];
+}
+
+fn is_occluded(aabb: MeshletAabb, clipFromLocal: mat4x4f) -> bool {
+    if (frameUniforms.occlusionParams.x < 0.5) {
+        return false;
+    }
+
+    let dims = vec2u(hizParams.mips[0].width, hizParams.mips[0].height);
+    if (dims.x == 0u || dims.y == 0u) {
+        return false;
+    }
+
+    let minCorner = aabb.minCorner.xyz;
+    let maxCorner = aabb.maxCorner.xyz;
+    let cameraPosition = frameUniforms.inverseViewMatrix[3].xyz;
+    let nearSkipDistance = max(frameUniforms.occlusionParams.z, 0.0);
+    let nearSkipDistanceSq = nearSkipDistance * nearSkipDistance;
+    let closestPoint = clamp(cameraPosition, minCorner, maxCorner);
+    let toCamera = closestPoint - cameraPosition;
+    if (dot(toCamera, toCamera) <= nearSkipDistanceSq) {
+        return false;
+    }
+
+    var minUv = vec2f(1.0, 1.0);
+    var maxUv = vec2f(0.0, 0.0);
+    var nearestDepth = 1.0;
+    var hasProjectedCorner = false;
+
+    for (var cornerIndex: u32 = 0u; cornerIndex < 8u; cornerIndex = cornerIndex + 1u) {
+        let corner = corner_position(minCorner, maxCorner, cornerIndex);
+        let clip = clipFromLocal * vec4f(corner, 1.0);
+        if (clip.w <= kCullEpsilon) {
+            continue;
+        }
+
+        let ndc = clip.xyz / clip.w;
+        // NDC Y is up, depth texture coordinates are top-left origin.
+        let uv = vec2f(ndc.x * 0.5 + 0.5, (-ndc.y) * 0.5 + 0.5);
+        minUv = min(minUv, uv);
+        maxUv = max(maxUv, uv);
+        // Keep this conservative across both ZO and NO projection conventions.
+        let depthZo = ndc.z;
+        let depthNo = ndc.z * 0.5 + 0.5;
+        nearestDepth = min(nearestDepth, clamp(min(depthZo, depthNo), 0.0, 1.0));
+        hasProjectedCorner = true;
+    }
+
+    if (!hasProjectedCorner) {
+        return false;
+    }
+
+    let uvMin = clamp(minUv, vec2f(0.0, 0.0), vec2f(1.0, 1.0));
+    let uvMax = clamp(maxUv, vec2f(0.0, 0.0), vec2f(1.0, 1.0));
+    let uvSpanPx = (uvMax - uvMin) * vec2f(f32(dims.x), f32(dims.y));
+    let minSpanPx = max(frameUniforms.occlusionParams.w, 0.0);
+
+    // Tiny projected boxes are prone to false occlusion in low-res depth.
+    if (uvSpanPx.x <= minSpanPx || uvSpanPx.y <= minSpanPx) {
+        return false;
+    }
+
+    let maxSpanPx = max(uvSpanPx.x, uvSpanPx.y);
+    let mipCount = max(cullParams.hizMipCount, 1u);
+    let desiredMip = i32(ceil(log2(max(maxSpanPx, 1.0))));
+    let mip = u32(clamp(desiredMip, 0, i32(mipCount) - 1));
+    let minTexel = uv_to_hiz_texel(uvMin, mip);
+    let maxTexel = uv_to_hiz_texel(uvMax, mip);
+
+    var hizMaxDepth = 0.0;
+    for (var y = minTexel.y; y <= maxTexel.y; y = y + 1u) {
+        for (var x = minTexel.x; x <= maxTexel.x; x = x + 1u) {
+            hizMaxDepth = max(hizMaxDepth, load_hiz(mip, vec2u(x, y)));
+        }
+    }
+
+    let depthBias = max(frameUniforms.occlusionParams.y, 0.0);
+    let maybeVisible = nearestDepth <= (hizMaxDepth + depthBias);
+    return !maybeVisible;
+}
@@ -1,3 +1,5 @@
+// #include "meshlet_descriptor.wgsl"
+
 struct FrameUniforms {
     projectionMatrix: mat4x4f,
     viewMatrix: mat4x4f,
@@ -6,22 +8,19 @@ struct FrameUniforms {
     inverseViewMatrix: mat4x4f,
     renderFlags: vec4u,
     occlusionParams: vec4f,
-};
-
-struct MeshletMetadata {
-    originX: i32,
-    originY: i32,
-    originZ: i32,
-    quadCount: u32,
-    faceDirection: u32,
-    dataOffset: u32,
-    voxelScale: u32,
-    pad1: u32,
+    meshletOriginBase: vec4i,
 };
 
 @group(0) @binding(0) var<uniform> frameUniforms: FrameUniforms;
 @group(0) @binding(1) var<storage, read> meshletDataWords: array<u32>;
-@group(0) @binding(2) var<storage, read> meshletMetadata: array<MeshletMetadata>;
+@group(0) @binding(2) var<storage, read> meshletMetadata: array<MeshletDescriptor>;
+@group(0) @binding(3) var<storage, read> drawChunks: array<u32>;
+
+// Must match MESHLET_DRAW_CHUNK_* in MeshletTypes.h.
+const kDrawChunkQuads: u32 = 4u;
+const kDrawChunkIndexBits: u32 = 5u;
+// Must match MESHLET_QUAD_* in MeshletTypes.h.
+const kQuadAoShift: u32 = 15u;
 
 struct VertexInput {
     @builtin(instance_index) instance_idx: u32,
@@ -37,7 +36,7 @@ fn fetch_quad_data(quadOffset: u32) -> u32 {
 }
 
 fn decode_local_offset(packed: u32) -> vec3u {
-    let offset = packed & 0xffffu;
+    let offset = packed & ((1u << kQuadAoShift) - 1u);
     return vec3u(
         offset & 0x1fu,
         (offset >> 5u) & 0x1fu,
@@ -45,29 +44,26 @@ fn decode_local_offset(packed: u32) -> vec3u {
     );
 }
 
+fn decode_ao_data(packed: u32) -> u32 {
+    return (packed >> kQuadAoShift) & 0x1ffu;
+}
+
 fn decode_flip(packedAoData: u32) -> bool {
     return ((packedAoData >> 8u) & 0x1u) != 0u;
 }
 
-fn corner_from_triangle_vertex(triangleVertex: u32, flipped: bool) -> u32 {
+// The shared index pattern splits quads along the 1-2 diagonal: [0,1,2] and [2,1,3]. Flipped quads
+// permute their corners so the same pattern yields [0,1,3] and [0,3,2] with unchanged winding.
+fn corner_from_quad_vertex(quadVertex: u32, flipped: bool) -> u32 {
     if (!flipped) {
-        switch triangleVertex {
-            case 0u: { return 0u; }
-            case 1u: { return 1u; }
-            case 2u: { return 2u; }
-            case 3u: { return 2u; }
-            case 4u: { return 1u; }
-            default: { return 3u; }
-        }
+        return quadVertex;
     }
 
-    switch triangleVertex {
-        case 0u: { return 0u; }
-        case 1u: { return 1u; }
+    switch quadVertex {
+        case 0u: { return 2u; }
+        case 1u: { return 0u; }
         case 2u: { return 3u; }
-        case 3u: { return 0u; }
-        case 4u: { return 3u; }
-        default: { return 2u; }
+        default: { return 1u; }
     }
 }
 
@@ -128,24 +124,24 @@ fn face_corner_offset(face: u32, corner: u32) -> vec3f {
 fn vs_main(in: VertexInput) -> VertexOutput {
     var out: VertexOutput;
 
-    let meshlet = meshletMetadata[in.instance_idx];
-    let quadIdx = in.vertex_idx / 6u;
-    let triangleVertex = in.vertex_idx % 6u;
+    let drawChunk = drawChunks[in.instance_idx];
+    let meshlet = decode_meshlet(meshletMetadata[drawChunk >> kDrawChunkIndexBits]);
+    let quadIdx = (drawChunk & ((1u << kDrawChunkIndexBits) - 1u)) * kDrawChunkQuads + in.vertex_idx / 4u;
+    let quadVertex = in.vertex_idx % 4u;
 
     if (quadIdx >= meshlet.quadCount) {
         out.position = vec4f(2.0, 2.0, 2.0, 1.0);
         return out;
     }
 
-    let quadDataOffset = meshlet.dataOffset + (quadIdx * 2u);
-    let quadData = fetch_quad_data(quadDataOffset);
-    let quadAoData = fetch_quad_data(quadDataOffset + 1u);
+    let quadData = fetch_quad_data(meshlet.dataOffset + quadIdx);
+    let quadAoData = decode_ao_data(quadData);
     let blockLocal = decode_local_offset(quadData);
-    let corner = corner_from_triangle_vertex(triangleVertex, decode_flip(quadAoData));
+    let corner = corner_from_quad_vertex(quadVertex, decode_flip(quadAoData));
     let cornerOffset = face_corner_offset(meshlet.faceDirection, corner);
-    let voxelScale = f32(max(meshlet.voxelScale, 1u));
+    let voxelScale = f32(meshlet.voxelScale);
 
-    let meshletOrigin = vec3f(f32(meshlet.originX), f32(meshlet.originY), f32(meshlet.originZ));
+    let meshletOrigin = vec3f(meshlet.origin);
     let worldPosition =
         meshletOrigin +
         (vec3f(f32(blockLocal.x), f32(blockLocal.y), f32(blockLocal.z)) + cornerOffset) * voxelScale;
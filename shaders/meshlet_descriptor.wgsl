@@ -0,0 +1,95 @@
+// Decoding of the packed per-meshlet descriptor. Includers declare frameUniforms, whose
+// meshletOriginBase the descriptor origins are relative to.
+
+// Mirrors MeshletDescriptorGPU in MeshletTypes.h.
+struct MeshletDescriptor {
+    originXYScale: u32,
+    originZFaceQuads: u32,
+    dataOffset: u32,
+    bounds: u32,
+};
+
+struct Meshlet {
+    origin: vec3i,
+    faceDirection: u32,
+    quadCount: u32,
+    voxelScale: u32,
+    dataOffset: u32,
+    ordinal: u32,
+    boundsMin: vec3f,
+    boundsMax: vec3f,
+};
+
+// Must match MESHLET_DESCRIPTOR_* in MeshletTypes.h.
+const kDescriptorOriginXYBits: u32 = 14u;
+const kDescriptorOriginZBits: u32 = 10u;
+const kDescriptorFaceBits: u32 = 3u;
+const kDescriptorQuadCountBits: u32 = 7u;
+const kDescriptorBoundsBits: u32 = 5u;
+
+fn descriptor_bits(value: u32, shift: u32, count: u32) -> u32 {
+    return (value >> shift) & ((1u << count) - 1u);
+}
+
+fn descriptor_quad_count(descriptor: MeshletDescriptor) -> u32 {
+    return descriptor_bits(
+        descriptor.originZFaceQuads,
+        kDescriptorOriginZBits + kDescriptorFaceBits,
+        kDescriptorQuadCountBits
+    ) + 1u;
+}
+
+// Mirrors decodeMeshletDescriptor and meshletDescriptorAabb in MeshletTypes.h.
+fn decode_meshlet(descriptor: MeshletDescriptor) -> Meshlet {
+    var meshlet: Meshlet;
+    let xyBias = i32(1u << (kDescriptorOriginXYBits - 1u));
+    let zBias = i32(1u << (kDescriptorOriginZBits - 1u));
+    meshlet.origin = frameUniforms.meshletOriginBase.xyz + vec3i(
+        i32(descriptor_bits(descriptor.originXYScale, 0u, kDescriptorOriginXYBits)) - xyBias,
+        i32(descriptor_bits(descriptor.originXYScale, kDescriptorOriginXYBits, kDescriptorOriginXYBits)) - xyBias,
+        i32(descriptor_bits(descriptor.originZFaceQuads, 0u, kDescriptorOriginZBits)) - zBias
+    );
+    meshlet.voxelScale = 1u << (descriptor.originXYScale >> (2u * kDescriptorOriginXYBits));
+    meshlet.faceDirection = descriptor_bits(descriptor.originZFaceQuads, kDescriptorOriginZBits, kDescriptorFaceBits);
+    meshlet.quadCount = descriptor_quad_count(descriptor);
+    meshlet.ordinal = descriptor.originZFaceQuads >>
+        (kDescriptorOriginZBits + kDescriptorFaceBits + kDescriptorQuadCountBits);
+    meshlet.dataOffset = descriptor.dataOffset;
+
+    let localMin = vec3f(
+        f32(descriptor_bits(descriptor.bounds, 0u, kDescriptorBoundsBits)),
+        f32(descriptor_bits(descriptor.bounds, kDescriptorBoundsBits, kDescriptorBoundsBits)),
+        f32(descriptor_bits(descriptor.bounds, 2u * kDescriptorBoundsBits, kDescriptorBoundsBits))
+    );
+    let localMax = vec3f(
+        f32(descriptor_bits(descriptor.bounds, 3u * kDescriptorBoundsBits, kDescriptorBoundsBits)),
+        f32(descriptor_bits(descriptor.bounds, 4u * kDescriptorBoundsBits, kDescriptorBoundsBits)),
+        f32(descriptor_bits(descriptor.bounds, 5u * kDescriptorBoundsBits, kDescriptorBoundsBits))
+    );
+    let origin = vec3f(meshlet.origin);
+    let scale = f32(meshlet.voxelScale);
+    meshlet.boundsMin = origin + localMin * scale;
+    meshlet.boundsMax = origin + (localMax + vec3f(1.0)) * scale;
+    // Quads lie on the face plane of their voxel, so the box collapses onto those planes.
+    let axis = meshlet.faceDirection / 2u;
+    if (meshlet.faceDirection <= 5u) {
+        if ((meshlet.faceDirection % 2u) == 0u) {
+            meshlet.boundsMin[axis] = meshlet.boundsMin[axis] + scale;
+        } else {
+            meshlet.boundsMax[axis] = meshlet.boundsMax[axis] - scale;
+        }
+    }
+    return meshlet;
+}
+
+// Mirrors meshletVisibilityKey in MeshletTypes.h.
+fn meshlet_visibility_key(meshlet: Meshlet) -> u32 {
+    var h = bitcast<u32>(meshlet.origin.x) * 73856093u;
+    h = h ^ (bitcast<u32>(meshlet.origin.y) * 19349663u);
+    h = h ^ (bitcast<u32>(meshlet.origin.z) * 83492791u);
+    h = h ^ ((meshlet.faceDirection | (meshlet.voxelScale << 3u) | (meshlet.ordinal << 12u)) * 2654435761u);
+    h = h ^ (h >> 16u);
+    h = h * 0x7feb352du;
+    h = h ^ (h >> 15u);
+    return h;
+}
@@ -0,0 +1,108 @@
+// #include "uniforms.wgsl"
+// #include "meshlet_hiz.wgsl"
+// #include "meshlet_cull_common.wgsl"
+// #include "meshlet_descriptor.wgsl"
+
+// Mirrors MeshletGroupGPU in MeshletTypes.h.
+struct MeshletGroup {
+    minCorner: vec4f,
+    maxCorner: vec4f,
+    firstMeshlet: u32,
+    meshletCount: u32,
+    pad0: u32,
+    pad1: u32,
+};
+
+// header[0..2] are the dispatchWorkgroupsIndirect args of the meshlet pass, header[3] the count.
+struct CandidateMeshlets {
+    header: array<atomic<u32>, 4>,
+    meshlets: array<u32>,
+};
+
+@group(0) @binding(0) var<uniform> frameUniforms: FrameUniforms;
+@group(0) @binding(1) var<storage, read> meshletGroups: array<MeshletGroup>;
+@group(0) @binding(2) var<storage, read_write> candidates: CandidateMeshlets;
+@group(0) @binding(3) var<uniform> cullParams: CullParams;
+@group(0) @binding(4) var<storage, read> hizPyramid: array<f32>;
+@group(0) @binding(5) var<storage, read> meshletMetadata: array<MeshletDescriptor>;
+@group(0) @binding(6) var<storage, read_write> visibilityBits: array<atomic<u32>>;
+@group(0) @binding(7) var<uniform> hizParams: HiZParams;
+
+// Must match MESHLET_VISIBILITY_TABLE_BITS in MeshletTypes.h.
+const kVisibilityTableBits: u32 = 4194304u;
+var<workgroup> clipFromLocalWg: mat4x4f;
+
+fn group_aabb(group: MeshletGroup) -> MeshletAabb {
+    return MeshletAabb(group.minCorner, group.maxCorner);
+}
+
+fn append_candidates(group: MeshletGroup) {
+    let first = atomicAdd(&candidates.header[3], group.meshletCount);
+    for (var i: u32 = 0u; i < group.meshletCount; i = i + 1u) {
+        candidates.meshlets[first + i] = group.firstMeshlet + i;
+    }
+    let candidateEnd = first + group.meshletCount;
+    atomicMax(&candidates.header[0], (candidateEnd + kMeshletCullWorkgroupSize - 1u) / kMeshletCullWorkgroupSize);
+}
+
+// The meshlet pass never sees an occluded group, so its history bits are cleared here instead.
+fn forget_visibility(group: MeshletGroup) {
+    for (var i: u32 = 0u; i < group.meshletCount; i = i + 1u) {
+        let meshlet = decode_meshlet(meshletMetadata[group.firstMeshlet + i]);
+        let slot = meshlet_visibility_key(meshlet) & (kVisibilityTableBits - 1u);
+        let bit = 1u << (slot & 31u);
+        if ((atomicLoad(&visibilityBits[slot >> 5u]) & bit) != 0u) {
+            atomicAnd(&visibilityBits[slot >> 5u], ~bit);
+        }
+    }
+}
+
+// Phase one only needs the frustum; history bits decide which candidates become occluders.
+@compute @workgroup_size(64, 1, 1)
+fn cs_select_history(
+    @builtin(global_invocation_id) gid: vec3u,
+    @builtin(local_invocation_index) localIndex: u32
+) {
+    if (localIndex == 0u) {
+        clipFromLocalWg = frameUniforms.projectionMatrix * frameUniforms.viewMatrix * frameUniforms.modelMatrix;
+    }
+    workgroupBarrier();
+
+    if (gid.x >= cullParams.groupCount) {
+        return;
+    }
+
+    let group = meshletGroups[gid.x];
+    if (is_visible(group_aabb(group), clipFromLocalWg)) {
+        append_candidates(group);
+    }
+}
+
+// Phase two: one frustum and Hi-Z test per tile LOD cell decides whether its meshlets are culled
+// individually at all.
+@compute @workgroup_size(64, 1, 1)
+fn cs_main(
+    @builtin(global_invocation_id) gid: vec3u,
+    @builtin(local_invocation_index) localIndex: u32
+) {
+    if (localIndex == 0u) {
+        clipFromLocalWg = frameUniforms.projectionMatrix * frameUniforms.viewMatrix * frameUniforms.modelMatrix;
+    }
+    workgroupBarrier();
+
+    if (gid.x >= cullParams.groupCount) {
+        return;
+    }
+
+    let group = meshletGroups[gid.x];
+    let aabb = group_aabb(group);
+    // Off-screen groups keep their history bits; phase one frustum-tests them before reading those.
+    if (!is_visible(aabb, clipFromLocalWg)) {
+        return;
+    }
+    if (is_occluded(aabb, clipFromLocalWg)) {
+        forget_visibility(group);
+        return;
+    }
+    append_candidates(group);
+}
@@ -0,0 +1,21 @@
+// Layout of the Hi-Z pyramid buffer built by meshlet_hiz_spd.wgsl and read by the cull shaders.
+// Mip sizes round up, so the last texel of an odd-sized level still has a parent.
+
+// Must match kMaxHiZMips in MeshletOcclusionPipeline.h.
+const kMaxHiZMips: u32 = 13u;
+
+struct HiZMip {
+    // In 32-bit words from the start of the pyramid buffer; rows are tightly packed.
+    offset: u32,
+    width: u32,
+    height: u32,
+    pad0: u32,
+};
+
+struct HiZParams {
+    mipCount: u32,
+    workgroupCount: u32,
+    pad0: u32,
+    pad1: u32,
+    mips: array<HiZMip, kMaxHiZMips>,
+};
@@ -0,0 +1,127 @@
+// #include "meshlet_hiz.wgsl"
+
+// Single-pass Hi-Z downsampler. Each 16x16 workgroup reduces a 64x64 depth tile through six
+// mips in shared memory; the last workgroup to finish, found with a global atomic counter,
+// reduces the resulting mip 6 image through the remaining mips.
+
+const kTileTexels: u32 = 64u;
+// Mip 6 of the largest supported depth buffer still fits one 64x64 tail tile.
+const kTailTileTexels: u32 = 64u;
+
+struct SpdSync {
+    finishedWorkgroups: atomic<u32>,
+    // Mip 6 as float bits, exchanged through atomics so the tail workgroup sees every tile's result.
+    mip6: array<atomic<u32>, 4096>,
+};
+
+@group(0) @binding(0) var depthTex: texture_depth_2d;
+@group(0) @binding(1) var<storage, read_write> pyramid: array<f32>;
+@group(0) @binding(2) var<storage, read_write> spdSync: SpdSync;
+@group(0) @binding(3) var<uniform> params: HiZParams;
+
+var<workgroup> reductionTile: array<array<f32, 16>, 16>;
+var<workgroup> isTailWorkgroup: u32;
+
+// Reads past the edge of a level replicate its last row or column. Those texels lie inside the
+// footprint of the rounded-up parent texel, so every reduced texel is the max of its footprint.
+fn load_source(sourceMip: u32, texel: vec2u) -> f32 {
+    if (sourceMip == 0u) {
+        let dims = textureDimensions(depthTex);
+        return textureLoad(depthTex, vec2i(min(texel, dims - vec2u(1u))), 0);
+    }
+    let mip = params.mips[sourceMip];
+    let clamped = min(texel, vec2u(mip.width, mip.height) - vec2u(1u));
+    return bitcast<f32>(atomicLoad(&spdSync.mip6[clamped.y * kTailTileTexels + clamped.x]));
+}
+
+fn store_mip(level: u32, texel: vec2u, depth: f32) {
+    if (level >= params.mipCount) {
+        return;
+    }
+    let mip = params.mips[level];
+    if (texel.x < mip.width && texel.y < mip.height) {
+        pyramid[mip.offset + texel.y * mip.width + texel.x] = depth;
+    }
+}
+
+// Reduces the 64x64 texel tile of sourceMip at tileOrigin into mips sourceMip + 1 .. sourceMip + 6.
+// Every invocation must call this; the single-texel result is valid in invocation 0.
+fn reduce_tile(sourceMip: u32, tileOrigin: vec2u, localId: vec2u, localIndex: u32) -> f32 {
+    let blockOrigin = tileOrigin + localId * 4u;
+    var quarterMax = 0.0;
+    for (var j: u32 = 0u; j < 2u; j = j + 1u) {
+        for (var i: u32 = 0u; i < 2u; i = i + 1u) {
+            let p = blockOrigin + vec2u(i, j) * 2u;
+            let d00 = load_source(sourceMip, p);
+            let d10 = load_source(sourceMip, p + vec2u(1u, 0u));
+            let d01 = load_source(sourceMip, p + vec2u(0u, 1u));
+            let d11 = load_source(sourceMip, p + vec2u(1u, 1u));
+            if (sourceMip == 0u) {
+                store_mip(0u, p, d00);
+                store_mip(0u, p + vec2u(1u, 0u), d10);
+                store_mip(0u, p + vec2u(0u, 1u), d01);
+                store_mip(0u, p + vec2u(1u, 1u), d11);
+            }
+            let m = max(max(d00, d10), max(d01, d11));
+            store_mip(sourceMip + 1u, p / 2u, m);
+            quarterMax = max(quarterMax, m);
+        }
+    }
+    store_mip(sourceMip + 2u, blockOrigin / 4u, quarterMax);
+    reductionTile[localId.y][localId.x] = quarterMax;
+    workgroupBarrier();
+
+    var size = 8u;
+    var result = quarterMax;
+    for (var level = sourceMip + 3u; level <= sourceMip + 6u; level = level + 1u) {
+        let active = localIndex < size * size;
+        let p = vec2u(localIndex % size, localIndex / size);
+        if (active) {
+            let q = p * 2u;
+            result = max(
+                max(reductionTile[q.y][q.x], reductionTile[q.y][q.x + 1u]),
+                max(reductionTile[q.y + 1u][q.x], reductionTile[q.y + 1u][q.x + 1u])
+            );
+            store_mip(level, tileOrigin / (1u << (level - sourceMip)) + p, result);
+        }
+        workgroupBarrier();
+        if (active) {
+            reductionTile[p.y][p.x] = result;
+        }
+        workgroupBarrier();
+        size = size / 2u;
+    }
+    return result;
+}
+
+@compute @workgroup_size(16, 16, 1)
+fn cs_main(
+    @builtin(workgroup_id) workgroupId: vec3u,
+    @builtin(local_invocation_id) localId: vec3u,
+    @builtin(local_invocation_index) localIndex: u32
+) {
+    let tileMax = reduce_tile(0u, workgroupId.xy * kTileTexels, localId.xy, localIndex);
+
+    if (localIndex == 0u && workgroupId.x < kTailTileTexels && workgroupId.y < kTailTileTexels) {
+        atomicStore(&spdSync.mip6[workgroupId.y * kTailTileTexels + workgroupId.x], bitcast<u32>(tileMax));
+    }
+    // Atomics are relaxed: publish this tile's mip 6 texel before the counter reports it done.
+    storageBarrier();
+    if (localIndex == 0u) {
+        let finished = atomicAdd(&spdSync.finishedWorkgroups, 1u) + 1u;
+        isTailWorkgroup = select(0u, 1u, finished == params.workgroupCount);
+    }
+    if (workgroupUniformLoad(&isTailWorkgroup) == 0u) {
+        return;
+    }
+    // Pairs with the barrier above so the tail reads every other tile's published texel.
+    workgroupBarrier();
+    storageBarrier();
+
+    if (localIndex == 0u) {
+        atomicStore(&spdSync.finishedWorkgroups, 0u);
+    }
+    if (params.mipCount > 7u) {
+        reduce_tile(6u, vec2u(0u), localId.xy, localIndex);
+    }
+}
@@ -8,4 +8,5 @@ struct FrameUniforms {
 
     renderFlags: vec4u,
     occlusionParams: vec4f,
+    meshletOriginBase: vec4i,
 };
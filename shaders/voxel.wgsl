@@ -1,25 +1,21 @@
 // #include "uniforms.wgsl"
+// #include "meshlet_descriptor.wgsl"
 
 @group(0) @binding(0) var<uniform> frameUniforms: FrameUniforms;
 @group(0) @binding(1) var<storage, read> meshletDataWords: array<u32>;
-
-struct MeshletMetadata {
-    originX: i32,
-    originY: i32,
-    originZ: i32,
-    quadCount: u32,
-    faceDirection: u32,
-    dataOffset: u32,
-    voxelScale: u32,
-    pad1: u32,
-};
-
-@group(0) @binding(2) var<storage, read> meshletMetadata: array<MeshletMetadata>;
+@group(0) @binding(2) var<storage, read> meshletMetadata: array<MeshletDescriptor>;
 @group(0) @binding(3) var<storage, read> materialToTexture: array<u32, 65536>;
-@group(0) @binding(4) var<storage, read> visibleMeshletIndices: array<u32>;
+@group(0) @binding(4) var<storage, read> visibleDrawChunks: array<u32>;
 @group(0) @binding(5) var materialTextures: texture_2d_array<f32>;
 @group(0) @binding(6) var materialSampler: sampler;
 
+// Must match MESHLET_DRAW_CHUNK_* in MeshletTypes.h.
+const kDrawChunkQuads: u32 = 4u;
+const kDrawChunkIndexBits: u32 = 5u;
+// Must match MESHLET_QUAD_* in MeshletTypes.h.
+const kQuadAoShift: u32 = 15u;
+const kQuadPaletteShift: u32 = 24u;
+
 struct VertexInput {
     @builtin(instance_index) instance_idx: u32,
     @builtin(vertex_index) vertex_idx: u32,
@@ -61,7 +57,7 @@ fn fetch_quad_data(quadOffset: u32) -> u32 {
 }
 
 fn decode_local_offset(packed: u32) -> vec3u {
-    let offset = packed & 0xffffu;
+    let offset = packed & ((1u << kQuadAoShift) - 1u);
     return vec3u(
         offset & 0x1fu,
         (offset >> 5u) & 0x1fu,
@@ -69,8 +65,15 @@ fn decode_local_offset(packed: u32) -> vec3u {
     );
 }
 
-fn decode_material_id(packed: u32) -> u32 {
-    return (packed >> 16u) & 0xffffu;
+// The meshlet's material palette follows its quads, two 16-bit ids per word.
+fn fetch_material_id(meshlet: Meshlet, packed: u32) -> u32 {
+    let paletteIndex = (packed >> kQuadPaletteShift) & 0x7fu;
+    let paletteWord = meshletDataWords[meshlet.dataOffset + meshlet.quadCount + paletteIndex / 2u];
+    return (paletteWord >> ((paletteIndex & 1u) * 16u)) & 0xffffu;
+}
+
+fn decode_ao_data(packed: u32) -> u32 {
+    return (packed >> kQuadAoShift) & 0x1ffu;
 }
 
 fn decode_flip(packedAoData: u32) -> bool {
@@ -82,27 +85,18 @@ fn decode_vertex_ao(packedAoData: u32, corner: u32) -> u32 {
     return (packedAoData >> shift) & 0x3u;
 }
 
-fn corner_from_triangle_vertex(triangleVertex: u32, flipped: bool) -> u32 {
+// The shared index pattern splits quads along the 1-2 diagonal: [0,1,2] and [2,1,3]. Flipped quads
+// permute their corners so the same pattern yields [0,1,3] and [0,3,2] with unchanged winding.
+fn corner_from_quad_vertex(quadVertex: u32, flipped: bool) -> u32 {
     if (!flipped) {
-        // Unflipped: [0,1,2] and [2,1,3].
-        switch triangleVertex {
-            case 0u: { return 0u; }
-            case 1u: { return 1u; }
-            case 2u: { return 2u; }
-            case 3u: { return 2u; }
-            case 4u: { return 1u; }
-            default: { return 3u; }
-        }
+        return quadVertex;
     }
 
-    // Flipped: [0,1,3] and [0,3,2].
-    switch triangleVertex {
-        case 0u: { return 0u; }
-        case 1u: { return 1u; }
+    switch quadVertex {
+        case 0u: { return 2u; }
+        case 1u: { return 0u; }
         case 2u: { return 3u; }
-        case 3u: { return 0u; }
-        case 4u: { return 3u; }
-        default: { return 2u; }
+        default: { return 1u; }
     }
 }
 
@@ -173,10 +167,11 @@ fn face_uv(face: u32, cornerOffset: vec3f) -> vec2f {
 fn vs_main(in: VertexInput) -> VertexOutput {
     var out: VertexOutput;
 
-    let meshletIndex = visibleMeshletIndices[in.instance_idx];
-    let meshlet = meshletMetadata[meshletIndex];
-    let quadIdx = in.vertex_idx / 6u;
-    let triangleVertex = in.vertex_idx % 6u;
+    let drawChunk = visibleDrawChunks[in.instance_idx];
+    let meshletIndex = drawChunk >> kDrawChunkIndexBits;
+    let meshlet = decode_meshlet(meshletMetadata[meshletIndex]);
+    let quadIdx = (drawChunk & ((1u << kDrawChunkIndexBits) - 1u)) * kDrawChunkQuads + in.vertex_idx / 4u;
+    let quadVertex = in.vertex_idx % 4u;
 
     if (quadIdx >= meshlet.quadCount) {
         out.position = vec4f(2.0, 2.0, 2.0, 1.0);
@@ -188,15 +183,14 @@ fn vs_main(in: VertexInput) -> VertexOutput {
         return out;
     }
 
-    let quadDataOffset = meshlet.dataOffset + (quadIdx * 2u);
-    let quadData = fetch_quad_data(quadDataOffset);
-    let quadAoData = fetch_quad_data(quadDataOffset + 1u);
+    let quadData = fetch_quad_data(meshlet.dataOffset + quadIdx);
+    let quadAoData = decode_ao_data(quadData);
     let blockLocal = decode_local_offset(quadData);
-    let corner = corner_from_triangle_vertex(triangleVertex, decode_flip(quadAoData));
+    let corner = corner_from_quad_vertex(quadVertex, decode_flip(quadAoData));
     let cornerOffset = face_corner_offset(meshlet.faceDirection, corner);
-    let voxelScale = f32(max(meshlet.voxelScale, 1u));
+    let voxelScale = f32(meshlet.voxelScale);
 
-    let meshletOrigin = vec3f(f32(meshlet.originX), f32(meshlet.originY), f32(meshlet.originZ));
+    let meshletOrigin = vec3f(meshlet.origin);
     let worldPosition =
         meshletOrigin +
         (vec3f(f32(blockLocal.x), f32(blockLocal.y), f32(blockLocal.z)) + cornerOffset) * voxelScale;
@@ -207,12 +201,12 @@ fn vs_main(in: VertexInput) -> VertexOutput {
 
     out.worldPosition = worldSpacePosition.xyz;
     out.texCoord = face_uv(meshlet.faceDirection, cornerOffset);
-    out.materialId = decode_material_id(quadData);
+    out.materialId = fetch_material_id(meshlet, quadData);
     out.ao = f32(decode_vertex_ao(quadAoData, corner)) / 3.0;
 
-    let meshletColorSeed = (bitcast<u32>(meshlet.originX) * 73856093u) ^
-        (bitcast<u32>(meshlet.originY) * 19349663u) ^
-        (bitcast<u32>(meshlet.originZ) * 83492791u) ^
+    let meshletColorSeed = (bitcast<u32>(meshlet.origin.x) * 73856093u) ^
+        (bitcast<u32>(meshlet.origin.y) * 19349663u) ^
+        (bitcast<u32>(meshlet.origin.z) * 83492791u) ^
         (meshlet.faceDirection * 2654435761u);
     out.debugColor = hash_to_color(meshletColorSeed);
 
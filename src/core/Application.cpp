@@ -9,7 +9,9 @@
 bool Application::Initialize() {
     if (!gpu.initialize()) return false;
     if (!voxelStreaming_.initialize()) return false;
+    gpu.setFarFieldInnerRadius(voxelStreaming_.meshRadiusChunks() * cfg::CHUNK_SIZE);
     buf = gpu.getBufferManager();
+    uniformBuffer_ = gpu.uniformBuffer();
 
     window = gpu.getWindow();
 
@@ -47,7 +49,7 @@ bool Application::Initialize() {
     gpu.setDebugWorld(voxelStreaming_.world());
     voxelStreaming_.start(camera.position, gpu.uploadedMeshRevision());
 
-    buf->writeBuffer("uniform_buffer", 0, &uniforms, sizeof(FrameUniforms));
+    buf->writeBuffer(uniformBuffer_, 0, &uniforms, sizeof(FrameUniforms));
 
     if (!gui.initImGUI(window, gpu.getContext()->getDevice(), gpu.getContext()->getSurfaceFormat())) {
         std::cerr << "Failed to initialize ImGUI" << std::endl;
@@ -113,7 +115,7 @@ void Application::MainLoop() {
     }
 
     voxelStreaming_.setMainUploadInProgress(gpu.isMeshUploadInProgress());
-    voxelStreaming_.updateCamera(camera.position, sseProjectionScale);
+    voxelStreaming_.updateCamera(camera.position, camera.front, sseProjectionScale);
     if (auto upload = voxelStreaming_.consumePendingMeshUpload()) {
         gpu.queueMeshUpload(std::move(*upload));
     }
@@ -123,6 +125,8 @@ void Application::MainLoop() {
         ).count())
     );
 
+    gpu.updateFarField(camera.position);
+
     const RuntimeTimingSnapshot gpuTiming = gpu.getRuntimeTimingSnapshot();
     const RuntimeTimingSnapshot streamingTiming = voxelStreaming_.getRuntimeTimingSnapshot();
     runtimeTimingSnapshot_ = gpuTiming;
@@ -138,13 +142,14 @@ void Application::MainLoop() {
     runtimeTimingSnapshot_.streamSkipUnchanged = streamingTiming.streamSkipUnchanged;
     runtimeTimingSnapshot_.streamSkipThrottle = streamingTiming.streamSkipThrottle;
     runtimeTimingSnapshot_.streamSnapshotsPrepared = streamingTiming.streamSnapshotsPrepared;
+    runtimeTimingSnapshot_.streamMeshletsRejected = streamingTiming.streamMeshletsRejected;
     runtimeTimingSnapshot_.worldHasPendingJobs = streamingTiming.worldHasPendingJobs;
     runtimeTimingSnapshot_.meshHasPendingJobs = streamingTiming.meshHasPendingJobs;
     runtimeTimingSnapshot_.pendingUploadQueued =
         streamingTiming.pendingUploadQueued || gpuTiming.pendingUploadQueued;
 
     gui.renderImGUI(uniforms, frameTimes, camera, frameTime, runtimeTimingSnapshot_);
-    buf->writeBuffer("uniform_buffer", 0, &uniforms, sizeof(FrameUniforms));
+    buf->writeBuffer(uniformBuffer_, 0, &uniforms, sizeof(FrameUniforms));
     
     gpu.renderFrame(uniforms);
 
@@ -263,16 +268,18 @@ void Application::updateProjectionMatrix(int zoom) {
         return;
     }
     float ratio = width / (float)height;
-    uniforms.projectionMatrix = glm::perspective(zoom * PI / 180, ratio, 0.1f, 2500.0f);
+    // Far enough to reach the far-field horizon.
+    const float farPlane = std::max(2500.0f, gpu.farFieldViewDistance());
+    uniforms.projectionMatrix = glm::perspective(zoom * PI / 180, ratio, 0.1f, farPlane);
     uniforms.inverseProjectionMatrix = glm::inverse(uniforms.projectionMatrix);
 
-    buf->writeBuffer("uniform_buffer", offsetof(FrameUniforms, projectionMatrix), &uniforms.projectionMatrix, sizeof(FrameUniforms::projectionMatrix));
+    buf->writeBuffer(uniformBuffer_, offsetof(FrameUniforms, projectionMatrix), &uniforms.projectionMatrix, sizeof(FrameUniforms::projectionMatrix));
 }
 
 void Application::updateViewMatrix() {
     uniforms.viewMatrix = glm::lookAt(camera.position, camera.position + camera.front, camera.up);
     uniforms.inverseViewMatrix = glm::inverse(uniforms.viewMatrix);
-    buf->writeBuffer("uniform_buffer", offsetof(FrameUniforms, viewMatrix), &uniforms.viewMatrix, sizeof(FrameUniforms::viewMatrix));
+    buf->writeBuffer(uniformBuffer_, offsetof(FrameUniforms, viewMatrix), &uniforms.viewMatrix, sizeof(FrameUniforms::viewMatrix));
 }
 
 void Application::onMouseMove(double xpos, double ypos) {
@@ -2,54 +2,52 @@
 #include "solum_engine/render/BufferManager.h"
 
 void BufferManager::deleteBuffer(const std::string& bufferName) {
-    const auto it = buffers.find(bufferName);
-    if (it == buffers.end()) {
-        return;
-    }
-
-    if (it->second) {
-        it->second.destroy();
-        it->second.release();
+    wgpu::Buffer buffer = buffers.remove(bufferName);
+    if (buffer) {
+        buffer.destroy();
+        buffer.release();
     }
-    buffers.erase(it);
 }
 
 void BufferManager::writeBuffer(const std::string& bufferName, uint64_t bufferOffset, const void* data, size_t size) {
-    const wgpu::Buffer buffer = getBuffer(bufferName);
+    writeBuffer(getBufferHandle(bufferName), bufferOffset, data, size);
+}
+
+void BufferManager::writeBuffer(BufferHandle handle, uint64_t bufferOffset, const void* data, size_t size) {
+    const wgpu::Buffer buffer = getBuffer(handle);
     if (buffer) {
         queue.writeBuffer(buffer, bufferOffset, data, size);
     }
 }
 
 wgpu::Buffer BufferManager::createBuffer(const std::string& bufferName, const wgpu::BufferDescriptor& config) {
-    auto existing = buffers.find(bufferName);
-    if (existing != buffers.end() && existing->second) {
-        existing->second.release();
-        buffers.erase(existing);
-    }
-
     wgpu::Buffer buffer = device.createBuffer(config);
-    buffers[bufferName] = buffer;
+    wgpu::Buffer replaced = nullptr;
+    buffers.insert(bufferName, buffer, replaced);
+    // Cached bind groups may still reference the old buffer; destroy frees its memory now.
+    if (replaced) {
+        replaced.destroy();
+        replaced.release();
+    }
     return buffer;
 }
 
 wgpu::Buffer BufferManager::getBuffer(const std::string& bufferName) const {
-    auto buffer = buffers.find(bufferName);
-    if (buffer != buffers.end()) {
-        return buffer->second;
-    }
-    return nullptr;
+    return buffers.get(bufferName);
 }
 
-void BufferManager::terminate() {
-    // Clean up regular buffers
-    for (auto& pair : buffers) {
-        if (pair.second) {
-            pair.second.destroy();
-            pair.second.release();
-        }
-    }
+wgpu::Buffer BufferManager::getBuffer(BufferHandle handle) const {
+    return buffers.get(handle);
+}
 
-    // Clear containers
+BufferHandle BufferManager::getBufferHandle(const std::string& bufferName) const {
+    return buffers.find(bufferName);
+}
+
+void BufferManager::terminate() {
+    buffers.forEach([](wgpu::Buffer& buffer) {
+        buffer.destroy();
+        buffer.release();
+    });
     buffers.clear();
 }
@@ -1,6 +1,7 @@
 #include "solum_engine/render/MeshletBufferController.h"
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <iostream>
@@ -12,14 +13,10 @@ uint32_t MeshletBufferController::computeRequiredMeshletCapacity(const Streaming
     );
 }
 
-uint32_t MeshletBufferController::computeRequiredQuadCapacity(const StreamingMeshUpload& upload,
-                                                              uint32_t requiredMeshletCapacity) noexcept {
+uint32_t MeshletBufferController::computeRequiredQuadCapacity(const StreamingMeshUpload& upload) noexcept {
     return std::max(
         upload.requiredQuadCapacity,
-        std::max(
-            upload.totalQuadCount + (1024u * MESHLET_QUAD_DATA_WORD_STRIDE),
-            requiredMeshletCapacity * MESHLET_QUAD_CAPACITY * MESHLET_QUAD_DATA_WORD_STRIDE
-        )
+        upload.totalQuadCount + (1024u * MESHLET_QUAD_DATA_WORD_STRIDE)
     );
 }
 
@@ -30,6 +27,7 @@ bool MeshletBufferController::initialize(BufferManager* bufferManager) {
     quadCapacity_ = 0;
     uploadedMeshRevision_ = 0;
     activeMeshletBounds_.clear();
+    activeMeshletOriginBase_ = glm::ivec3(0);
     pendingMeshUpload_.reset();
     chunkedMeshUpload_.reset();
     meshUploadInProgress_.store(false, std::memory_order_relaxed);
@@ -38,6 +36,18 @@ bool MeshletBufferController::initialize(BufferManager* bufferManager) {
         return false;
     }
 
+    const std::array<uint16_t, MESHLET_DRAW_CHUNK_INDICES> quadIndices = buildMeshletDrawChunkIndices();
+    wgpu::BufferDescriptor indexDesc = wgpu::Default;
+    indexDesc.label = wgpu::StringView("meshlet quad index buffer");
+    indexDesc.size = sizeof(quadIndices);
+    indexDesc.usage = wgpu::BufferUsage::Index | wgpu::BufferUsage::CopyDst;
+    indexDesc.mappedAtCreation = false;
+    if (!bufferManager_->createBuffer(kQuadIndexBufferName, indexDesc)) {
+        std::cerr << "Failed to create meshlet quad index buffer." << std::endl;
+        return false;
+    }
+    bufferManager_->writeBuffer(kQuadIndexBufferName, 0u, quadIndices.data(), sizeof(quadIndices));
+
     return uploadImmediate(StreamingMeshUpload{});
 }
 
@@ -51,7 +61,7 @@ bool MeshletBufferController::ensureCapacity(const StreamingMeshUpload& upload,
     }
 
     const uint32_t requiredMeshletCapacity = computeRequiredMeshletCapacity(upload);
-    const uint32_t requiredQuadCapacity = computeRequiredQuadCapacity(upload, requiredMeshletCapacity);
+    const uint32_t requiredQuadCapacity = computeRequiredQuadCapacity(upload);
 
     const bool requiresRecreate =
         !meshletManager_ ||
@@ -88,7 +98,7 @@ bool MeshletBufferController::uploadImmediate(StreamingMeshUpload&& upload) {
     meshletManager_->adoptPreparedData(
         std::move(upload.metadata),
         std::move(upload.quadData),
-        std::move(upload.meshletAabbsGpu)
+        std::move(upload.meshletGroups)
     );
     if (!meshletManager_->upload()) {
         std::cerr << "Failed to upload meshlet buffers." << std::endl;
@@ -96,6 +106,7 @@ bool MeshletBufferController::uploadImmediate(StreamingMeshUpload&& upload) {
     }
 
     activeMeshletBounds_ = std::move(upload.meshletBounds);
+    activeMeshletOriginBase_ = upload.meshletOriginBase;
     uploadedMeshRevision_ = upload.meshRevision;
     return true;
 }
@@ -111,7 +122,7 @@ bool MeshletBufferController::streamChunkedUploadBytes(ChunkedMeshUploadState& u
 
     size_t remainingBudgetBytes = budgetBytes;
 
-    const size_t metadataTotalBytes = uploadState.upload.metadata.size() * sizeof(MeshletMetadataGPU);
+    const size_t metadataTotalBytes = uploadState.upload.metadata.size() * sizeof(MeshletDescriptorGPU);
     if (uploadState.metadataUploadedBytes < metadataTotalBytes && remainingBudgetBytes > 0u) {
         const size_t remainingMetadata = metadataTotalBytes - uploadState.metadataUploadedBytes;
         const size_t metadataChunkBytes = std::min(remainingBudgetBytes, remainingMetadata);
@@ -145,20 +156,20 @@ bool MeshletBufferController::streamChunkedUploadBytes(ChunkedMeshUploadState& u
         remainingBudgetBytes -= quadChunkBytes;
     }
 
-    const size_t aabbTotalBytes = uploadState.upload.meshletAabbsGpu.size() * sizeof(MeshletAabbGPU);
-    if (uploadState.aabbUploadedBytes < aabbTotalBytes && remainingBudgetBytes > 0u) {
-        const size_t remainingAabbs = aabbTotalBytes - uploadState.aabbUploadedBytes;
-        const size_t aabbChunkBytes = std::min(remainingBudgetBytes, remainingAabbs);
-        const auto* aabbBytes = reinterpret_cast<const uint8_t*>(uploadState.upload.meshletAabbsGpu.data());
-        if (!meshletManager_->writeAabbChunk(
+    const size_t groupTotalBytes = uploadState.upload.meshletGroups.size() * sizeof(MeshletGroupGPU);
+    if (uploadState.groupUploadedBytes < groupTotalBytes && remainingBudgetBytes > 0u) {
+        const size_t remainingGroups = groupTotalBytes - uploadState.groupUploadedBytes;
+        const size_t groupChunkBytes = std::min(remainingBudgetBytes, remainingGroups);
+        const auto* groupBytes = reinterpret_cast<const uint8_t*>(uploadState.upload.meshletGroups.data());
+        if (!meshletManager_->writeGroupChunk(
                 uploadState.targetBufferIndex,
-                static_cast<uint64_t>(uploadState.aabbUploadedBytes),
-                aabbBytes + uploadState.aabbUploadedBytes,
-                aabbChunkBytes)) {
-            std::cerr << "Failed to stream meshlet aabb chunk." << std::endl;
+                static_cast<uint64_t>(uploadState.groupUploadedBytes),
+                groupBytes + uploadState.groupUploadedBytes,
+                groupChunkBytes)) {
+            std::cerr << "Failed to stream meshlet group chunk." << std::endl;
             return false;
         }
-        uploadState.aabbUploadedBytes += aabbChunkBytes;
+        uploadState.groupUploadedBytes += groupChunkBytes;
     }
 
     return true;
@@ -190,7 +201,7 @@ MeshletBufferController::ProcessResult MeshletBufferController::processPendingUp
             meshletManager_->adoptPreparedData(
                 std::move(pendingUpload.metadata),
                 std::move(pendingUpload.quadData),
-                std::move(pendingUpload.meshletAabbsGpu)
+                std::move(pendingUpload.meshletGroups)
             );
             if (!meshletManager_->upload()) {
                 std::cerr << "Failed to upload meshlet buffers after recreation." << std::endl;
@@ -199,6 +210,7 @@ MeshletBufferController::ProcessResult MeshletBufferController::processPendingUp
             }
 
             activeMeshletBounds_ = std::move(pendingUpload.meshletBounds);
+            activeMeshletOriginBase_ = pendingUpload.meshletOriginBase;
             uploadedMeshRevision_ = pendingUpload.meshRevision;
             meshUploadInProgress_.store(false, std::memory_order_relaxed);
             result.uploadApplied = true;
@@ -223,13 +235,13 @@ MeshletBufferController::ProcessResult MeshletBufferController::processPendingUp
         return result;
     }
 
-    const size_t metadataTotalBytes = uploadState.upload.metadata.size() * sizeof(MeshletMetadataGPU);
+    const size_t metadataTotalBytes = uploadState.upload.metadata.size() * sizeof(MeshletDescriptorGPU);
     const size_t quadTotalBytes = uploadState.upload.quadData.size() * sizeof(uint32_t);
-    const size_t aabbTotalBytes = uploadState.upload.meshletAabbsGpu.size() * sizeof(MeshletAabbGPU);
+    const size_t groupTotalBytes = uploadState.upload.meshletGroups.size() * sizeof(MeshletGroupGPU);
     const bool uploadComplete =
         uploadState.metadataUploadedBytes >= metadataTotalBytes &&
         uploadState.quadUploadedBytes >= quadTotalBytes &&
-        uploadState.aabbUploadedBytes >= aabbTotalBytes;
+        uploadState.groupUploadedBytes >= groupTotalBytes;
 
     if (!uploadComplete || !meshletManager_) {
         return result;
@@ -237,11 +249,13 @@ MeshletBufferController::ProcessResult MeshletBufferController::processPendingUp
 
     meshletManager_->activateBuffer(
         uploadState.targetBufferIndex,
-        uploadState.upload.totalMeshletCount,
-        static_cast<uint32_t>(uploadState.upload.quadData.size())
+        uploadState.upload.metadata,
+        static_cast<uint32_t>(uploadState.upload.quadData.size()),
+        static_cast<uint32_t>(uploadState.upload.meshletGroups.size())
     );
 
     activeMeshletBounds_ = std::move(uploadState.upload.meshletBounds);
+    activeMeshletOriginBase_ = uploadState.upload.meshletOriginBase;
     uploadedMeshRevision_ = uploadState.upload.meshRevision;
     chunkedMeshUpload_.reset();
     meshUploadInProgress_.store(false, std::memory_order_relaxed);
@@ -267,18 +281,32 @@ const char* MeshletBufferController::activeMeshMetadataBufferName() const noexce
     return meshletManager_->getActiveMeshMetadataBufferName();
 }
 
-const char* MeshletBufferController::activeMeshAabbBufferName() const noexcept {
+const char* MeshletBufferController::activeVisibleMeshletIndexBufferName() const noexcept {
     if (!meshletManager_) {
-        return MeshletManager::meshAabbBufferName(0u);
+        return MeshletManager::visibleMeshletIndexBufferName(0u);
     }
-    return meshletManager_->getActiveMeshAabbBufferName();
+    return meshletManager_->getActiveVisibleMeshletIndexBufferName();
 }
 
-const char* MeshletBufferController::activeVisibleMeshletIndexBufferName() const noexcept {
+const char* MeshletBufferController::activePrepassDrawChunkBufferName() const noexcept {
     if (!meshletManager_) {
-        return MeshletManager::visibleMeshletIndexBufferName(0u);
+        return MeshletManager::prepassDrawChunkBufferName(0u);
     }
-    return meshletManager_->getActiveVisibleMeshletIndexBufferName();
+    return meshletManager_->getActivePrepassDrawChunkBufferName();
+}
+
+const char* MeshletBufferController::activeMeshGroupBufferName() const noexcept {
+    if (!meshletManager_) {
+        return MeshletManager::meshGroupBufferName(0u);
+    }
+    return meshletManager_->getActiveMeshGroupBufferName();
+}
+
+const char* MeshletBufferController::activeCandidateMeshletBufferName() const noexcept {
+    if (!meshletManager_) {
+        return MeshletManager::candidateMeshletBufferName(0u);
+    }
+    return meshletManager_->getActiveCandidateMeshletBufferName();
 }
 
 uint32_t MeshletBufferController::meshletCount() const noexcept {
@@ -288,11 +316,18 @@ uint32_t MeshletBufferController::meshletCount() const noexcept {
     return meshletManager_->getMeshletCount();
 }
 
-uint32_t MeshletBufferController::verticesPerMeshlet() const noexcept {
+uint32_t MeshletBufferController::drawChunkCount() const noexcept {
+    if (!meshletManager_) {
+        return 0u;
+    }
+    return meshletManager_->getDrawChunkCount();
+}
+
+uint32_t MeshletBufferController::meshletGroupCount() const noexcept {
     if (!meshletManager_) {
-        return MESHLET_VERTEX_CAPACITY;
+        return 0u;
     }
-    return meshletManager_->getVerticesPerMeshlet();
+    return meshletManager_->getGroupCount();
 }
 
 uint32_t MeshletBufferController::effectiveMeshletCountForPasses() const noexcept {
@@ -311,6 +346,10 @@ const std::vector<MeshletAabb>& MeshletBufferController::activeMeshletBounds() c
     return activeMeshletBounds_;
 }
 
+const glm::ivec3& MeshletBufferController::activeMeshletOriginBase() const noexcept {
+    return activeMeshletOriginBase_;
+}
+
 bool MeshletBufferController::isUploadInProgress() const noexcept {
     return meshUploadInProgress_.load(std::memory_order_relaxed);
 }
@@ -3,7 +3,6 @@
 #include <algorithm>
 #include <cstddef>
 #include <iostream>
-#include <numeric>
 
 using namespace wgpu;
 
@@ -15,14 +14,22 @@ const char* MeshletManager::meshMetadataBufferName(uint32_t bufferIndex) noexcep
     return (bufferIndex % kBufferSetCount == 0u) ? kMeshMetadataBufferName0 : kMeshMetadataBufferName1;
 }
 
-const char* MeshletManager::meshAabbBufferName(uint32_t bufferIndex) noexcept {
-    return (bufferIndex % kBufferSetCount == 0u) ? kMeshAabbBufferName0 : kMeshAabbBufferName1;
-}
-
 const char* MeshletManager::visibleMeshletIndexBufferName(uint32_t bufferIndex) noexcept {
     return (bufferIndex % kBufferSetCount == 0u) ? kVisibleMeshletIndexBufferName0 : kVisibleMeshletIndexBufferName1;
 }
 
+const char* MeshletManager::prepassDrawChunkBufferName(uint32_t bufferIndex) noexcept {
+    return (bufferIndex % kBufferSetCount == 0u) ? kPrepassDrawChunkBufferName0 : kPrepassDrawChunkBufferName1;
+}
+
+const char* MeshletManager::meshGroupBufferName(uint32_t bufferIndex) noexcept {
+    return (bufferIndex % kBufferSetCount == 0u) ? kMeshGroupBufferName0 : kMeshGroupBufferName1;
+}
+
+const char* MeshletManager::candidateMeshletBufferName(uint32_t bufferIndex) noexcept {
+    return (bufferIndex % kBufferSetCount == 0u) ? kCandidateMeshletBufferName0 : kCandidateMeshletBufferName1;
+}
+
 bool MeshletManager::initialize(BufferManager* manager, uint32_t maxMeshlets, uint32_t maxQuads) {
     if (manager == nullptr || maxMeshlets == 0 || maxQuads == 0) {
         return false;
@@ -31,22 +38,24 @@ bool MeshletManager::initialize(BufferManager* manager, uint32_t maxMeshlets, ui
     bufferManager = manager;
     meshletCapacity = maxMeshlets;
     quadCapacity = maxQuads;
+    // Every meshlet wastes at most one partial chunk, so this bounds the chunk count of any upload.
+    drawChunkCapacity = quadCapacity / (MESHLET_QUAD_DATA_WORD_STRIDE * MESHLET_DRAW_CHUNK_QUADS) + meshletCapacity;
 
     metadataCpu.clear();
     quadDataCpu.clear();
-    aabbCpu.clear();
+    groupCpu.clear();
     activeBufferIndex_ = 0;
     activeMeshletCount_ = 0;
-    activeVisibleMeshletCount_ = 0;
     activeQuadWordCount_ = 0;
+    activeQuadCount_ = 0;
+    activeDrawChunkCount_ = 0;
+    activeGroupCount_ = 0;
 
     metadataCpu.reserve(meshletCapacity);
     quadDataCpu.reserve(quadCapacity);
-    aabbCpu.reserve(meshletCapacity);
-    sequentialVisibleIndicesCpu.reserve(meshletCapacity);
 
     BufferDescriptor metadataDesc = Default;
-    metadataDesc.size = static_cast<uint64_t>(meshletCapacity) * sizeof(MeshletMetadataGPU);
+    metadataDesc.size = static_cast<uint64_t>(meshletCapacity) * sizeof(MeshletDescriptorGPU);
     metadataDesc.usage = BufferUsage::CopyDst | BufferUsage::Storage;
     metadataDesc.mappedAtCreation = false;
 
@@ -56,14 +65,20 @@ bool MeshletManager::initialize(BufferManager* manager, uint32_t maxMeshlets, ui
     meshDataDesc.mappedAtCreation = false;
 
     BufferDescriptor visibleIndicesDesc = Default;
-    visibleIndicesDesc.size = static_cast<uint64_t>(meshletCapacity) * sizeof(uint32_t);
+    visibleIndicesDesc.size = static_cast<uint64_t>(drawChunkCapacity) * sizeof(uint32_t);
     visibleIndicesDesc.usage = BufferUsage::CopyDst | BufferUsage::Storage;
     visibleIndicesDesc.mappedAtCreation = false;
 
-    BufferDescriptor aabbDesc = Default;
-    aabbDesc.size = static_cast<uint64_t>(meshletCapacity) * sizeof(MeshletAabbGPU);
-    aabbDesc.usage = BufferUsage::CopyDst | BufferUsage::Storage;
-    aabbDesc.mappedAtCreation = false;
+    // Every group holds at least one meshlet, so meshlet capacity bounds the group count.
+    BufferDescriptor groupDesc = Default;
+    groupDesc.size = static_cast<uint64_t>(meshletCapacity) * sizeof(MeshletGroupGPU);
+    groupDesc.usage = BufferUsage::CopyDst | BufferUsage::Storage;
+    groupDesc.mappedAtCreation = false;
+
+    BufferDescriptor candidateDesc = Default;
+    candidateDesc.size = static_cast<uint64_t>(MESHLET_CANDIDATE_HEADER_WORDS + meshletCapacity) * sizeof(uint32_t);
+    candidateDesc.usage = BufferUsage::CopyDst | BufferUsage::Storage | BufferUsage::Indirect;
+    candidateDesc.mappedAtCreation = false;
 
     for (uint32_t i = 0; i < kBufferSetCount; ++i) {
         metadataDesc.label = StringView("meshlet metadata buffer");
@@ -84,11 +99,29 @@ bool MeshletManager::initialize(BufferManager* manager, uint32_t maxMeshlets, ui
             return false;
         }
 
-        aabbDesc.label = StringView("meshlet aabb buffer");
-        Buffer aabbBuffer = bufferManager->createBuffer(meshAabbBufferName(i), aabbDesc);
-        if (!aabbBuffer) {
+        visibleIndicesDesc.label = StringView("meshlet prepass draw chunk buffer");
+        Buffer prepassChunkBuffer = bufferManager->createBuffer(prepassDrawChunkBufferName(i), visibleIndicesDesc);
+        if (!prepassChunkBuffer) {
             return false;
         }
+
+        groupDesc.label = StringView("meshlet group buffer");
+        Buffer groupBuffer = bufferManager->createBuffer(meshGroupBufferName(i), groupDesc);
+        if (!groupBuffer) {
+            return false;
+        }
+
+        candidateDesc.label = StringView("meshlet candidate buffer");
+        Buffer candidateBuffer = bufferManager->createBuffer(candidateMeshletBufferName(i), candidateDesc);
+        if (!candidateBuffer) {
+            return false;
+        }
+
+        BufferSet& set = bufferSets_[i];
+        set.metadata = bufferManager->getBufferHandle(meshMetadataBufferName(i));
+        set.meshData = bufferManager->getBufferHandle(meshDataBufferName(i));
+        set.visibleIndices = bufferManager->getBufferHandle(visibleMeshletIndexBufferName(i));
+        set.groups = bufferManager->getBufferHandle(meshGroupBufferName(i));
     }
 
     return true;
@@ -97,18 +130,20 @@ bool MeshletManager::initialize(BufferManager* manager, uint32_t maxMeshlets, ui
 void MeshletManager::clear() {
     metadataCpu.clear();
     quadDataCpu.clear();
-    aabbCpu.clear();
+    groupCpu.clear();
     activeMeshletCount_ = 0;
-    activeVisibleMeshletCount_ = 0;
     activeQuadWordCount_ = 0;
+    activeQuadCount_ = 0;
+    activeDrawChunkCount_ = 0;
+    activeGroupCount_ = 0;
 }
 
-void MeshletManager::adoptPreparedData(std::vector<MeshletMetadataGPU>&& metadata,
+void MeshletManager::adoptPreparedData(std::vector<MeshletDescriptorGPU>&& metadata,
                                        std::vector<uint32_t>&& quadData,
-                                       std::vector<MeshletAabbGPU>&& aabbs) {
+                                       std::vector<MeshletGroupGPU>&& groups) {
     metadataCpu = std::move(metadata);
     quadDataCpu = std::move(quadData);
-    aabbCpu = std::move(aabbs);
+    groupCpu = std::move(groups);
 }
 
 bool MeshletManager::upload() {
@@ -125,7 +160,7 @@ bool MeshletManager::upload() {
                 targetBufferIndex,
                 0,
                 metadataCpu.data(),
-                metadataCpu.size() * sizeof(MeshletMetadataGPU))) {
+                metadataCpu.size() * sizeof(MeshletDescriptorGPU))) {
             return false;
         }
     }
@@ -141,13 +176,13 @@ bool MeshletManager::upload() {
         }
     }
 
-    if (!aabbCpu.empty()) {
+    if (!groupCpu.empty()) {
         wroteAny = true;
-        if (!writeAabbChunk(
+        if (!writeGroupChunk(
                 targetBufferIndex,
                 0,
-                aabbCpu.data(),
-                aabbCpu.size() * sizeof(MeshletAabbGPU))) {
+                groupCpu.data(),
+                groupCpu.size() * sizeof(MeshletGroupGPU))) {
             return false;
         }
     }
@@ -155,8 +190,9 @@ bool MeshletManager::upload() {
     if (wroteAny) {
         activateBuffer(
             targetBufferIndex,
-            static_cast<uint32_t>(metadataCpu.size()),
-            static_cast<uint32_t>(quadDataCpu.size())
+            metadataCpu,
+            static_cast<uint32_t>(quadDataCpu.size()),
+            static_cast<uint32_t>(groupCpu.size())
         );
     }
 
@@ -171,7 +207,7 @@ bool MeshletManager::writeMetadataChunk(uint32_t bufferIndex,
         return false;
     }
 
-    bufferManager->writeBuffer(meshMetadataBufferName(bufferIndex), byteOffset, data, sizeBytes);
+    bufferManager->writeBuffer(bufferSets_[bufferIndex % kBufferSetCount].metadata, byteOffset, data, sizeBytes);
     return true;
 }
 
@@ -183,45 +219,46 @@ bool MeshletManager::writeQuadChunk(uint32_t bufferIndex,
         return false;
     }
 
-    bufferManager->writeBuffer(meshDataBufferName(bufferIndex), byteOffset, data, sizeBytes);
+    bufferManager->writeBuffer(bufferSets_[bufferIndex % kBufferSetCount].meshData, byteOffset, data, sizeBytes);
     return true;
 }
 
-bool MeshletManager::writeAabbChunk(uint32_t bufferIndex,
-                                    uint64_t byteOffset,
-                                    const void* data,
-                                    size_t sizeBytes) {
+bool MeshletManager::writeGroupChunk(uint32_t bufferIndex,
+                                     uint64_t byteOffset,
+                                     const void* data,
+                                     size_t sizeBytes) {
     if (bufferManager == nullptr || data == nullptr || sizeBytes == 0) {
         return false;
     }
 
-    bufferManager->writeBuffer(meshAabbBufferName(bufferIndex), byteOffset, data, sizeBytes);
+    bufferManager->writeBuffer(bufferSets_[bufferIndex % kBufferSetCount].groups, byteOffset, data, sizeBytes);
     return true;
 }
 
-void MeshletManager::activateBuffer(uint32_t bufferIndex, uint32_t meshletCount, uint32_t quadWordCount) {
+void MeshletManager::activateBuffer(uint32_t bufferIndex,
+                                    const std::vector<MeshletDescriptorGPU>& metadata,
+                                    uint32_t quadWordCount,
+                                    uint32_t groupCount) {
     activeBufferIndex_ = bufferIndex % kBufferSetCount;
-    activeMeshletCount_ = meshletCount;
+    activeMeshletCount_ = static_cast<uint32_t>(metadata.size());
     activeQuadWordCount_ = quadWordCount;
-    activeVisibleMeshletCount_ = meshletCount;
-
-    if (bufferManager == nullptr || meshletCount == 0u) {
-        return;
+    activeQuadCount_ = 0;
+    activeDrawChunkCount_ = 0;
+    activeGroupCount_ = std::min(groupCount, meshletCapacity);
+
+    // The cull pass writes the visible list every frame; only the counts are needed here.
+    uint32_t drawChunkCount = 0;
+    for (const MeshletDescriptorGPU& descriptor : metadata) {
+        const uint32_t quadCount = meshletDescriptorQuadCount(descriptor);
+        activeQuadCount_ += quadCount;
+        drawChunkCount += meshletDrawChunkCount(quadCount);
     }
 
-    if (sequentialVisibleIndicesCpu.size() < meshletCount) {
-        sequentialVisibleIndicesCpu.resize(meshletCount);
-        std::iota(sequentialVisibleIndicesCpu.begin(), sequentialVisibleIndicesCpu.end(), 0u);
-    } else if (!sequentialVisibleIndicesCpu.empty()) {
-        std::iota(sequentialVisibleIndicesCpu.begin(), sequentialVisibleIndicesCpu.begin() + meshletCount, 0u);
+    if (drawChunkCount > drawChunkCapacity) {
+        std::cerr << "Meshlet draw chunks exceed buffer capacity." << std::endl;
+        return;
     }
-
-    bufferManager->writeBuffer(
-        visibleMeshletIndexBufferName(activeBufferIndex_),
-        0u,
-        sequentialVisibleIndicesCpu.data(),
-        static_cast<size_t>(meshletCount) * sizeof(uint32_t)
-    );
+    activeDrawChunkCount_ = drawChunkCount;
 }
 
 uint32_t MeshletManager::getActiveBufferIndex() const noexcept {
@@ -240,49 +277,34 @@ const char* MeshletManager::getActiveMeshMetadataBufferName() const noexcept {
     return meshMetadataBufferName(activeBufferIndex_);
 }
 
-const char* MeshletManager::getActiveMeshAabbBufferName() const noexcept {
-    return meshAabbBufferName(activeBufferIndex_);
-}
-
 const char* MeshletManager::getActiveVisibleMeshletIndexBufferName() const noexcept {
     return visibleMeshletIndexBufferName(activeBufferIndex_);
 }
 
-bool MeshletManager::updateVisibleMeshletIndices(const uint32_t* indices, uint32_t visibleCount) {
-    if (bufferManager == nullptr) {
-        return false;
-    }
-
-    const uint32_t clampedVisibleCount = std::min(visibleCount, activeMeshletCount_);
-    if (clampedVisibleCount > 0u && indices == nullptr) {
-        return false;
-    }
+const char* MeshletManager::getActivePrepassDrawChunkBufferName() const noexcept {
+    return prepassDrawChunkBufferName(activeBufferIndex_);
+}
 
-    if (clampedVisibleCount > 0u) {
-        bufferManager->writeBuffer(
-            visibleMeshletIndexBufferName(activeBufferIndex_),
-            0u,
-            indices,
-            static_cast<size_t>(clampedVisibleCount) * sizeof(uint32_t)
-        );
-    }
+const char* MeshletManager::getActiveMeshGroupBufferName() const noexcept {
+    return meshGroupBufferName(activeBufferIndex_);
+}
 
-    activeVisibleMeshletCount_ = clampedVisibleCount;
-    return true;
+const char* MeshletManager::getActiveCandidateMeshletBufferName() const noexcept {
+    return candidateMeshletBufferName(activeBufferIndex_);
 }
 
 uint32_t MeshletManager::getMeshletCount() const {
     return activeMeshletCount_;
 }
 
-uint32_t MeshletManager::getVisibleMeshletCount() const {
-    return activeVisibleMeshletCount_;
+uint32_t MeshletManager::getQuadCount() const {
+    return activeQuadCount_;
 }
 
-uint32_t MeshletManager::getQuadCount() const {
-    return activeQuadWordCount_ / MESHLET_QUAD_DATA_WORD_STRIDE;
+uint32_t MeshletManager::getDrawChunkCount() const {
+    return activeDrawChunkCount_;
 }
 
-uint32_t MeshletManager::getVerticesPerMeshlet() const {
-    return MESHLET_VERTEX_CAPACITY;
+uint32_t MeshletManager::getGroupCount() const {
+    return activeGroupCount_;
 }
@@ -3,6 +3,7 @@
 #include <unordered_set>
 #include <string>
 #include <iostream>
+#include <utility>
 
 using namespace wgpu;
 
@@ -114,14 +115,12 @@ RenderPipeline PipelineManager::createRenderPipeline(const std::string& pipeline
 
     RenderPipeline pipeline = device.createRenderPipeline(pipelineDesc);
 
-    auto existingPipeline = pipelines.find(pipelineName);
-    if (existingPipeline != pipelines.end() && existingPipeline->second) {
-        existingPipeline->second.release();
-        pipelines.erase(existingPipeline);
+    RenderPipeline replaced = nullptr;
+    pipelines.insert(pipelineName, pipeline, replaced);
+    if (replaced) {
+        replaced.release();
     }
 
-    pipelines[pipelineName] = pipeline;
-
     // Clean up
     shaderModule.release();
     layout.release();
@@ -149,14 +148,12 @@ ComputePipeline PipelineManager::createComputePipeline(const std::string& pipeli
 
     ComputePipeline pipeline = device.createComputePipeline(pipelineDesc);
 
-    auto existingPipeline = computePipelines.find(pipelineName);
-    if (existingPipeline != computePipelines.end() && existingPipeline->second) {
-        existingPipeline->second.release();
-        computePipelines.erase(existingPipeline);
+    ComputePipeline replaced = nullptr;
+    computePipelines.insert(pipelineName, pipeline, replaced);
+    if (replaced) {
+        replaced.release();
     }
 
-    computePipelines[pipelineName] = pipeline;
-
     shaderModule.release();
     layout.release();
 
@@ -177,15 +174,31 @@ BindGroupLayout PipelineManager::createBindGroupLayout(const std::string& bindGr
 
     BindGroupLayout layout = device.createBindGroupLayout(chunkDataBindGroupLayoutDesc);
     bindGroupLayouts[bindGroupLayoutName] = layout;
+    bindGroupLayoutGenerations[bindGroupLayoutName] = nextLayoutGeneration++;
     return layout;
 }
 
 void PipelineManager::deleteBindGroup(const std::string& bindGroupName) {
-    BindGroup group = getBindGroup(bindGroupName);
+    BindGroup group = bindGroups.remove(bindGroupName);
     if (group) {
         group.release();
-        bindGroups.erase(bindGroupName);
     }
+    releaseCachedBindGroups(bindGroupName);
+}
+
+void PipelineManager::releaseCachedBindGroups(const std::string& bindGroupName) {
+    auto cached = bindGroupCache.find(bindGroupName);
+    if (cached == bindGroupCache.end()) {
+        return;
+    }
+    for (const CachedBindGroup& entry : cached->second) {
+        BindGroup group = bindGroups.remove(entry.slotName);
+        if (group) {
+            group.release();
+        }
+    }
+    bindGroupCache.erase(cached);
+    currentCachedBindGroups.erase(bindGroupName);
 }
 
 BindGroup PipelineManager::createBindGroup(const std::string& bindGroupName,
@@ -206,31 +219,104 @@ BindGroup PipelineManager::createBindGroup(const std::string& bindGroupName,
     bindGroupDesc.entryCount = (uint32_t)bindings.size();
     bindGroupDesc.entries = bindings.data();
 
-    auto existing = bindGroups.find(bindGroupName);
-    if (existing != bindGroups.end() && existing->second) {
-        existing->second.release();
-        bindGroups.erase(existing);
-    }
-
     BindGroup bindGroup = device.createBindGroup(bindGroupDesc);
-    bindGroups[bindGroupName] = bindGroup;
+    releaseCachedBindGroups(bindGroupName);
+    BindGroup replaced = nullptr;
+    bindGroups.insert(bindGroupName, bindGroup, replaced);
+    if (replaced) {
+        replaced.release();
+    }
     return bindGroup;
 }
 
-RenderPipeline PipelineManager::getPipeline(const std::string& pipelineName) const {
-    auto pipeline = pipelines.find(pipelineName);
-    if (pipeline != pipelines.end()) {
-        return pipeline->second;
+BindGroup PipelineManager::getOrCreateBindGroup(const std::string& bindGroupName,
+                                                const std::string& bindGroupLayoutName,
+                                                const std::vector<BindGroupEntry>& bindings,
+                                                const std::vector<uint64_t>& resourceKeys) {
+    auto layoutGeneration = bindGroupLayoutGenerations.find(bindGroupLayoutName);
+    if (layoutGeneration == bindGroupLayoutGenerations.end()) {
+        return nullptr;
     }
-    return nullptr;
+    if (resourceKeys.size() != bindings.size()) {
+        std::cerr << "Bind group " << bindGroupName << " has " << bindings.size()
+                  << " bindings but " << resourceKeys.size() << " resource keys." << std::endl;
+        return nullptr;
+    }
+
+    std::vector<uint64_t> key;
+    key.reserve(1 + bindings.size() * 4);
+    key.push_back(layoutGeneration->second);
+    for (std::size_t i = 0; i < bindings.size(); ++i) {
+        key.push_back(bindings[i].binding);
+        key.push_back(resourceKeys[i]);
+        key.push_back(bindings[i].offset);
+        key.push_back(bindings[i].size);
+    }
+
+    std::vector<CachedBindGroup>& cached = bindGroupCache[bindGroupName];
+    BindGroupHandle handle;
+    for (const CachedBindGroup& entry : cached) {
+        if (entry.key == key) {
+            handle = entry.handle;
+            break;
+        }
+    }
+
+    if (!handle) {
+        BindGroupDescriptor bindGroupDesc = Default;
+        bindGroupDesc.label = StringView(bindGroupName);
+        bindGroupDesc.layout = bindGroupLayouts[bindGroupLayoutName];
+        bindGroupDesc.entryCount = (uint32_t)bindings.size();
+        bindGroupDesc.entries = bindings.data();
+        BindGroup group = device.createBindGroup(bindGroupDesc);
+        if (!group) {
+            return nullptr;
+        }
+
+        if (cached.size() >= kMaxCachedBindGroupsPerName) {
+            BindGroup evicted = bindGroups.remove(cached.front().slotName);
+            if (evicted) {
+                evicted.release();
+            }
+            cached.erase(cached.begin());
+        }
+        std::string slotName = bindGroupName + "#" + std::to_string(nextCachedBindGroupSerial++);
+        BindGroup replaced = nullptr;
+        handle = bindGroups.insert(slotName, group, replaced);
+        cached.push_back(CachedBindGroup{std::move(key), std::move(slotName), handle});
+    }
+
+    // A group made by createBindGroup under the same name is superseded.
+    BindGroup plain = bindGroups.remove(bindGroupName);
+    if (plain) {
+        plain.release();
+    }
+    currentCachedBindGroups[bindGroupName] = handle;
+    return bindGroups.get(handle);
+}
+
+RenderPipeline PipelineManager::getPipeline(const std::string& pipelineName) const {
+    return pipelines.get(pipelineName);
+}
+
+RenderPipeline PipelineManager::getPipeline(PipelineHandle handle) const {
+    return pipelines.get(handle);
+}
+
+PipelineHandle PipelineManager::getPipelineHandle(const std::string& pipelineName) const {
+    return pipelines.find(pipelineName);
 }
 
 ComputePipeline PipelineManager::getComputePipeline(const std::string& pipelineName) const {
-    auto pipeline = computePipelines.find(pipelineName);
-    if (pipeline != computePipelines.end()) {
-        return pipeline->second;
-    }
-    return nullptr;
+    return computePipelines.get(pipelineName);
+}
+
+ComputePipeline PipelineManager::getComputePipeline(ComputePipelineHandle handle) const {
+    return computePipelines.get(handle);
+}
+
+ComputePipelineHandle PipelineManager::getComputePipelineHandle(const std::string& pipelineName) const {
+    return computePipelines.find(pipelineName);
 }
 
 BindGroupLayout PipelineManager::getBindGroupLayout(const std::string& bindGroupLayoutName) const {
@@ -242,24 +328,28 @@ BindGroupLayout PipelineManager::getBindGroupLayout(const std::string& bindGroup
 }
 
 BindGroup PipelineManager::getBindGroup(const std::string& bindGroupName) const {
-    auto bindGroup = bindGroups.find(bindGroupName);
-    if (bindGroup != bindGroups.end()) {
-        return bindGroup->second;
+    return bindGroups.get(getBindGroupHandle(bindGroupName));
+}
+
+BindGroup PipelineManager::getBindGroup(BindGroupHandle handle) const {
+    return bindGroups.get(handle);
+}
+
+BindGroupHandle PipelineManager::getBindGroupHandle(const std::string& bindGroupName) const {
+    auto current = currentCachedBindGroups.find(bindGroupName);
+    if (current != currentCachedBindGroups.end()) {
+        return current->second;
     }
-    return nullptr;
+    return bindGroups.find(bindGroupName);
 }
 
 void PipelineManager::terminate() {
-    for (auto& pair : pipelines) {
-        if (pair.second) {
-            pair.second.release();
-        }
-    }
-    for (auto& pair : computePipelines) {
-        if (pair.second) {
-            pair.second.release();
-        }
-    }
+    pipelines.forEach([](RenderPipeline& pipeline) {
+        pipeline.release();
+    });
+    computePipelines.forEach([](ComputePipeline& pipeline) {
+        pipeline.release();
+    });
 
     for (auto& pair : bindGroupLayouts) {
         if (pair.second) {
@@ -267,16 +357,18 @@ void PipelineManager::terminate() {
         }
     }
 
-    for (auto& pair : bindGroups) {
-        if (pair.second) {
-            pair.second.release();
-        }
-    }
+    // Cached groups live in the registry too.
+    bindGroups.forEach([](BindGroup& group) {
+        group.release();
+    });
 
     pipelines.clear();
     computePipelines.clear();
     bindGroupLayouts.clear();
+    bindGroupLayoutGenerations.clear();
     bindGroups.clear();
+    bindGroupCache.clear();
+    currentCachedBindGroups.clear();
 }
 
 ShaderModule PipelineManager::loadShaderModule(const std::filesystem::path& path, Device device) {
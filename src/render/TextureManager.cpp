@@ -9,59 +9,68 @@ void TextureManager::writeTexture(const wgpu::TexelCopyTextureInfo& destination,
 }
 
 wgpu::Texture TextureManager::getTexture(const std::string& textureName) const {
-    auto it = textures.find(textureName);
-    return it != textures.end() ? it->second : nullptr;
+    return textures.get(textureName);
 }
 wgpu::TextureView TextureManager::getTextureView(const std::string& viewName) const {
-    auto it = textureViews.find(viewName);
-    return it != textureViews.end() ? it->second : nullptr;
+    return textureViews.get(viewName);
 }
 wgpu::Sampler TextureManager::getSampler(const std::string& samplerName) const {
-    auto it = samplers.find(samplerName);
-    return it != samplers.end() ? it->second : nullptr;
+    return samplers.get(samplerName);
+}
+wgpu::Texture TextureManager::getTexture(TextureHandle handle) const {
+    return textures.get(handle);
+}
+wgpu::TextureView TextureManager::getTextureView(TextureViewHandle handle) const {
+    return textureViews.get(handle);
+}
+TextureHandle TextureManager::getTextureHandle(const std::string& textureName) const {
+    return textures.find(textureName);
+}
+TextureViewHandle TextureManager::getTextureViewHandle(const std::string& viewName) const {
+    return textureViews.find(viewName);
+}
+SamplerHandle TextureManager::getSamplerHandle(const std::string& samplerName) const {
+    return samplers.find(samplerName);
 }
 wgpu::Texture TextureManager::createTexture(const std::string& name, const wgpu::TextureDescriptor& config) {
     removeTexture(name);
     wgpu::Texture texture = device.createTexture(config);
-    textures[name] = texture;
+    wgpu::Texture replaced = nullptr;
+    textures.insert(name, texture, replaced);
     return texture;
 }
 wgpu::TextureView TextureManager::createTextureView(const std::string& textureName,
                                                     const std::string& viewName,
                                                     const wgpu::TextureViewDescriptor& config) {
     removeTextureView(viewName);
-    auto it = textures.find(textureName);
-    if (it == textures.end()) return nullptr;
-    wgpu::TextureView view = it->second.createView(config);
-    textureViews[viewName] = view;
+    wgpu::Texture texture = textures.get(textureName);
+    if (!texture) return nullptr;
+    wgpu::TextureView view = texture.createView(config);
+    wgpu::TextureView replaced = nullptr;
+    textureViews.insert(viewName, view, replaced);
     return view;
 }
 wgpu::Sampler TextureManager::createSampler(const std::string& samplerName, const wgpu::SamplerDescriptor& config) {
     removeSampler(samplerName);
     wgpu::Sampler sampler = device.createSampler(config);
-    samplers[samplerName] = sampler;
+    wgpu::Sampler replaced = nullptr;
+    samplers.insert(samplerName, sampler, replaced);
     return sampler;
 }
 
 void TextureManager::terminate() {
-    for (auto& kv : textureViews) {
-        if (kv.second) {
-            kv.second.release();
-        }
-    }
+    textureViews.forEach([](wgpu::TextureView& view) {
+        view.release();
+    });
 
-    for (auto& kv : samplers) {
-        if (kv.second) {
-            kv.second.release();
-        }
-    }
+    samplers.forEach([](wgpu::Sampler& sampler) {
+        sampler.release();
+    });
 
-    for (auto& kv : textures) {
-        if (kv.second) {
-            kv.second.destroy();
-            kv.second.release();
-        }
-    }
+    textures.forEach([](wgpu::Texture& texture) {
+        texture.destroy();
+        texture.release();
+    });
 
     textureViews.clear();
     samplers.clear();
@@ -70,26 +79,23 @@ void TextureManager::terminate() {
 
 // ---------- cleanup ----------
 void TextureManager::removeTextureView(const std::string& name) {
-    auto it = textureViews.find(name);
-    if (it != textureViews.end()) {
-        it->second.release();
-        textureViews.erase(it);
+    wgpu::TextureView view = textureViews.remove(name);
+    if (view) {
+        view.release();
     }
 }
 
 void TextureManager::removeTexture(const std::string& name) {
-    auto it = textures.find(name);
-    if (it != textures.end()) {
-        it->second.destroy();
-        it->second.release();
-        textures.erase(it);
+    wgpu::Texture texture = textures.remove(name);
+    if (texture) {
+        texture.destroy();
+        texture.release();
     }
 }
 
 void TextureManager::removeSampler(const std::string& name) {
-    auto it = samplers.find(name);
-    if (it != samplers.end()) {
-        it->second.release();
-        samplers.erase(it);
+    wgpu::Sampler sampler = samplers.remove(name);
+    if (sampler) {
+        sampler.release();
     }
 }
@@ -1,6 +1,7 @@
 #include "solum_engine/render/WebGPURenderer.h"
 
 #include <chrono>
+#include <cstddef>
 #include <iostream>
 
 #include <imgui/backends/imgui_impl_wgpu.h>
@@ -33,6 +34,7 @@ bool WebGPURenderer::initialize() {
         if (!ubo) {
             return false;
         }
+        uniformBuffer_ = bufferManager->getBufferHandle("uniform_buffer");
     }
 
     if (!materialManager->initialize(*bufferManager, *textureManager)) {
@@ -46,7 +48,7 @@ bool WebGPURenderer::initialize() {
     }
 
     voxelPipeline_.emplace(*services_);
-    voxelPipeline_->setDrawConfig(meshletBuffers_.verticesPerMeshlet(), meshletBuffers_.meshletCount());
+    voxelPipeline_->setDrawConfig(meshletBuffers_.drawChunkCount());
     if (!voxelPipeline_->build()) {
         std::cerr << "Failed to create voxel pipeline and resources." << std::endl;
         return false;
@@ -59,15 +61,18 @@ bool WebGPURenderer::initialize() {
     }
 
     meshletCullingPipeline_.emplace(*services_);
-    if (!meshletCullingPipeline_->build(
-            meshletBuffers_,
-            meshletOcclusionPipeline_->hizMipCount(),
-            MeshletOcclusionPipeline::kOcclusionHiZViewName)) {
+    if (!meshletCullingPipeline_->build(meshletBuffers_, meshletOcclusionPipeline_->hizMipCount())) {
         std::cerr << "Failed to initialize meshlet culling resources." << std::endl;
         return false;
     }
 
-    voxelPipeline_->setIndirectDrawBuffer(MeshletCullingPipeline::kIndirectArgsBufferName, 0u);
+    voxelPipeline_->setIndirectDrawBuffer(meshletCullingPipeline_->indirectArgsBuffer(), 0u);
+
+    farFieldPipeline_.emplace(*services_);
+    if (!farFieldPipeline_->build(farFieldTerrain_.config().maxTiles)) {
+        std::cerr << "Failed to create far field pipeline and resources." << std::endl;
+        return false;
+    }
 
     boundsDebugPipeline_.emplace(*services_);
     if (!boundsDebugPipeline_->build()) {
@@ -110,13 +115,11 @@ void WebGPURenderer::createRenderingTextures() {
             : 1u;
         meshletCullingPipeline_->updateCullParams(
             meshletBuffers_.effectiveMeshletCountForPasses(),
+            meshletBuffers_.meshletGroupCount(),
             hizMipCount
         );
 
-        const char* hizViewName = meshletOcclusionPipeline_.has_value()
-            ? MeshletOcclusionPipeline::kOcclusionHiZViewName
-            : nullptr;
-        if (!meshletCullingPipeline_->refreshBindGroup(meshletBuffers_, hizViewName)) {
+        if (!meshletCullingPipeline_->refreshBindGroup(meshletBuffers_)) {
             std::cerr << "Failed to refresh meshlet culling bind group." << std::endl;
         }
     }
@@ -169,6 +172,10 @@ BufferManager* WebGPURenderer::getBufferManager() {
     return bufferManager.get();
 }
 
+BufferHandle WebGPURenderer::uniformBuffer() const noexcept {
+    return uniformBuffer_;
+}
+
 RuntimeTimingSnapshot WebGPURenderer::getRuntimeTimingSnapshot() {
     return timingTracker_.snapshot(meshletBuffers_.hasPendingOrActiveUpload());
 }
@@ -189,6 +196,24 @@ uint64_t WebGPURenderer::uploadedMeshRevision() const noexcept {
     return meshletBuffers_.uploadedMeshRevision();
 }
 
+void WebGPURenderer::setFarFieldInnerRadius(int32_t radiusBlocks) {
+    farFieldTerrain_.setInnerRadiusBlocks(radiusBlocks);
+}
+
+float WebGPURenderer::farFieldViewDistance() const noexcept {
+    return farFieldTerrain_.viewDistanceBlocks();
+}
+
+void WebGPURenderer::updateFarField(const glm::vec3& cameraPosition) {
+    if (!farFieldPipeline_.has_value()) {
+        return;
+    }
+
+    farFieldDirtySlots_.clear();
+    farFieldTerrain_.update(cameraPosition, farFieldDirtySlots_);
+    farFieldPipeline_->uploadTiles(farFieldTerrain_, farFieldDirtySlots_);
+}
+
 void WebGPURenderer::processPendingMeshUploads() {
     if (!meshletBuffers_.hasPendingOrActiveUpload()) {
         return;
@@ -228,10 +253,7 @@ void WebGPURenderer::processPendingMeshUploads() {
                 finalizeUploadTiming();
                 return;
             }
-            voxelPipeline_->setDrawConfig(
-                meshletBuffers_.verticesPerMeshlet(),
-                meshletBuffers_.meshletCount()
-            );
+            voxelPipeline_->setDrawConfig(meshletBuffers_.drawChunkCount());
         }
         timingTracker_.incrementMainUploadsApplied();
     }
@@ -252,10 +274,8 @@ void WebGPURenderer::processPendingMeshUploads() {
                 ? meshletOcclusionPipeline_->hizMipCount()
                 : 1u;
 
-            meshletCullingPipeline_->updateCullParams(meshletCount, hizMipCount);
-            if (!meshletCullingPipeline_->refreshBindGroup(
-                    meshletBuffers_,
-                    MeshletOcclusionPipeline::kOcclusionHiZViewName)) {
+            meshletCullingPipeline_->updateCullParams(meshletCount, meshletBuffers_.meshletGroupCount(), hizMipCount);
+            if (!meshletCullingPipeline_->refreshBindGroup(meshletBuffers_)) {
                 std::cerr << "Failed to bind meshlet culling resources after upload." << std::endl;
                 finalizeUploadTiming();
                 return;
@@ -298,6 +318,22 @@ void WebGPURenderer::renderFrame(FrameUniforms& uniforms) {
 
     processPendingMeshUploads();
 
+    // Meshlet descriptors are relative to the origin base of the snapshot they were built from.
+    const glm::ivec3& meshletOriginBase = meshletBuffers_.activeMeshletOriginBase();
+    if (uniforms.meshletOriginBase[0] != meshletOriginBase.x ||
+        uniforms.meshletOriginBase[1] != meshletOriginBase.y ||
+        uniforms.meshletOriginBase[2] != meshletOriginBase.z) {
+        uniforms.meshletOriginBase[0] = meshletOriginBase.x;
+        uniforms.meshletOriginBase[1] = meshletOriginBase.y;
+        uniforms.meshletOriginBase[2] = meshletOriginBase.z;
+        bufferManager->writeBuffer(
+            uniformBuffer_,
+            offsetof(FrameUniforms, meshletOriginBase),
+            uniforms.meshletOriginBase,
+            sizeof(FrameUniforms::meshletOriginBase)
+        );
+    }
+
     const auto debugUpdateStart = std::chrono::steady_clock::now();
     if (boundsDebugPipeline_.has_value()) {
         debugBoundsManager_.update(uniforms, *boundsDebugPipeline_, meshletBuffers_);
@@ -328,8 +364,17 @@ void WebGPURenderer::renderFrame(FrameUniforms& uniforms) {
     encoderDesc.label = StringView("Frame command encoder");
     CommandEncoder encoder = context->getDevice().createCommandEncoder(encoderDesc);
 
+    // Two-phase occlusion: last frame's visible meshlets seed the Hi-Z, then the full cull tests
+    // everything against it and records the visibility the next frame starts from.
     if (uniforms.occlusionParams[0] >= 0.5f && meshletOcclusionPipeline_.has_value()) {
-        meshletOcclusionPipeline_->encodeDepthPrepass(encoder, meshletBuffers_);
+        if (meshletCullingPipeline_.has_value()) {
+            meshletCullingPipeline_->encodeHistory(encoder, meshletBuffers_);
+        }
+        meshletOcclusionPipeline_->encodeDepthPrepass(
+            encoder,
+            meshletBuffers_,
+            meshletCullingPipeline_.has_value() ? meshletCullingPipeline_->prepassIndirectArgsBuffer() : BufferHandle{}
+        );
         meshletOcclusionPipeline_->encodeHierarchyPass(encoder);
     }
 
@@ -337,8 +382,16 @@ void WebGPURenderer::renderFrame(FrameUniforms& uniforms) {
         meshletCullingPipeline_->encode(encoder, meshletBuffers_);
     }
 
+    if (farFieldPipeline_.has_value()) {
+        farFieldPipeline_->encodeCull(encoder);
+    }
+
     if (voxelPipeline_.has_value()) {
         voxelPipeline_->render(targetView, encoder, [&](RenderPassEncoder& pass) {
+            // After the voxel draw so depth rejects far-field fragments behind voxel terrain.
+            if (farFieldPipeline_.has_value()) {
+                farFieldPipeline_->draw(pass);
+            }
             if (boundsDebugPipeline_.has_value()) {
                 boundsDebugPipeline_->draw(pass);
             }
@@ -469,6 +522,11 @@ void WebGPURenderer::terminate() {
         boundsDebugPipeline_.reset();
     }
 
+    if (farFieldPipeline_.has_value()) {
+        farFieldPipeline_->removeResources();
+        farFieldPipeline_.reset();
+    }
+
     if (meshletCullingPipeline_.has_value()) {
         meshletCullingPipeline_->removeResources();
         meshletCullingPipeline_.reset();
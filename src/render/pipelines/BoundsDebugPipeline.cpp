@@ -72,6 +72,7 @@ bool BoundsDebugPipeline::createPipeline() {
     );
 
     RenderPipeline pipeline = r_.pip.createRenderPipeline(kPipelineName, config);
+    pipeline_ = r_.pip.getPipelineHandle(kPipelineName);
     return pipeline != nullptr;
 }
 
@@ -88,11 +89,12 @@ bool BoundsDebugPipeline::createBindGroup() {
     bindings[0].size = sizeof(FrameUniforms);
 
     BindGroup bindGroup = r_.pip.createBindGroup(kBindGroupName, kBindGroupLayoutName, bindings);
+    bindGroup_ = r_.pip.getBindGroupHandle(kBindGroupName);
     return bindGroup != nullptr;
 }
 
 bool BoundsDebugPipeline::ensureVertexBufferCapacity(uint64_t requiredBytes) {
-    Buffer existingBuffer = r_.buf.getBuffer(kVertexBufferName);
+    Buffer existingBuffer = r_.buf.getBuffer(vertexBuffer_);
     if (existingBuffer && requiredBytes <= vertexCapacityBytes_) {
         return true;
     }
@@ -106,6 +108,7 @@ bool BoundsDebugPipeline::ensureVertexBufferCapacity(uint64_t requiredBytes) {
     desc.mappedAtCreation = false;
 
     Buffer buffer = r_.buf.createBuffer(kVertexBufferName, desc);
+    vertexBuffer_ = r_.buf.getBufferHandle(kVertexBufferName);
     if (!buffer) {
         vertexCapacityBytes_ = 0;
         return false;
@@ -126,7 +129,7 @@ bool BoundsDebugPipeline::updateVertices(const std::vector<DebugLineVertex>& ver
         return false;
     }
 
-    r_.buf.writeBuffer(kVertexBufferName, 0, vertices.data(), static_cast<size_t>(requiredBytes));
+    r_.buf.writeBuffer(vertexBuffer_, 0, vertices.data(), static_cast<size_t>(requiredBytes));
     return true;
 }
 
@@ -135,13 +138,13 @@ void BoundsDebugPipeline::draw(RenderPassEncoder& renderPass) {
         return;
     }
 
-    Buffer vertexBuffer = r_.buf.getBuffer(kVertexBufferName);
+    Buffer vertexBuffer = r_.buf.getBuffer(vertexBuffer_);
     if (!vertexBuffer) {
         return;
     }
 
-    RenderPipeline pipeline = r_.pip.getPipeline(kPipelineName);
-    BindGroup bindGroup = r_.pip.getBindGroup(kBindGroupName);
+    RenderPipeline pipeline = r_.pip.getPipeline(pipeline_);
+    BindGroup bindGroup = r_.pip.getBindGroup(bindGroup_);
     if (!pipeline || !bindGroup) {
         return;
     }
@@ -0,0 +1,425 @@
+#include "solum_engine/render/pipelines/FarFieldPipeline.h"
+
+#include <algorithm>
+
+#include "solum_engine/render/MaterialManager.h"
+#include "solum_engine/render/Uniforms.h"
+
+using namespace wgpu;
+
+namespace {
+struct FarFieldParams {
+    uint32_t tileSlotCount = 0;
+    float seamRadius = 0.0f;
+    float outerRadius = 0.0f;
+    float sinkDepth = 0.0f;
+};
+
+static_assert(sizeof(FarFieldParams) == 16, "FarFieldParams must match the WGSL uniform layout");
+
+constexpr uint64_t kTileSampleBytes = sizeof(uint32_t) * FarFieldTerrain::kTileSampleCount;
+}  // namespace
+
+bool FarFieldPipeline::build() {
+    return createResources() && createPipeline() && createBindGroup();
+}
+
+bool FarFieldPipeline::build(uint32_t tileCapacity) {
+    tileCapacity_ = std::max(tileCapacity, 1u);
+    return build();
+}
+
+bool FarFieldPipeline::createResources() {
+    {
+        BufferDescriptor tileDesc = Default;
+        tileDesc.label = StringView("far field tile buffer");
+        tileDesc.size = sizeof(FarFieldTileRecord) * static_cast<uint64_t>(tileCapacity_);
+        tileDesc.usage = BufferUsage::Storage | BufferUsage::CopyDst;
+        tileDesc.mappedAtCreation = false;
+        if (!r_.buf.createBuffer(kTileBufferName, tileDesc)) {
+            return false;
+        }
+    }
+
+    {
+        BufferDescriptor sampleDesc = Default;
+        sampleDesc.label = StringView("far field sample buffer");
+        sampleDesc.size = kTileSampleBytes * static_cast<uint64_t>(tileCapacity_);
+        sampleDesc.usage = BufferUsage::Storage | BufferUsage::CopyDst;
+        sampleDesc.mappedAtCreation = false;
+        if (!r_.buf.createBuffer(kSampleBufferName, sampleDesc)) {
+            return false;
+        }
+    }
+
+    {
+        BufferDescriptor visibleDesc = Default;
+        visibleDesc.label = StringView("far field visible tile buffer");
+        visibleDesc.size = sizeof(uint32_t) * static_cast<uint64_t>(tileCapacity_);
+        visibleDesc.usage = BufferUsage::Storage;
+        visibleDesc.mappedAtCreation = false;
+        if (!r_.buf.createBuffer(kVisibleTileBufferName, visibleDesc)) {
+            return false;
+        }
+    }
+
+    {
+        BufferDescriptor paramsDesc = Default;
+        paramsDesc.label = StringView("far field params buffer");
+        paramsDesc.size = sizeof(FarFieldParams);
+        paramsDesc.usage = BufferUsage::Uniform | BufferUsage::CopyDst;
+        paramsDesc.mappedAtCreation = false;
+        if (!r_.buf.createBuffer(kParamsBufferName, paramsDesc)) {
+            return false;
+        }
+
+        const FarFieldParams params{};
+        r_.buf.writeBuffer(kParamsBufferName, 0u, &params, sizeof(params));
+    }
+
+    const uint32_t drawArgsReset[4] = {kTileVertexCount, 0u, 0u, 0u};
+    {
+        BufferDescriptor indirectDesc = Default;
+        indirectDesc.label = StringView("far field indirect args buffer");
+        indirectDesc.size = sizeof(drawArgsReset);
+        indirectDesc.usage = BufferUsage::Storage | BufferUsage::Indirect | BufferUsage::CopyDst;
+        indirectDesc.mappedAtCreation = false;
+        if (!r_.buf.createBuffer(kIndirectArgsBufferName, indirectDesc)) {
+            return false;
+        }
+        r_.buf.writeBuffer(kIndirectArgsBufferName, 0u, drawArgsReset, sizeof(drawArgsReset));
+    }
+
+    {
+        BufferDescriptor resetDesc = Default;
+        resetDesc.label = StringView("far field indirect reset buffer");
+        resetDesc.size = sizeof(drawArgsReset);
+        resetDesc.usage = BufferUsage::CopySrc | BufferUsage::CopyDst;
+        resetDesc.mappedAtCreation = false;
+        if (!r_.buf.createBuffer(kIndirectResetBufferName, resetDesc)) {
+            return false;
+        }
+        r_.buf.writeBuffer(kIndirectResetBufferName, 0u, drawArgsReset, sizeof(drawArgsReset));
+    }
+
+    tileBuffer_ = r_.buf.getBufferHandle(kTileBufferName);
+    sampleBuffer_ = r_.buf.getBufferHandle(kSampleBufferName);
+    paramsBuffer_ = r_.buf.getBufferHandle(kParamsBufferName);
+    indirectArgsBuffer_ = r_.buf.getBufferHandle(kIndirectArgsBufferName);
+    indirectResetBuffer_ = r_.buf.getBufferHandle(kIndirectResetBufferName);
+    tileSlotCount_ = 0u;
+    return true;
+}
+
+void FarFieldPipeline::removeResources() {
+    r_.pip.deleteBindGroup(kCullBgName);
+    r_.pip.deleteBindGroup(kDrawBgName);
+    r_.buf.deleteBuffer(kTileBufferName);
+    r_.buf.deleteBuffer(kSampleBufferName);
+    r_.buf.deleteBuffer(kVisibleTileBufferName);
+    r_.buf.deleteBuffer(kParamsBufferName);
+    r_.buf.deleteBuffer(kIndirectArgsBufferName);
+    r_.buf.deleteBuffer(kIndirectResetBufferName);
+    tileSlotCount_ = 0u;
+}
+
+bool FarFieldPipeline::createPipeline() {
+    std::vector<BindGroupLayoutEntry> cullLayoutEntries(5, Default);
+    cullLayoutEntries[0].binding = 0;
+    cullLayoutEntries[0].visibility = ShaderStage::Compute;
+    cullLayoutEntries[0].buffer.type = BufferBindingType::Uniform;
+    cullLayoutEntries[0].buffer.minBindingSize = sizeof(FrameUniforms);
+
+    cullLayoutEntries[1].binding = 1;
+    cullLayoutEntries[1].visibility = ShaderStage::Compute;
+    cullLayoutEntries[1].buffer.type = BufferBindingType::ReadOnlyStorage;
+
+    cullLayoutEntries[2].binding = 2;
+    cullLayoutEntries[2].visibility = ShaderStage::Compute;
+    cullLayoutEntries[2].buffer.type = BufferBindingType::Storage;
+
+    cullLayoutEntries[3].binding = 3;
+    cullLayoutEntries[3].visibility = ShaderStage::Compute;
+    cullLayoutEntries[3].buffer.type = BufferBindingType::Storage;
+
+    cullLayoutEntries[4].binding = 4;
+    cullLayoutEntries[4].visibility = ShaderStage::Compute;
+    cullLayoutEntries[4].buffer.type = BufferBindingType::Uniform;
+    cullLayoutEntries[4].buffer.minBindingSize = sizeof(FarFieldParams);
+
+    BindGroupLayout cullBgl = r_.pip.createBindGroupLayout(kCullBglName, cullLayoutEntries);
+    if (!cullBgl) {
+        return false;
+    }
+
+    ComputePipelineConfig cullConfig;
+    cullConfig.shaderPath = SHADER_DIR "/far_field_cull.wgsl";
+    cullConfig.entryPoint = "cs_main";
+    cullConfig.bindGroupLayouts.push_back(cullBgl);
+    if (!r_.pip.createComputePipeline(kCullPipelineName, cullConfig)) {
+        return false;
+    }
+
+    PipelineConfig config;
+    config.shaderPath = SHADER_DIR "/far_field.wgsl";
+    config.colorFormat = r_.ctx.getSurfaceFormat();
+    config.depthFormat = TextureFormat::Depth32Float;
+    config.sampleCount = 4;
+    // Skirts are seen from both sides.
+    config.cullMode = CullMode::None;
+    config.depthWriteEnabled = true;
+    config.depthCompare = CompareFunction::Less;
+    config.fragmentShaderName = "fs_main";
+    config.vertexShaderName = "vs_main";
+    config.useVertexBuffers = false;
+    config.useCustomBlending = false;
+    config.alphaToCoverageEnabled = false;
+
+    std::vector<BindGroupLayoutEntry> drawLayoutEntries(8, Default);
+
+    int i = 0;
+    drawLayoutEntries[i].binding = i;
+    drawLayoutEntries[i].visibility = ShaderStage::Vertex | ShaderStage::Fragment;
+    drawLayoutEntries[i].buffer.type = BufferBindingType::Uniform;
+    drawLayoutEntries[i].buffer.minBindingSize = sizeof(FrameUniforms);
+    i++;
+
+    drawLayoutEntries[i].binding = i;
+    drawLayoutEntries[i].visibility = ShaderStage::Vertex;
+    drawLayoutEntries[i].buffer.type = BufferBindingType::ReadOnlyStorage;
+    i++;
+
+    drawLayoutEntries[i].binding = i;
+    drawLayoutEntries[i].visibility = ShaderStage::Vertex;
+    drawLayoutEntries[i].buffer.type = BufferBindingType::ReadOnlyStorage;
+    i++;
+
+    drawLayoutEntries[i].binding = i;
+    drawLayoutEntries[i].visibility = ShaderStage::Vertex;
+    drawLayoutEntries[i].buffer.type = BufferBindingType::ReadOnlyStorage;
+    i++;
+
+    drawLayoutEntries[i].binding = i;
+    drawLayoutEntries[i].visibility = ShaderStage::Vertex | ShaderStage::Fragment;
+    drawLayoutEntries[i].buffer.type = BufferBindingType::Uniform;
+    drawLayoutEntries[i].buffer.minBindingSize = sizeof(FarFieldParams);
+    i++;
+
+    drawLayoutEntries[i].binding = i;
+    drawLayoutEntries[i].visibility = ShaderStage::Fragment;
+    drawLayoutEntries[i].buffer.type = BufferBindingType::ReadOnlyStorage;
+    i++;
+
+    drawLayoutEntries[i].binding = i;
+    drawLayoutEntries[i].visibility = ShaderStage::Fragment;
+    drawLayoutEntries[i].texture.sampleType = TextureSampleType::Float;
+    drawLayoutEntries[i].texture.viewDimension = TextureViewDimension::_2DArray;
+    i++;
+
+    drawLayoutEntries[i].binding = i;
+    drawLayoutEntries[i].visibility = ShaderStage::Fragment;
+    drawLayoutEntries[i].sampler.type = SamplerBindingType::Filtering;
+
+    BindGroupLayout drawBgl = r_.pip.createBindGroupLayout(kDrawBglName, drawLayoutEntries);
+    if (!drawBgl) {
+        return false;
+    }
+    config.bindGroupLayouts.push_back(drawBgl);
+
+    if (!r_.pip.createRenderPipeline(kDrawPipelineName, config)) {
+        return false;
+    }
+
+    cullPipeline_ = r_.pip.getComputePipelineHandle(kCullPipelineName);
+    drawPipeline_ = r_.pip.getPipelineHandle(kDrawPipelineName);
+    return true;
+}
+
+bool FarFieldPipeline::createBindGroup() {
+    Buffer uniformBuffer = r_.buf.getBuffer("uniform_buffer");
+    Buffer tileBuffer = r_.buf.getBuffer(kTileBufferName);
+    Buffer sampleBuffer = r_.buf.getBuffer(kSampleBufferName);
+    Buffer visibleTileBuffer = r_.buf.getBuffer(kVisibleTileBufferName);
+    Buffer paramsBuffer = r_.buf.getBuffer(kParamsBufferName);
+    Buffer drawArgsBuffer = r_.buf.getBuffer(kIndirectArgsBufferName);
+    Buffer materialLookupBuffer = r_.buf.getBuffer(MaterialManager::kMaterialLookupBufferName);
+    TextureView materialTextureArrayView = r_.tex.getTextureView(MaterialManager::kMaterialTextureArrayViewName);
+    Sampler materialSampler = r_.tex.getSampler(MaterialManager::kMaterialSamplerName);
+
+    if (!uniformBuffer || !tileBuffer || !sampleBuffer || !visibleTileBuffer || !paramsBuffer ||
+        !drawArgsBuffer || !materialLookupBuffer || !materialTextureArrayView || !materialSampler) {
+        return false;
+    }
+
+    std::vector<BindGroupEntry> cullEntries(5, Default);
+    cullEntries[0].binding = 0;
+    cullEntries[0].buffer = uniformBuffer;
+    cullEntries[0].offset = 0;
+    cullEntries[0].size = sizeof(FrameUniforms);
+
+    cullEntries[1].binding = 1;
+    cullEntries[1].buffer = tileBuffer;
+    cullEntries[1].offset = 0;
+    cullEntries[1].size = tileBuffer.getSize();
+
+    cullEntries[2].binding = 2;
+    cullEntries[2].buffer = visibleTileBuffer;
+    cullEntries[2].offset = 0;
+    cullEntries[2].size = visibleTileBuffer.getSize();
+
+    cullEntries[3].binding = 3;
+    cullEntries[3].buffer = drawArgsBuffer;
+    cullEntries[3].offset = 0;
+    cullEntries[3].size = drawArgsBuffer.getSize();
+
+    cullEntries[4].binding = 4;
+    cullEntries[4].buffer = paramsBuffer;
+    cullEntries[4].offset = 0;
+    cullEntries[4].size = sizeof(FarFieldParams);
+
+    r_.pip.deleteBindGroup(kCullBgName);
+    if (!r_.pip.createBindGroup(kCullBgName, kCullBglName, cullEntries)) {
+        return false;
+    }
+
+    std::vector<BindGroupEntry> drawEntries(8, Default);
+
+    int i = 0;
+    drawEntries[i].binding = i;
+    drawEntries[i].buffer = uniformBuffer;
+    drawEntries[i].offset = 0;
+    drawEntries[i].size = sizeof(FrameUniforms);
+    i++;
+
+    drawEntries[i].binding = i;
+    drawEntries[i].buffer = tileBuffer;
+    drawEntries[i].offset = 0;
+    drawEntries[i].size = tileBuffer.getSize();
+    i++;
+
+    drawEntries[i].binding = i;
+    drawEntries[i].buffer = sampleBuffer;
+    drawEntries[i].offset = 0;
+    drawEntries[i].size = sampleBuffer.getSize();
+    i++;
+
+    drawEntries[i].binding = i;
+    drawEntries[i].buffer = visibleTileBuffer;
+    drawEntries[i].offset = 0;
+    drawEntries[i].size = visibleTileBuffer.getSize();
+    i++;
+
+    drawEntries[i].binding = i;
+    drawEntries[i].buffer = paramsBuffer;
+    drawEntries[i].offset = 0;
+    drawEntries[i].size = sizeof(FarFieldParams);
+    i++;
+
+    drawEntries[i].binding = i;
+    drawEntries[i].buffer = materialLookupBuffer;
+    drawEntries[i].offset = 0;
+    drawEntries[i].size = materialLookupBuffer.getSize();
+    i++;
+
+    drawEntries[i].binding = i;
+    drawEntries[i].textureView = materialTextureArrayView;
+    i++;
+
+    drawEntries[i].binding = i;
+    drawEntries[i].sampler = materialSampler;
+
+    r_.pip.deleteBindGroup(kDrawBgName);
+    if (!r_.pip.createBindGroup(kDrawBgName, kDrawBglName, drawEntries)) {
+        return false;
+    }
+
+    cullBindGroup_ = r_.pip.getBindGroupHandle(kCullBgName);
+    drawBindGroup_ = r_.pip.getBindGroupHandle(kDrawBgName);
+    return true;
+}
+
+void FarFieldPipeline::uploadTiles(const FarFieldTerrain& terrain, const std::vector<uint32_t>& dirtySlots) {
+    for (const uint32_t slot : dirtySlots) {
+        if (slot >= tileCapacity_) {
+            continue;
+        }
+
+        const FarFieldTerrain::Tile& tile = terrain.tile(slot);
+        FarFieldTileRecord record;
+        record.originX = tile.origin.x;
+        record.originY = tile.origin.y;
+        record.spacing = static_cast<uint32_t>(tile.spacing);
+        record.active = tile.active ? 1u : 0u;
+        record.minZ = static_cast<float>(tile.minZ);
+        record.maxZ = static_cast<float>(tile.maxZ);
+        r_.buf.writeBuffer(tileBuffer_, sizeof(FarFieldTileRecord) * static_cast<uint64_t>(slot), &record, sizeof(record));
+
+        // Retired slots keep their stale samples; the cull pass never draws them.
+        if (tile.active && tile.samples.size() == FarFieldTerrain::kTileSampleCount) {
+            r_.buf.writeBuffer(
+                sampleBuffer_,
+                kTileSampleBytes * static_cast<uint64_t>(slot),
+                tile.samples.data(),
+                static_cast<size_t>(kTileSampleBytes)
+            );
+        }
+    }
+
+    tileSlotCount_ = std::min(terrain.slotCount(), tileCapacity_);
+
+    const FarFieldTerrain::Config& config = terrain.config();
+    FarFieldParams params;
+    params.tileSlotCount = tileSlotCount_;
+    params.seamRadius = terrain.seamRadiusBlocks();
+    params.outerRadius = static_cast<float>(config.outerRadiusBlocks);
+    params.sinkDepth = config.sinkBlocks;
+    r_.buf.writeBuffer(paramsBuffer_, 0u, &params, sizeof(params));
+}
+
+void FarFieldPipeline::encodeCull(CommandEncoder encoder) {
+    ComputePipeline cullPipeline = r_.pip.getComputePipeline(cullPipeline_);
+    BindGroup cullBindGroup = r_.pip.getBindGroup(cullBindGroup_);
+    Buffer resetBuffer = r_.buf.getBuffer(indirectResetBuffer_);
+    Buffer indirectArgsBuffer = r_.buf.getBuffer(indirectArgsBuffer_);
+    if (!cullPipeline || !cullBindGroup || !resetBuffer || !indirectArgsBuffer) {
+        return;
+    }
+
+    encoder.copyBufferToBuffer(resetBuffer, 0u, indirectArgsBuffer, 0u, sizeof(uint32_t) * 4u);
+    if (tileSlotCount_ == 0u) {
+        return;
+    }
+
+    ComputePassDescriptor passDesc = Default;
+    ComputePassEncoder pass = encoder.beginComputePass(passDesc);
+    pass.setPipeline(cullPipeline);
+    pass.setBindGroup(0, cullBindGroup, 0, nullptr);
+    pass.dispatchWorkgroups((tileSlotCount_ + kCullWorkgroupSize - 1u) / kCullWorkgroupSize, 1u, 1u);
+    pass.end();
+    pass.release();
+}
+
+void FarFieldPipeline::draw(RenderPassEncoder& renderPass) {
+    if (tileSlotCount_ == 0u) {
+        return;
+    }
+
+    RenderPipeline pipeline = r_.pip.getPipeline(drawPipeline_);
+    BindGroup bindGroup = r_.pip.getBindGroup(drawBindGroup_);
+    Buffer indirectArgsBuffer = r_.buf.getBuffer(indirectArgsBuffer_);
+    if (!pipeline || !bindGroup || !indirectArgsBuffer) {
+        return;
+    }
+
+    renderPass.setPipeline(pipeline);
+    renderPass.setBindGroup(0, bindGroup, 0, nullptr);
+    renderPass.drawIndirect(indirectArgsBuffer, 0u);
+}
+
+bool FarFieldPipeline::render(
+    TextureView /* targetView */,
+    CommandEncoder /* encoder */,
+    const std::function<void(RenderPassEncoder&)>& /* overlayCallback */
+) {
+    return false;
+}
@@ -6,6 +6,7 @@
 #include "solum_engine/render/MeshletManager.h"
 #include "solum_engine/render/MeshletTypes.h"
 #include "solum_engine/render/Uniforms.h"
+#include "solum_engine/render/pipelines/MeshletOcclusionPipeline.h"
 
 using namespace wgpu;
 
@@ -14,28 +15,26 @@ bool MeshletCullingPipeline::build() {
 }
 
 bool MeshletCullingPipeline::build(const MeshletBufferController& meshletBuffers,
-                                   uint32_t occlusionHiZMipCount,
-                                   const char* occlusionHiZViewName) {
+                                   uint32_t occlusionHiZMipCount) {
     if (!createResources() || !createPipeline()) {
         return false;
     }
 
-    updateCullParams(meshletBuffers.meshletCount(), occlusionHiZMipCount);
-    return refreshBindGroup(meshletBuffers, occlusionHiZViewName);
+    updateCullParams(meshletBuffers.meshletCount(), meshletBuffers.meshletGroupCount(), occlusionHiZMipCount);
+    return refreshBindGroup(meshletBuffers);
 }
 
-bool MeshletCullingPipeline::refreshBindGroup(const MeshletBufferController& meshletBuffers,
-                                              const char* occlusionHiZViewName) {
-    activeHiZViewName_ = (occlusionHiZViewName != nullptr) ? occlusionHiZViewName : kDefaultHiZViewName;
-
+bool MeshletCullingPipeline::refreshBindGroup(const MeshletBufferController& meshletBuffers) {
     if (!meshletBuffers.hasMeshletManager()) {
         return createBindGroup();
     }
 
     return createBindGroupForMeshBuffers(
-        meshletBuffers.activeMeshAabbBufferName(),
+        meshletBuffers.activeMeshMetadataBufferName(),
         meshletBuffers.activeVisibleMeshletIndexBufferName(),
-        activeHiZViewName_.c_str()
+        meshletBuffers.activePrepassDrawChunkBufferName(),
+        meshletBuffers.activeMeshGroupBufferName(),
+        meshletBuffers.activeCandidateMeshletBufferName()
     );
 }
 
@@ -54,48 +53,86 @@ bool MeshletCullingPipeline::createResources() {
     {
         BufferDescriptor indirectDesc = Default;
         indirectDesc.label = StringView("meshlet cull indirect args buffer");
-        indirectDesc.size = sizeof(uint32_t) * 4u;
+        indirectDesc.size = sizeof(uint32_t) * kIndirectArgsWordCount;
         indirectDesc.usage = BufferUsage::Storage | BufferUsage::Indirect | BufferUsage::CopyDst;
         indirectDesc.mappedAtCreation = false;
         if (!r_.buf.createBuffer(kIndirectArgsBufferName, indirectDesc)) {
             return false;
         }
 
-        const uint32_t safeDrawArgs[4] = {MESHLET_VERTEX_CAPACITY, 0u, 0u, 0u};
+        const uint32_t safeDrawArgs[kIndirectArgsWordCount] = {MESHLET_DRAW_CHUNK_INDICES, 0u, 0u, 0u, 0u};
         r_.buf.writeBuffer(kIndirectArgsBufferName, 0u, safeDrawArgs, sizeof(safeDrawArgs));
+
+        indirectDesc.label = StringView("meshlet cull prepass indirect args buffer");
+        if (!r_.buf.createBuffer(kPrepassIndirectArgsBufferName, indirectDesc)) {
+            return false;
+        }
+        r_.buf.writeBuffer(kPrepassIndirectArgsBufferName, 0u, safeDrawArgs, sizeof(safeDrawArgs));
+    }
+
+    {
+        // Keyed by meshlet_visibility_key of the decoded descriptor, so it outlives mesh buffer swaps and recreation.
+        BufferDescriptor visibilityDesc = Default;
+        visibilityDesc.label = StringView("meshlet visibility buffer");
+        visibilityDesc.size = static_cast<uint64_t>(MESHLET_VISIBILITY_TABLE_BITS / 32u) * sizeof(uint32_t);
+        visibilityDesc.usage = BufferUsage::Storage | BufferUsage::CopyDst;
+        visibilityDesc.mappedAtCreation = false;
+        if (!r_.buf.createBuffer(kVisibilityBufferName, visibilityDesc)) {
+            return false;
+        }
     }
 
     {
         BufferDescriptor resetDesc = Default;
         resetDesc.label = StringView("meshlet cull indirect reset buffer");
-        resetDesc.size = sizeof(uint32_t) * 4u;
+        resetDesc.size = sizeof(uint32_t) * kIndirectArgsWordCount;
         resetDesc.usage = BufferUsage::CopySrc | BufferUsage::CopyDst;
         resetDesc.mappedAtCreation = false;
         if (!r_.buf.createBuffer(kIndirectResetBufferName, resetDesc)) {
             return false;
         }
 
-        const uint32_t drawArgsReset[4] = {MESHLET_VERTEX_CAPACITY, 0u, 0u, 0u};
+        // drawIndexedIndirect args; the cull shader grows the instance count, one per draw chunk.
+        const uint32_t drawArgsReset[kIndirectArgsWordCount] = {MESHLET_DRAW_CHUNK_INDICES, 0u, 0u, 0u, 0u};
         r_.buf.writeBuffer(
             kIndirectResetBufferName,
             0u,
             drawArgsReset,
             sizeof(drawArgsReset)
         );
+
+        // dispatchWorkgroupsIndirect args plus the candidate count; the group cull grows both.
+        resetDesc.label = StringView("meshlet candidate reset buffer");
+        resetDesc.size = sizeof(uint32_t) * MESHLET_CANDIDATE_HEADER_WORDS;
+        if (!r_.buf.createBuffer(kCandidateResetBufferName, resetDesc)) {
+            return false;
+        }
+
+        const uint32_t candidateReset[MESHLET_CANDIDATE_HEADER_WORDS] = {0u, 1u, 1u, 0u};
+        r_.buf.writeBuffer(kCandidateResetBufferName, 0u, candidateReset, sizeof(candidateReset));
     }
 
+    cullParamsBuffer_ = r_.buf.getBufferHandle(kCullParamsBufferName);
+    indirectArgsBuffer_ = r_.buf.getBufferHandle(kIndirectArgsBufferName);
+    indirectResetBuffer_ = r_.buf.getBufferHandle(kIndirectResetBufferName);
+    prepassIndirectArgsBuffer_ = r_.buf.getBufferHandle(kPrepassIndirectArgsBufferName);
+    candidateResetBuffer_ = r_.buf.getBufferHandle(kCandidateResetBufferName);
     return true;
 }
 
 void MeshletCullingPipeline::removeResources() {
     r_.pip.deleteBindGroup(kCullBgName);
+    r_.pip.deleteBindGroup(kGroupCullBgName);
     r_.buf.deleteBuffer(kCullParamsBufferName);
     r_.buf.deleteBuffer(kIndirectArgsBufferName);
     r_.buf.deleteBuffer(kIndirectResetBufferName);
+    r_.buf.deleteBuffer(kPrepassIndirectArgsBufferName);
+    r_.buf.deleteBuffer(kVisibilityBufferName);
+    r_.buf.deleteBuffer(kCandidateResetBufferName);
 }
 
 bool MeshletCullingPipeline::createPipeline() {
-    std::vector<BindGroupLayoutEntry> cullLayoutEntries(6, Default);
+    std::vector<BindGroupLayoutEntry> cullLayoutEntries(11, Default);
     cullLayoutEntries[0].binding = 0;
     cullLayoutEntries[0].visibility = ShaderStage::Compute;
     cullLayoutEntries[0].buffer.type = BufferBindingType::Uniform;
@@ -120,8 +157,22 @@ bool MeshletCullingPipeline::createPipeline() {
 
     cullLayoutEntries[5].binding = 5;
     cullLayoutEntries[5].visibility = ShaderStage::Compute;
-    cullLayoutEntries[5].texture.sampleType = TextureSampleType::UnfilterableFloat;
-    cullLayoutEntries[5].texture.viewDimension = TextureViewDimension::_2D;
+    cullLayoutEntries[5].buffer.type = BufferBindingType::ReadOnlyStorage;
+
+    for (uint32_t binding = 6; binding <= 8; ++binding) {
+        cullLayoutEntries[binding].binding = binding;
+        cullLayoutEntries[binding].visibility = ShaderStage::Compute;
+        cullLayoutEntries[binding].buffer.type = BufferBindingType::Storage;
+    }
+
+    // Read-only so the candidate list can also feed dispatchWorkgroupsIndirect in the same pass.
+    cullLayoutEntries[9].binding = 9;
+    cullLayoutEntries[9].visibility = ShaderStage::Compute;
+    cullLayoutEntries[9].buffer.type = BufferBindingType::ReadOnlyStorage;
+
+    cullLayoutEntries[10].binding = 10;
+    cullLayoutEntries[10].visibility = ShaderStage::Compute;
+    cullLayoutEntries[10].buffer.type = BufferBindingType::Uniform;
 
     BindGroupLayout cullBgl = r_.pip.createBindGroupLayout(kCullBglName, cullLayoutEntries);
     if (!cullBgl) {
@@ -132,50 +183,106 @@ bool MeshletCullingPipeline::createPipeline() {
     pipelineConfig.shaderPath = SHADER_DIR "/meshlet_cull.wgsl";
     pipelineConfig.entryPoint = "cs_main";
     pipelineConfig.bindGroupLayouts.push_back(cullBgl);
+    if (!r_.pip.createComputePipeline(kCullPipelineName, pipelineConfig)) {
+        return false;
+    }
+
+    pipelineConfig.entryPoint = "cs_select_history";
+    if (!r_.pip.createComputePipeline(kHistoryPipelineName, pipelineConfig)) {
+        return false;
+    }
+
+    std::vector<BindGroupLayoutEntry> groupLayoutEntries(8, Default);
+    for (uint32_t binding = 0; binding < groupLayoutEntries.size(); ++binding) {
+        groupLayoutEntries[binding].binding = binding;
+        groupLayoutEntries[binding].visibility = ShaderStage::Compute;
+    }
+    groupLayoutEntries[0].buffer.type = BufferBindingType::Uniform;
+    groupLayoutEntries[0].buffer.minBindingSize = sizeof(FrameUniforms);
+    groupLayoutEntries[1].buffer.type = BufferBindingType::ReadOnlyStorage;
+    groupLayoutEntries[2].buffer.type = BufferBindingType::Storage;
+    groupLayoutEntries[3].buffer.type = BufferBindingType::Uniform;
+    groupLayoutEntries[3].buffer.minBindingSize = 16u;
+    groupLayoutEntries[4].buffer.type = BufferBindingType::ReadOnlyStorage;
+    groupLayoutEntries[5].buffer.type = BufferBindingType::ReadOnlyStorage;
+    groupLayoutEntries[6].buffer.type = BufferBindingType::Storage;
+    groupLayoutEntries[7].buffer.type = BufferBindingType::Uniform;
+
+    BindGroupLayout groupBgl = r_.pip.createBindGroupLayout(kGroupCullBglName, groupLayoutEntries);
+    if (!groupBgl) {
+        return false;
+    }
+
+    ComputePipelineConfig groupPipelineConfig;
+    groupPipelineConfig.shaderPath = SHADER_DIR "/meshlet_group_cull.wgsl";
+    groupPipelineConfig.entryPoint = "cs_main";
+    groupPipelineConfig.bindGroupLayouts.push_back(groupBgl);
+    if (!r_.pip.createComputePipeline(kGroupCullPipelineName, groupPipelineConfig)) {
+        return false;
+    }
+
+    groupPipelineConfig.entryPoint = "cs_select_history";
+    if (!r_.pip.createComputePipeline(kGroupHistoryPipelineName, groupPipelineConfig)) {
+        return false;
+    }
 
-    return r_.pip.createComputePipeline(kCullPipelineName, pipelineConfig) != nullptr;
+    cullPipeline_ = r_.pip.getComputePipelineHandle(kCullPipelineName);
+    historyPipeline_ = r_.pip.getComputePipelineHandle(kHistoryPipelineName);
+    groupCullPipeline_ = r_.pip.getComputePipelineHandle(kGroupCullPipelineName);
+    groupHistoryPipeline_ = r_.pip.getComputePipelineHandle(kGroupHistoryPipelineName);
+    return true;
 }
 
 bool MeshletCullingPipeline::createBindGroup() {
     return createBindGroupForMeshBuffers(
-        MeshletManager::meshAabbBufferName(0),
+        MeshletManager::meshMetadataBufferName(0),
         MeshletManager::visibleMeshletIndexBufferName(0),
-        activeHiZViewName_.c_str()
+        MeshletManager::prepassDrawChunkBufferName(0),
+        MeshletManager::meshGroupBufferName(0),
+        MeshletManager::candidateMeshletBufferName(0)
     );
 }
 
-bool MeshletCullingPipeline::createBindGroupForMeshBuffers(const std::string& meshletAabbBufferName,
+bool MeshletCullingPipeline::createBindGroupForMeshBuffers(const std::string& metadataBufferName,
                                                            const std::string& visibleIndicesBufferName,
-                                                           const char* occlusionHiZViewName) {
+                                                           const std::string& prepassChunksBufferName,
+                                                           const std::string& groupBufferName,
+                                                           const std::string& candidateBufferName) {
     BindGroupLayout cullBgl = r_.pip.getBindGroupLayout(kCullBglName);
     if (!cullBgl) {
         return false;
     }
 
     Buffer uniformBuffer = r_.buf.getBuffer("uniform_buffer");
-    Buffer meshletAabbBuffer = r_.buf.getBuffer(meshletAabbBufferName);
+    Buffer metadataBuffer = r_.buf.getBuffer(metadataBufferName);
     Buffer visibleIndicesBuffer = r_.buf.getBuffer(visibleIndicesBufferName);
     Buffer drawArgsBuffer = r_.buf.getBuffer(kIndirectArgsBufferName);
     Buffer cullParamsBuffer = r_.buf.getBuffer(kCullParamsBufferName);
-    TextureView occlusionHiZView = r_.tex.getTextureView(
-        (occlusionHiZViewName != nullptr) ? occlusionHiZViewName : kDefaultHiZViewName
-    );
-
-    if (!uniformBuffer || !meshletAabbBuffer || !visibleIndicesBuffer ||
-        !drawArgsBuffer || !cullParamsBuffer || !occlusionHiZView) {
+    Buffer visibilityBuffer = r_.buf.getBuffer(kVisibilityBufferName);
+    Buffer prepassChunksBuffer = r_.buf.getBuffer(prepassChunksBufferName);
+    Buffer prepassArgsBuffer = r_.buf.getBuffer(kPrepassIndirectArgsBufferName);
+    Buffer groupBuffer = r_.buf.getBuffer(groupBufferName);
+    Buffer candidateBuffer = r_.buf.getBuffer(candidateBufferName);
+    Buffer hizPyramidBuffer = r_.buf.getBuffer(MeshletOcclusionPipeline::kHiZPyramidBufferName);
+    Buffer hizParamsBuffer = r_.buf.getBuffer(MeshletOcclusionPipeline::kHiZParamsBufferName);
+
+    if (!uniformBuffer || !metadataBuffer || !visibleIndicesBuffer ||
+        !drawArgsBuffer || !cullParamsBuffer || !hizPyramidBuffer || !hizParamsBuffer ||
+        !visibilityBuffer || !prepassChunksBuffer || !prepassArgsBuffer ||
+        !groupBuffer || !candidateBuffer) {
         return false;
     }
 
-    std::vector<BindGroupEntry> entries(6, Default);
+    std::vector<BindGroupEntry> entries(11, Default);
     entries[0].binding = 0;
     entries[0].buffer = uniformBuffer;
     entries[0].offset = 0;
     entries[0].size = sizeof(FrameUniforms);
 
     entries[1].binding = 1;
-    entries[1].buffer = meshletAabbBuffer;
+    entries[1].buffer = metadataBuffer;
     entries[1].offset = 0;
-    entries[1].size = meshletAabbBuffer.getSize();
+    entries[1].size = metadataBuffer.getSize();
 
     entries[2].binding = 2;
     entries[2].buffer = visibleIndicesBuffer;
@@ -193,51 +300,190 @@ bool MeshletCullingPipeline::createBindGroupForMeshBuffers(const std::string& me
     entries[4].size = 16u;
 
     entries[5].binding = 5;
-    entries[5].textureView = occlusionHiZView;
+    entries[5].buffer = hizPyramidBuffer;
+    entries[5].offset = 0;
+    entries[5].size = hizPyramidBuffer.getSize();
+
+    entries[6].binding = 6;
+    entries[6].buffer = visibilityBuffer;
+    entries[6].offset = 0;
+    entries[6].size = visibilityBuffer.getSize();
+
+    entries[7].binding = 7;
+    entries[7].buffer = prepassChunksBuffer;
+    entries[7].offset = 0;
+    entries[7].size = prepassChunksBuffer.getSize();
+
+    entries[8].binding = 8;
+    entries[8].buffer = prepassArgsBuffer;
+    entries[8].offset = 0;
+    entries[8].size = prepassArgsBuffer.getSize();
+
+    entries[9].binding = 9;
+    entries[9].buffer = candidateBuffer;
+    entries[9].offset = 0;
+    entries[9].size = candidateBuffer.getSize();
+
+    entries[10].binding = 10;
+    entries[10].buffer = hizParamsBuffer;
+    entries[10].offset = 0;
+    entries[10].size = hizParamsBuffer.getSize();
+
+    const uint64_t uniformKey = r_.buf.getBufferHandle("uniform_buffer").key();
+    const uint64_t metadataKey = r_.buf.getBufferHandle(metadataBufferName).key();
+    const uint64_t cullParamsKey = r_.buf.getBufferHandle(kCullParamsBufferName).key();
+    const uint64_t hizPyramidKey = r_.buf.getBufferHandle(MeshletOcclusionPipeline::kHiZPyramidBufferName).key();
+    const uint64_t hizParamsKey = r_.buf.getBufferHandle(MeshletOcclusionPipeline::kHiZParamsBufferName).key();
+    const uint64_t visibilityKey = r_.buf.getBufferHandle(kVisibilityBufferName).key();
+    const uint64_t candidateKey = r_.buf.getBufferHandle(candidateBufferName).key();
+
+    const std::vector<uint64_t> resourceKeys = {
+        uniformKey,
+        metadataKey,
+        r_.buf.getBufferHandle(visibleIndicesBufferName).key(),
+        r_.buf.getBufferHandle(kIndirectArgsBufferName).key(),
+        cullParamsKey,
+        hizPyramidKey,
+        visibilityKey,
+        r_.buf.getBufferHandle(prepassChunksBufferName).key(),
+        r_.buf.getBufferHandle(kPrepassIndirectArgsBufferName).key(),
+        candidateKey,
+        hizParamsKey
+    };
+    if (!r_.pip.getOrCreateBindGroup(kCullBgName, kCullBglName, entries, resourceKeys)) {
+        return false;
+    }
+    cullBindGroup_ = r_.pip.getBindGroupHandle(kCullBgName);
+    candidateBuffer_ = r_.buf.getBufferHandle(candidateBufferName);
+
+    std::vector<BindGroupEntry> groupEntries(8, Default);
+    groupEntries[0].binding = 0;
+    groupEntries[0].buffer = uniformBuffer;
+    groupEntries[0].offset = 0;
+    groupEntries[0].size = sizeof(FrameUniforms);
+
+    groupEntries[1].binding = 1;
+    groupEntries[1].buffer = groupBuffer;
+    groupEntries[1].offset = 0;
+    groupEntries[1].size = groupBuffer.getSize();
+
+    groupEntries[2].binding = 2;
+    groupEntries[2].buffer = candidateBuffer;
+    groupEntries[2].offset = 0;
+    groupEntries[2].size = candidateBuffer.getSize();
+
+    groupEntries[3].binding = 3;
+    groupEntries[3].buffer = cullParamsBuffer;
+    groupEntries[3].offset = 0;
+    groupEntries[3].size = 16u;
+
+    groupEntries[4].binding = 4;
+    groupEntries[4].buffer = hizPyramidBuffer;
+    groupEntries[4].offset = 0;
+    groupEntries[4].size = hizPyramidBuffer.getSize();
+
+    groupEntries[5].binding = 5;
+    groupEntries[5].buffer = metadataBuffer;
+    groupEntries[5].offset = 0;
+    groupEntries[5].size = metadataBuffer.getSize();
+
+    groupEntries[6].binding = 6;
+    groupEntries[6].buffer = visibilityBuffer;
+    groupEntries[6].offset = 0;
+    groupEntries[6].size = visibilityBuffer.getSize();
+
+    groupEntries[7].binding = 7;
+    groupEntries[7].buffer = hizParamsBuffer;
+    groupEntries[7].offset = 0;
+    groupEntries[7].size = hizParamsBuffer.getSize();
+
+    const std::vector<uint64_t> groupResourceKeys = {
+        uniformKey,
+        r_.buf.getBufferHandle(groupBufferName).key(),
+        candidateKey,
+        cullParamsKey,
+        hizPyramidKey,
+        metadataKey,
+        visibilityKey,
+        hizParamsKey
+    };
+    if (!r_.pip.getOrCreateBindGroup(kGroupCullBgName, kGroupCullBglName, groupEntries, groupResourceKeys)) {
+        return false;
+    }
+    groupCullBindGroup_ = r_.pip.getBindGroupHandle(kGroupCullBgName);
+    return true;
+}
 
-    r_.pip.deleteBindGroup(kCullBgName);
-    return r_.pip.createBindGroup(kCullBgName, kCullBglName, entries) != nullptr;
+void MeshletCullingPipeline::updateCullParams(uint32_t meshletCount,
+                                              uint32_t groupCount,
+                                              uint32_t occlusionHiZMipCount) {
+    const uint32_t params[4] = {meshletCount, std::max(occlusionHiZMipCount, 1u), groupCount, 0u};
+    r_.buf.writeBuffer(cullParamsBuffer_, 0u, params, sizeof(params));
 }
 
-void MeshletCullingPipeline::updateCullParams(uint32_t meshletCount, uint32_t occlusionHiZMipCount) {
-    const uint32_t params[4] = {meshletCount, std::max(occlusionHiZMipCount, 1u), 0u, 0u};
-    r_.buf.writeBuffer(kCullParamsBufferName, 0u, params, sizeof(params));
+void MeshletCullingPipeline::encodeHistory(CommandEncoder encoder,
+                                           const MeshletBufferController& meshletBuffers) {
+    dispatchCull(encoder, meshletBuffers, groupHistoryPipeline_, historyPipeline_, prepassIndirectArgsBuffer_);
 }
 
 void MeshletCullingPipeline::encode(CommandEncoder encoder,
                                     const MeshletBufferController& meshletBuffers) {
-    ComputePipeline cullPipeline = r_.pip.getComputePipeline(kCullPipelineName);
-    BindGroup cullBindGroup = r_.pip.getBindGroup(kCullBgName);
-    if (!cullPipeline || !cullBindGroup) {
+    dispatchCull(encoder, meshletBuffers, groupCullPipeline_, cullPipeline_, indirectArgsBuffer_);
+}
+
+void MeshletCullingPipeline::dispatchCull(CommandEncoder encoder,
+                                          const MeshletBufferController& meshletBuffers,
+                                          ComputePipelineHandle groupPipelineHandle,
+                                          ComputePipelineHandle meshletPipelineHandle,
+                                          BufferHandle argsBufferHandle) {
+    ComputePipeline groupPipeline = r_.pip.getComputePipeline(groupPipelineHandle);
+    ComputePipeline meshletPipeline = r_.pip.getComputePipeline(meshletPipelineHandle);
+    BindGroup groupBindGroup = r_.pip.getBindGroup(groupCullBindGroup_);
+    BindGroup cullBindGroup = r_.pip.getBindGroup(cullBindGroup_);
+    if (!groupPipeline || !meshletPipeline || !groupBindGroup || !cullBindGroup) {
         return;
     }
 
-    Buffer resetBuffer = r_.buf.getBuffer(kIndirectResetBufferName);
-    Buffer indirectArgsBuffer = r_.buf.getBuffer(kIndirectArgsBufferName);
-    if (!resetBuffer || !indirectArgsBuffer) {
+    Buffer resetBuffer = r_.buf.getBuffer(indirectResetBuffer_);
+    Buffer argsBuffer = r_.buf.getBuffer(argsBufferHandle);
+    Buffer candidateResetBuffer = r_.buf.getBuffer(candidateResetBuffer_);
+    Buffer candidateBuffer = r_.buf.getBuffer(candidateBuffer_);
+    if (!resetBuffer || !argsBuffer || !candidateResetBuffer || !candidateBuffer) {
         return;
     }
 
     encoder.copyBufferToBuffer(
         resetBuffer,
         0u,
-        indirectArgsBuffer,
+        argsBuffer,
         0u,
-        sizeof(uint32_t) * 4u
+        sizeof(uint32_t) * kIndirectArgsWordCount
     );
 
-    const uint32_t meshletCount = meshletBuffers.effectiveMeshletCountForPasses();
-    if (meshletCount == 0u) {
+    const uint32_t groupCount = meshletBuffers.meshletGroupCount();
+    if (meshletBuffers.effectiveMeshletCountForPasses() == 0u || groupCount == 0u) {
         return;
     }
 
+    encoder.copyBufferToBuffer(
+        candidateResetBuffer,
+        0u,
+        candidateBuffer,
+        0u,
+        sizeof(uint32_t) * MESHLET_CANDIDATE_HEADER_WORDS
+    );
+
+    // Dispatch usage scopes are per dispatch, so the candidate list written by the group pass can
+    // drive the indirect meshlet dispatch within the same compute pass.
     ComputePassDescriptor passDesc = Default;
     ComputePassEncoder pass = encoder.beginComputePass(passDesc);
-    pass.setPipeline(cullPipeline);
+    pass.setPipeline(groupPipeline);
+    pass.setBindGroup(0, groupBindGroup, 0, nullptr);
+    pass.dispatchWorkgroups((groupCount + kGroupCullWorkgroupSize - 1u) / kGroupCullWorkgroupSize, 1u, 1u);
+
+    pass.setPipeline(meshletPipeline);
     pass.setBindGroup(0, cullBindGroup, 0, nullptr);
-    const uint32_t workgroupCount =
-        (meshletCount + kMeshletCullWorkgroupSize - 1u) / kMeshletCullWorkgroupSize;
-    pass.dispatchWorkgroups(workgroupCount, 1u, 1u);
+    pass.dispatchWorkgroupsIndirect(candidateBuffer, 0u);
     pass.end();
     pass.release();
 }
@@ -14,26 +14,26 @@ uint32_t MeshletOcclusionPipeline::computeMipCount(uint32_t width, uint32_t heig
     uint32_t w = std::max(width, 1u);
     uint32_t h = std::max(height, 1u);
     while (w > 1u || h > 1u) {
-        w = std::max(1u, w / 2u);
-        h = std::max(1u, h / 2u);
+        w = (w + 1u) / 2u;
+        h = (h + 1u) / 2u;
         ++mipCount;
     }
     return mipCount;
 }
 
 bool MeshletOcclusionPipeline::build() {
-    return createResources() && createPipeline() && createBindGroup();
+    return createResources() && createPipeline() && createHierarchyBindGroup() && createBindGroup();
 }
 
 bool MeshletOcclusionPipeline::build(const MeshletBufferController& meshletBuffers) {
-    if (!createResources() || !createPipeline()) {
+    if (!createResources() || !createPipeline() || !createHierarchyBindGroup()) {
         return false;
     }
     return refreshMeshBindGroup(meshletBuffers);
 }
 
 bool MeshletOcclusionPipeline::recreateResources(const MeshletBufferController& meshletBuffers) {
-    if (!createResources()) {
+    if (!createResources() || !createHierarchyBindGroup()) {
         return false;
     }
     return refreshMeshBindGroup(meshletBuffers);
@@ -46,21 +46,39 @@ bool MeshletOcclusionPipeline::refreshMeshBindGroup(const MeshletBufferControlle
 
     return createBindGroupForMeshBuffers(
         meshletBuffers.activeMeshDataBufferName(),
-        meshletBuffers.activeMeshMetadataBufferName()
+        meshletBuffers.activeMeshMetadataBufferName(),
+        meshletBuffers.activePrepassDrawChunkBufferName()
     );
 }
 
 bool MeshletOcclusionPipeline::createResources() {
-    r_.tex.removeTextureView(kOcclusionHiZViewName);
-    r_.tex.removeTexture(kOcclusionHiZTextureName);
     r_.tex.removeTextureView(kOcclusionDepthViewName);
     r_.tex.removeTexture(kOcclusionDepthTextureName);
 
-    const uint32_t width = std::max(1, r_.ctx.width / static_cast<int>(kOcclusionDepthDownsample));
-    const uint32_t height = std::max(1, r_.ctx.height / static_cast<int>(kOcclusionDepthDownsample));
+    // Culling works in UV space, so clamping the extent only coarsens the occlusion buffer.
+    const uint32_t width = std::min(
+        static_cast<uint32_t>(std::max(1, r_.ctx.width / static_cast<int>(kOcclusionDepthDownsample))),
+        kMaxOcclusionDepthExtent
+    );
+    const uint32_t height = std::min(
+        static_cast<uint32_t>(std::max(1, r_.ctx.height / static_cast<int>(kOcclusionDepthDownsample))),
+        kMaxOcclusionDepthExtent
+    );
     occlusionDepthWidth_ = width;
     occlusionDepthHeight_ = height;
-    occlusionHiZMipCount_ = computeMipCount(width, height);
+    occlusionHiZMipCount_ = std::min(computeMipCount(width, height), kMaxHiZMips);
+
+    // Sizes round up so the last row and column of an odd-sized level still reach the next mip.
+    uint32_t pyramidWordCount = 0u;
+    for (uint32_t mip = 0; mip < kMaxHiZMips; ++mip) {
+        HiZMipLayout& layout = hizMipLayouts_[mip];
+        layout.width = (width + (1u << mip) - 1u) >> mip;
+        layout.height = (height + (1u << mip) - 1u) >> mip;
+        layout.offset = pyramidWordCount;
+        if (mip < occlusionHiZMipCount_) {
+            pyramidWordCount += layout.width * layout.height;
+        }
+    }
 
     TextureDescriptor depthDesc = Default;
     depthDesc.label = StringView("meshlet occlusion depth texture");
@@ -91,40 +109,58 @@ bool MeshletOcclusionPipeline::createResources() {
         return false;
     }
 
-    TextureDescriptor hizDesc = Default;
-    hizDesc.label = StringView("meshlet occlusion hiz texture");
-    hizDesc.dimension = TextureDimension::_2D;
-    hizDesc.format = TextureFormat::R32Float;
-    hizDesc.mipLevelCount = occlusionHiZMipCount_;
-    hizDesc.sampleCount = 1;
-    hizDesc.size = {width, height, 1};
-    hizDesc.usage = TextureUsage::TextureBinding | TextureUsage::StorageBinding;
-    hizDesc.viewFormatCount = 0;
-    hizDesc.viewFormats = nullptr;
-    if (!r_.tex.createTexture(kOcclusionHiZTextureName, hizDesc)) {
+    // The cull shaders read the pyramid buffer directly; a sampled texture would need a copy per mip.
+    BufferDescriptor pyramidDesc = Default;
+    pyramidDesc.label = StringView("meshlet hiz pyramid buffer");
+    pyramidDesc.size = static_cast<uint64_t>(pyramidWordCount) * sizeof(float);
+    pyramidDesc.usage = BufferUsage::Storage;
+    pyramidDesc.mappedAtCreation = false;
+    if (!r_.buf.createBuffer(kHiZPyramidBufferName, pyramidDesc)) {
+        return false;
+    }
+
+    // Created zeroed; the tail workgroup resets the counter after every dispatch.
+    BufferDescriptor syncDesc = Default;
+    syncDesc.label = StringView("meshlet hiz spd sync buffer");
+    syncDesc.size = static_cast<uint64_t>(kHiZSyncWordCount) * sizeof(uint32_t);
+    syncDesc.usage = BufferUsage::Storage;
+    syncDesc.mappedAtCreation = false;
+    if (!r_.buf.createBuffer(kHiZSyncBufferName, syncDesc)) {
+        return false;
+    }
+
+    const uint32_t workgroupsX = (width + kHiZSpdTileTexels - 1u) / kHiZSpdTileTexels;
+    const uint32_t workgroupsY = (height + kHiZSpdTileTexels - 1u) / kHiZSpdTileTexels;
+    std::array<uint32_t, 4u + kMaxHiZMips * 4u> params{};
+    params[0] = occlusionHiZMipCount_;
+    params[1] = workgroupsX * workgroupsY;
+    for (uint32_t mip = 0; mip < kMaxHiZMips; ++mip) {
+        params[4u + mip * 4u + 0u] = hizMipLayouts_[mip].offset;
+        params[4u + mip * 4u + 1u] = hizMipLayouts_[mip].width;
+        params[4u + mip * 4u + 2u] = hizMipLayouts_[mip].height;
+    }
+
+    BufferDescriptor paramsDesc = Default;
+    paramsDesc.label = StringView("meshlet hiz spd params buffer");
+    paramsDesc.size = sizeof(params);
+    paramsDesc.usage = BufferUsage::Uniform | BufferUsage::CopyDst;
+    paramsDesc.mappedAtCreation = false;
+    if (!r_.buf.createBuffer(kHiZParamsBufferName, paramsDesc)) {
         return false;
     }
+    r_.buf.writeBuffer(kHiZParamsBufferName, 0u, params.data(), sizeof(params));
 
-    TextureViewDescriptor hizViewDesc = Default;
-    hizViewDesc.aspect = TextureAspect::All;
-    hizViewDesc.baseArrayLayer = 0;
-    hizViewDesc.arrayLayerCount = 1;
-    hizViewDesc.baseMipLevel = 0;
-    hizViewDesc.mipLevelCount = occlusionHiZMipCount_;
-    hizViewDesc.dimension = TextureViewDimension::_2D;
-    hizViewDesc.format = TextureFormat::R32Float;
-    return r_.tex.createTextureView(
-               kOcclusionHiZTextureName,
-               kOcclusionHiZViewName,
-               hizViewDesc
-           ) != nullptr;
+    occlusionDepthView_ = r_.tex.getTextureViewHandle(kOcclusionDepthViewName);
+    return true;
 }
 
 void MeshletOcclusionPipeline::removeResources() {
     r_.pip.deleteBindGroup(kDepthPrepassBgName);
+    r_.pip.deleteBindGroup(kHiZSpdBgName);
+    r_.buf.deleteBuffer(kHiZPyramidBufferName);
+    r_.buf.deleteBuffer(kHiZSyncBufferName);
+    r_.buf.deleteBuffer(kHiZParamsBufferName);
 
-    r_.tex.removeTextureView(kOcclusionHiZViewName);
-    r_.tex.removeTexture(kOcclusionHiZTextureName);
     r_.tex.removeTextureView(kOcclusionDepthViewName);
     r_.tex.removeTexture(kOcclusionDepthTextureName);
 
@@ -134,7 +170,7 @@ void MeshletOcclusionPipeline::removeResources() {
 }
 
 bool MeshletOcclusionPipeline::createPipeline() {
-    std::vector<BindGroupLayoutEntry> prepassLayoutEntries(3, Default);
+    std::vector<BindGroupLayoutEntry> prepassLayoutEntries(4, Default);
     prepassLayoutEntries[0].binding = 0;
     prepassLayoutEntries[0].visibility = ShaderStage::Vertex;
     prepassLayoutEntries[0].buffer.type = BufferBindingType::Uniform;
@@ -148,6 +184,10 @@ bool MeshletOcclusionPipeline::createPipeline() {
     prepassLayoutEntries[2].visibility = ShaderStage::Vertex;
     prepassLayoutEntries[2].buffer.type = BufferBindingType::ReadOnlyStorage;
 
+    prepassLayoutEntries[3].binding = 3;
+    prepassLayoutEntries[3].visibility = ShaderStage::Vertex;
+    prepassLayoutEntries[3].buffer.type = BufferBindingType::ReadOnlyStorage;
+
     BindGroupLayout prepassBgl = r_.pip.createBindGroupLayout(kDepthPrepassBglName, prepassLayoutEntries);
     if (!prepassBgl) {
         return false;
@@ -171,75 +211,96 @@ bool MeshletOcclusionPipeline::createPipeline() {
         return false;
     }
 
-    std::vector<BindGroupLayoutEntry> hizSeedLayoutEntries(2, Default);
-    hizSeedLayoutEntries[0].binding = 0;
-    hizSeedLayoutEntries[0].visibility = ShaderStage::Compute;
-    hizSeedLayoutEntries[0].texture.sampleType = TextureSampleType::Depth;
-    hizSeedLayoutEntries[0].texture.viewDimension = TextureViewDimension::_2D;
-    hizSeedLayoutEntries[1].binding = 1;
-    hizSeedLayoutEntries[1].visibility = ShaderStage::Compute;
-    hizSeedLayoutEntries[1].storageTexture.access = StorageTextureAccess::WriteOnly;
-    hizSeedLayoutEntries[1].storageTexture.format = TextureFormat::R32Float;
-    hizSeedLayoutEntries[1].storageTexture.viewDimension = TextureViewDimension::_2D;
-
-    BindGroupLayout hizSeedBgl = r_.pip.createBindGroupLayout(kHiZSeedBglName, hizSeedLayoutEntries);
-    if (!hizSeedBgl) {
-        return false;
+    std::vector<BindGroupLayoutEntry> spdLayoutEntries(4, Default);
+    for (uint32_t binding = 0; binding < spdLayoutEntries.size(); ++binding) {
+        spdLayoutEntries[binding].binding = binding;
+        spdLayoutEntries[binding].visibility = ShaderStage::Compute;
     }
-
-    std::vector<BindGroupLayoutEntry> hizDownsampleLayoutEntries(2, Default);
-    hizDownsampleLayoutEntries[0].binding = 0;
-    hizDownsampleLayoutEntries[0].visibility = ShaderStage::Compute;
-    hizDownsampleLayoutEntries[0].texture.sampleType = TextureSampleType::UnfilterableFloat;
-    hizDownsampleLayoutEntries[0].texture.viewDimension = TextureViewDimension::_2D;
-    hizDownsampleLayoutEntries[1].binding = 1;
-    hizDownsampleLayoutEntries[1].visibility = ShaderStage::Compute;
-    hizDownsampleLayoutEntries[1].storageTexture.access = StorageTextureAccess::WriteOnly;
-    hizDownsampleLayoutEntries[1].storageTexture.format = TextureFormat::R32Float;
-    hizDownsampleLayoutEntries[1].storageTexture.viewDimension = TextureViewDimension::_2D;
-
-    BindGroupLayout hizDownsampleBgl =
-        r_.pip.createBindGroupLayout(kHiZDownsampleBglName, hizDownsampleLayoutEntries);
-    if (!hizDownsampleBgl) {
+    spdLayoutEntries[0].texture.sampleType = TextureSampleType::Depth;
+    spdLayoutEntries[0].texture.viewDimension = TextureViewDimension::_2D;
+    spdLayoutEntries[1].buffer.type = BufferBindingType::Storage;
+    spdLayoutEntries[2].buffer.type = BufferBindingType::Storage;
+    spdLayoutEntries[3].buffer.type = BufferBindingType::Uniform;
+
+    BindGroupLayout spdBgl = r_.pip.createBindGroupLayout(kHiZSpdBglName, spdLayoutEntries);
+    if (!spdBgl) {
         return false;
     }
 
-    ComputePipelineConfig seedConfig;
-    seedConfig.shaderPath = SHADER_DIR "/meshlet_hiz_seed.wgsl";
-    seedConfig.entryPoint = "cs_main";
-    seedConfig.bindGroupLayouts.push_back(hizSeedBgl);
-    if (!r_.pip.createComputePipeline(kHiZSeedPipelineName, seedConfig)) {
-        return false;
-    }
-
-    ComputePipelineConfig downsampleConfig;
-    downsampleConfig.shaderPath = SHADER_DIR "/meshlet_hiz_downsample.wgsl";
-    downsampleConfig.entryPoint = "cs_main";
-    downsampleConfig.bindGroupLayouts.push_back(hizDownsampleBgl);
-    if (!r_.pip.createComputePipeline(kHiZDownsamplePipelineName, downsampleConfig)) {
+    ComputePipelineConfig spdConfig;
+    spdConfig.shaderPath = SHADER_DIR "/meshlet_hiz_spd.wgsl";
+    spdConfig.entryPoint = "cs_main";
+    spdConfig.bindGroupLayouts.push_back(spdBgl);
+    if (!r_.pip.createComputePipeline(kHiZSpdPipelineName, spdConfig)) {
         return false;
     }
 
+    prepassPipeline_ = r_.pip.getPipelineHandle(kDepthPrepassPipelineName);
+    spdPipeline_ = r_.pip.getComputePipelineHandle(kHiZSpdPipelineName);
     return true;
 }
 
 bool MeshletOcclusionPipeline::createBindGroup() {
     return createBindGroupForMeshBuffers(
         MeshletManager::meshDataBufferName(0),
-        MeshletManager::meshMetadataBufferName(0)
+        MeshletManager::meshMetadataBufferName(0),
+        MeshletManager::prepassDrawChunkBufferName(0)
     );
 }
 
+bool MeshletOcclusionPipeline::createHierarchyBindGroup() {
+    TextureView depthView = r_.tex.getTextureView(kOcclusionDepthViewName);
+    Buffer pyramidBuffer = r_.buf.getBuffer(kHiZPyramidBufferName);
+    Buffer syncBuffer = r_.buf.getBuffer(kHiZSyncBufferName);
+    Buffer paramsBuffer = r_.buf.getBuffer(kHiZParamsBufferName);
+    if (!depthView || !pyramidBuffer || !syncBuffer || !paramsBuffer) {
+        return false;
+    }
+
+    std::vector<BindGroupEntry> entries(4, Default);
+    entries[0].binding = 0;
+    entries[0].textureView = depthView;
+
+    entries[1].binding = 1;
+    entries[1].buffer = pyramidBuffer;
+    entries[1].offset = 0;
+    entries[1].size = pyramidBuffer.getSize();
+
+    entries[2].binding = 2;
+    entries[2].buffer = syncBuffer;
+    entries[2].offset = 0;
+    entries[2].size = syncBuffer.getSize();
+
+    entries[3].binding = 3;
+    entries[3].buffer = paramsBuffer;
+    entries[3].offset = 0;
+    entries[3].size = paramsBuffer.getSize();
+
+    const std::vector<uint64_t> resourceKeys = {
+        r_.tex.getTextureViewHandle(kOcclusionDepthViewName).key(),
+        r_.buf.getBufferHandle(kHiZPyramidBufferName).key(),
+        r_.buf.getBufferHandle(kHiZSyncBufferName).key(),
+        r_.buf.getBufferHandle(kHiZParamsBufferName).key()
+    };
+    if (!r_.pip.getOrCreateBindGroup(kHiZSpdBgName, kHiZSpdBglName, entries, resourceKeys)) {
+        return false;
+    }
+    spdBindGroup_ = r_.pip.getBindGroupHandle(kHiZSpdBgName);
+    return true;
+}
+
 bool MeshletOcclusionPipeline::createBindGroupForMeshBuffers(const std::string& meshDataBufferName,
-                                                             const std::string& metadataBufferName) {
+                                                             const std::string& metadataBufferName,
+                                                             const std::string& drawChunkBufferName) {
     Buffer uniformBuffer = r_.buf.getBuffer("uniform_buffer");
     Buffer meshDataBuffer = r_.buf.getBuffer(meshDataBufferName);
     Buffer metadataBuffer = r_.buf.getBuffer(metadataBufferName);
-    if (!uniformBuffer || !meshDataBuffer || !metadataBuffer) {
+    Buffer drawChunkBuffer = r_.buf.getBuffer(drawChunkBufferName);
+    if (!uniformBuffer || !meshDataBuffer || !metadataBuffer || !drawChunkBuffer) {
         return false;
     }
 
-    std::vector<BindGroupEntry> entries(3, Default);
+    std::vector<BindGroupEntry> entries(4, Default);
     entries[0].binding = 0;
     entries[0].buffer = uniformBuffer;
     entries[0].offset = 0;
@@ -255,27 +316,43 @@ bool MeshletOcclusionPipeline::createBindGroupForMeshBuffers(const std::string&
     entries[2].offset = 0;
     entries[2].size = metadataBuffer.getSize();
 
-    r_.pip.deleteBindGroup(kDepthPrepassBgName);
-    return r_.pip.createBindGroup(kDepthPrepassBgName, kDepthPrepassBglName, entries) != nullptr;
+    entries[3].binding = 3;
+    entries[3].buffer = drawChunkBuffer;
+    entries[3].offset = 0;
+    entries[3].size = drawChunkBuffer.getSize();
+
+    const std::vector<uint64_t> resourceKeys = {
+        r_.buf.getBufferHandle("uniform_buffer").key(),
+        r_.buf.getBufferHandle(meshDataBufferName).key(),
+        r_.buf.getBufferHandle(metadataBufferName).key(),
+        r_.buf.getBufferHandle(drawChunkBufferName).key()
+    };
+    if (!r_.pip.getOrCreateBindGroup(kDepthPrepassBgName, kDepthPrepassBglName, entries, resourceKeys)) {
+        return false;
+    }
+    prepassBindGroup_ = r_.pip.getBindGroupHandle(kDepthPrepassBgName);
+    quadIndexBuffer_ = r_.buf.getBufferHandle(MeshletBufferController::kQuadIndexBufferName);
+    return true;
 }
 
 void MeshletOcclusionPipeline::encodeDepthPrepass(CommandEncoder encoder,
-                                                  const MeshletBufferController& meshletBuffers) {
-    RenderPipeline prepassPipeline = r_.pip.getPipeline(kDepthPrepassPipelineName);
-    BindGroup prepassBindGroup = r_.pip.getBindGroup(kDepthPrepassBgName);
+                                                  const MeshletBufferController& meshletBuffers,
+                                                  BufferHandle indirectArgsBufferHandle) {
+    RenderPipeline prepassPipeline = r_.pip.getPipeline(prepassPipeline_);
+    BindGroup prepassBindGroup = r_.pip.getBindGroup(prepassBindGroup_);
     if (!prepassPipeline || !prepassBindGroup) {
         return;
     }
 
-    const uint32_t meshletCount = meshletBuffers.effectiveMeshletCountForPasses();
-    if (meshletCount == 0u) {
+    TextureView occlusionDepthView = r_.tex.getTextureView(occlusionDepthView_);
+    Buffer quadIndexBuffer = r_.buf.getBuffer(quadIndexBuffer_);
+    Buffer indirectArgsBuffer = r_.buf.getBuffer(indirectArgsBufferHandle);
+    if (!occlusionDepthView || !quadIndexBuffer || !indirectArgsBuffer) {
         return;
     }
 
-    TextureView occlusionDepthView = r_.tex.getTextureView(kOcclusionDepthViewName);
-    if (!occlusionDepthView) {
-        return;
-    }
+    // The pass still runs with nothing to draw so the Hi-Z seed reads a cleared depth buffer.
+    const bool hasMeshlets = meshletBuffers.drawChunkCount() > 0u;
 
     RenderPassDepthStencilAttachment depthAttachment = Default;
     depthAttachment.view = occlusionDepthView;
@@ -295,124 +372,32 @@ void MeshletOcclusionPipeline::encodeDepthPrepass(CommandEncoder encoder,
     passDesc.timestampWrites = nullptr;
 
     RenderPassEncoder pass = encoder.beginRenderPass(passDesc);
-    pass.setPipeline(prepassPipeline);
-    pass.setBindGroup(0, prepassBindGroup, 0, nullptr);
-    pass.draw(MESHLET_VERTEX_CAPACITY, meshletCount, 0, 0);
+    if (hasMeshlets) {
+        pass.setPipeline(prepassPipeline);
+        pass.setBindGroup(0, prepassBindGroup, 0, nullptr);
+        pass.setIndexBuffer(quadIndexBuffer, IndexFormat::Uint16, 0, quadIndexBuffer.getSize());
+        pass.drawIndexedIndirect(indirectArgsBuffer, 0u);
+    }
     pass.end();
     pass.release();
 }
 
 void MeshletOcclusionPipeline::encodeHierarchyPass(CommandEncoder encoder) {
-    ComputePipeline seedPipeline = r_.pip.getComputePipeline(kHiZSeedPipelineName);
-    ComputePipeline downsamplePipeline = r_.pip.getComputePipeline(kHiZDownsamplePipelineName);
-    BindGroupLayout seedBgl = r_.pip.getBindGroupLayout(kHiZSeedBglName);
-    BindGroupLayout downsampleBgl = r_.pip.getBindGroupLayout(kHiZDownsampleBglName);
-    if (!seedPipeline || !downsamplePipeline || !seedBgl || !downsampleBgl) {
+    ComputePipeline spdPipeline = r_.pip.getComputePipeline(spdPipeline_);
+    BindGroup spdBindGroup = r_.pip.getBindGroup(spdBindGroup_);
+    if (!spdPipeline || !spdBindGroup) {
         return;
     }
 
-    TextureView depthView = r_.tex.getTextureView(kOcclusionDepthViewName);
-    Texture hizTexture = r_.tex.getTexture(kOcclusionHiZTextureName);
-    if (!depthView || !hizTexture) {
-        return;
-    }
-
-    const uint32_t mipCount = std::max(occlusionHiZMipCount_, 1u);
-    const Device device = r_.ctx.getDevice();
-
-    auto createHizMipView = [hizTexture](uint32_t mipLevel) -> TextureView {
-        TextureViewDescriptor viewDesc = Default;
-        viewDesc.aspect = TextureAspect::All;
-        viewDesc.baseArrayLayer = 0;
-        viewDesc.arrayLayerCount = 1;
-        viewDesc.baseMipLevel = mipLevel;
-        viewDesc.mipLevelCount = 1;
-        viewDesc.dimension = TextureViewDimension::_2D;
-        viewDesc.format = TextureFormat::R32Float;
-        return hizTexture.createView(viewDesc);
-    };
-
     ComputePassDescriptor passDesc = Default;
     ComputePassEncoder pass = encoder.beginComputePass(passDesc);
-
-    {
-        TextureView dstMip0View = createHizMipView(0u);
-        if (dstMip0View) {
-            std::array<BindGroupEntry, 2> entries{};
-            entries[0] = Default;
-            entries[0].binding = 0;
-            entries[0].textureView = depthView;
-            entries[1] = Default;
-            entries[1].binding = 1;
-            entries[1].textureView = dstMip0View;
-
-            BindGroupDescriptor bgDesc = Default;
-            bgDesc.label = StringView("meshlet hiz seed bg");
-            bgDesc.layout = seedBgl;
-            bgDesc.entryCount = static_cast<uint32_t>(entries.size());
-            bgDesc.entries = entries.data();
-            BindGroup bg = device.createBindGroup(bgDesc);
-
-            if (bg) {
-                pass.setPipeline(seedPipeline);
-                pass.setBindGroup(0, bg, 0, nullptr);
-                const uint32_t gx =
-                    (std::max(occlusionDepthWidth_, 1u) + kOcclusionHiZWorkgroupSize - 1u) /
-                    kOcclusionHiZWorkgroupSize;
-                const uint32_t gy =
-                    (std::max(occlusionDepthHeight_, 1u) + kOcclusionHiZWorkgroupSize - 1u) /
-                    kOcclusionHiZWorkgroupSize;
-                pass.dispatchWorkgroups(gx, gy, 1u);
-                bg.release();
-            }
-
-            dstMip0View.release();
-        }
-    }
-
-    for (uint32_t mip = 1u; mip < mipCount; ++mip) {
-        TextureView srcView = createHizMipView(mip - 1u);
-        TextureView dstView = createHizMipView(mip);
-        if (!srcView || !dstView) {
-            if (srcView) {
-                srcView.release();
-            }
-            if (dstView) {
-                dstView.release();
-            }
-            continue;
-        }
-
-        std::array<BindGroupEntry, 2> entries{};
-        entries[0] = Default;
-        entries[0].binding = 0;
-        entries[0].textureView = srcView;
-        entries[1] = Default;
-        entries[1].binding = 1;
-        entries[1].textureView = dstView;
-
-        BindGroupDescriptor bgDesc = Default;
-        bgDesc.label = StringView("meshlet hiz downsample bg");
-        bgDesc.layout = downsampleBgl;
-        bgDesc.entryCount = static_cast<uint32_t>(entries.size());
-        bgDesc.entries = entries.data();
-        BindGroup bg = device.createBindGroup(bgDesc);
-
-        if (bg) {
-            const uint32_t mipWidth = std::max(1u, occlusionDepthWidth_ >> mip);
-            const uint32_t mipHeight = std::max(1u, occlusionDepthHeight_ >> mip);
-            const uint32_t gx = (mipWidth + kOcclusionHiZWorkgroupSize - 1u) / kOcclusionHiZWorkgroupSize;
-            const uint32_t gy = (mipHeight + kOcclusionHiZWorkgroupSize - 1u) / kOcclusionHiZWorkgroupSize;
-            pass.setPipeline(downsamplePipeline);
-            pass.setBindGroup(0, bg, 0, nullptr);
-            pass.dispatchWorkgroups(gx, gy, 1u);
-            bg.release();
-        }
-
-        srcView.release();
-        dstView.release();
-    }
-
+    pass.setPipeline(spdPipeline);
+    pass.setBindGroup(0, spdBindGroup, 0, nullptr);
+    pass.dispatchWorkgroups(
+        (occlusionDepthWidth_ + kHiZSpdTileTexels - 1u) / kHiZSpdTileTexels,
+        (occlusionDepthHeight_ + kHiZSpdTileTexels - 1u) / kHiZSpdTileTexels,
+        1u
+    );
     pass.end();
     pass.release();
 }
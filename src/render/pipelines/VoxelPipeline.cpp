@@ -1,6 +1,7 @@
 #include "solum_engine/render/pipelines/VoxelPipeline.h"
 
 #include "solum_engine/render/MaterialManager.h"
+#include "solum_engine/render/MeshletBufferController.h"
 #include "solum_engine/render/MeshletManager.h"
 #include "solum_engine/render/Uniforms.h"
 
@@ -10,20 +11,19 @@ bool VoxelPipeline::build() {
     return createResources() && createPipeline() && createBindGroup();
 }
 
-void VoxelPipeline::setDrawConfig(uint32_t meshletVertices, uint32_t totalMeshletCount) {
-    meshletVertexCount = meshletVertices;
-    meshletCount = totalMeshletCount;
+void VoxelPipeline::setDrawConfig(uint32_t chunkCount) {
+    drawChunkCount = chunkCount;
 }
 
-void VoxelPipeline::setIndirectDrawBuffer(const std::string& bufferName, uint64_t offset) {
-    indirectDrawBufferName_ = bufferName;
+void VoxelPipeline::setIndirectDrawBuffer(BufferHandle buffer, uint64_t offset) {
+    indirectDrawBuffer_ = buffer;
     indirectDrawOffset_ = offset;
-    useIndirectDraw_ = !indirectDrawBufferName_.empty();
+    useIndirectDraw_ = indirectDrawBuffer_.valid();
 }
 
 void VoxelPipeline::clearIndirectDrawBuffer() {
     useIndirectDraw_ = false;
-    indirectDrawBufferName_.clear();
+    indirectDrawBuffer_ = BufferHandle{};
     indirectDrawOffset_ = 0u;
 }
 
@@ -83,6 +83,8 @@ bool VoxelPipeline::createResources() {
     multiSampleTextureViewDesc.format = multiSampleTextureFormat;
     TextureView multiSampleTextureView = r_.tex.createTextureView("multisample_texture", "multisample_view", multiSampleTextureViewDesc);
 
+    multisampleView_ = r_.tex.getTextureViewHandle("multisample_view");
+    depthView_ = r_.tex.getTextureViewHandle("depth_view");
     return multiSampleTextureView != nullptr && depthTextureView != nullptr;
 }
 
@@ -156,6 +158,7 @@ bool VoxelPipeline::createPipeline() {
     );
 
     RenderPipeline pipeline = r_.pip.createRenderPipeline("voxel_pipeline", config);
+    pipeline_ = r_.pip.getPipelineHandle("voxel_pipeline");
 
     return pipeline != nullptr;
 }
@@ -223,8 +226,18 @@ bool VoxelPipeline::createBindGroupForMeshBuffers(const std::string& meshDataBuf
     bindings[i].binding = i;
     bindings[i].sampler = materialSampler;
 
-    r_.pip.deleteBindGroup("global_uniforms_bg");
-    BindGroup bindGroup = r_.pip.createBindGroup("global_uniforms_bg", "global_uniforms", bindings);
+    const std::vector<uint64_t> resourceKeys = {
+        r_.buf.getBufferHandle("uniform_buffer").key(),
+        r_.buf.getBufferHandle(meshDataBufferName).key(),
+        r_.buf.getBufferHandle(metadataBufferName).key(),
+        r_.buf.getBufferHandle(MaterialManager::kMaterialLookupBufferName).key(),
+        r_.buf.getBufferHandle(visibleIndicesBufferName).key(),
+        r_.tex.getTextureViewHandle(MaterialManager::kMaterialTextureArrayViewName).key(),
+        r_.tex.getSamplerHandle(MaterialManager::kMaterialSamplerName).key()
+    };
+    BindGroup bindGroup = r_.pip.getOrCreateBindGroup("global_uniforms_bg", "global_uniforms", bindings, resourceKeys);
+    bindGroup_ = r_.pip.getBindGroupHandle("global_uniforms_bg");
+    quadIndexBuffer_ = r_.buf.getBufferHandle(MeshletBufferController::kQuadIndexBufferName);
 
     return bindGroup != nullptr;
 }
@@ -236,7 +249,7 @@ bool VoxelPipeline::render(
 ) {
     RenderPassDescriptor renderPassDesc = Default;
     RenderPassColorAttachment renderPassColorAttachment = {};
-    renderPassColorAttachment.view = r_.tex.getTextureView("multisample_view");
+    renderPassColorAttachment.view = r_.tex.getTextureView(multisampleView_);
     renderPassColorAttachment.resolveTarget = targetView;
     renderPassColorAttachment.loadOp = LoadOp::Clear;
     renderPassColorAttachment.storeOp = StoreOp::Store;
@@ -249,7 +262,7 @@ bool VoxelPipeline::render(
     renderPassDesc.colorAttachments = &renderPassColorAttachment;
 
     RenderPassDepthStencilAttachment depthStencilAttachment = Default;
-    depthStencilAttachment.view = r_.tex.getTextureView("depth_view");
+    depthStencilAttachment.view = r_.tex.getTextureView(depthView_);
     depthStencilAttachment.depthClearValue = 1.0f;
     depthStencilAttachment.depthLoadOp = LoadOp::Clear;
     depthStencilAttachment.depthStoreOp = StoreOp::Store;
@@ -263,19 +276,20 @@ bool VoxelPipeline::render(
     renderPassDesc.timestampWrites = nullptr;
 
     RenderPassEncoder voxelRenderPass = encoder.beginRenderPass(renderPassDesc);
-    voxelRenderPass.setPipeline(r_.pip.getPipeline("voxel_pipeline"));
+    voxelRenderPass.setPipeline(r_.pip.getPipeline(pipeline_));
+
+    voxelRenderPass.setBindGroup(0, r_.pip.getBindGroup(bindGroup_), 0, nullptr);
 
-    voxelRenderPass.setBindGroup(0, r_.pip.getBindGroup("global_uniforms_bg"), 0, nullptr);
+    Buffer quadIndexBuffer = r_.buf.getBuffer(quadIndexBuffer_);
+    if (quadIndexBuffer) {
+        voxelRenderPass.setIndexBuffer(quadIndexBuffer, IndexFormat::Uint16, 0, quadIndexBuffer.getSize());
 
-    if (useIndirectDraw_) {
-        Buffer indirectBuffer = r_.buf.getBuffer(indirectDrawBufferName_);
+        Buffer indirectBuffer = useIndirectDraw_ ? r_.buf.getBuffer(indirectDrawBuffer_) : Buffer{};
         if (indirectBuffer) {
-            voxelRenderPass.drawIndirect(indirectBuffer, indirectDrawOffset_);
-        } else if (meshletVertexCount > 0 && meshletCount > 0) {
-            voxelRenderPass.draw(meshletVertexCount, meshletCount, 0, 0);
+            voxelRenderPass.drawIndexedIndirect(indirectBuffer, indirectDrawOffset_);
+        } else if (drawChunkCount > 0) {
+            voxelRenderPass.drawIndexed(MESHLET_DRAW_CHUNK_INDICES, drawChunkCount, 0, 0, 0);
         }
-    } else if (meshletVertexCount > 0 && meshletCount > 0) {
-        voxelRenderPass.draw(meshletVertexCount, meshletCount, 0, 0);
     }
 
     if (overlayCallback) {
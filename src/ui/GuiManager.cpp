@@ -137,8 +137,9 @@ void GuiManager::renderImGUI(FrameUniforms& uniforms,
                         static_cast<unsigned long long>(runtimeTiming.streamSkipNoCamera),
                         static_cast<unsigned long long>(runtimeTiming.streamSkipUnchanged),
                         static_cast<unsigned long long>(runtimeTiming.streamSkipThrottle));
-            ImGui::Text("Stream snapshots (window): %llu",
-                        static_cast<unsigned long long>(runtimeTiming.streamSnapshotsPrepared));
+            ImGui::Text("Stream snapshots (window): %llu, rejected meshlets %llu",
+                        static_cast<unsigned long long>(runtimeTiming.streamSnapshotsPrepared),
+                        static_cast<unsigned long long>(runtimeTiming.streamMeshletsRejected));
             ImGui::Text("Main uploads (window): %llu",
                         static_cast<unsigned long long>(runtimeTiming.mainUploadsApplied));
             ImGui::Text("Pending jobs: world %s, mesh %s, upload queued %s",
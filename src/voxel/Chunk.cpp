@@ -8,21 +8,32 @@ BlockMaterial makeAirBlock() {
     static const BlockMaterial kAir = UnpackedBlockMaterial{}.pack();
     return kAir;
 }
+
+// First occupancy_ word of mips 1..3; index 0 is unused.
+constexpr std::array<uint8_t, 4> kOccupancyWordOffset{0, 0, 8, 9};
 }  // namespace
 
 Chunk::Chunk() {
     for (uint8_t level = 0; level <= MAX_MIP_LEVEL; ++level) {
-        MipStorage& storage = mips_[level];
-        storage.bitsPerBlock = 0;
-        storage.size = mipSize(level);
-        storage.palette.assign(1, airBlock());
-        storage.data.clear();
+        resetStorage(mips_[level], level);
     }
     solidVoxelCount_ = 0;
+    minResidentMip_ = 0;
 }
 
 BlockMaterial Chunk::getBlock(uint8_t x, uint8_t y, uint8_t z, uint8_t mipLevel) const {
     const uint8_t level = std::min<uint8_t>(mipLevel, MAX_MIP_LEVEL);
+    if (level < minResidentMip_) {
+        // Fine levels of a partial chunk are not stored; upsample the finest resident level.
+        const uint8_t shift = static_cast<uint8_t>(minResidentMip_ - level);
+        return getBlock(
+            static_cast<uint8_t>(x >> shift),
+            static_cast<uint8_t>(y >> shift),
+            static_cast<uint8_t>(z >> shift),
+            minResidentMip_
+        );
+    }
+
     const MipStorage& storage = mips_[level];
     if (x >= storage.size || y >= storage.size || z >= storage.size) {
         return airBlock();
@@ -44,6 +55,10 @@ void Chunk::setBlock(uint8_t x, uint8_t y, uint8_t z, const BlockMaterial blockI
     if (x >= SIZE || y >= SIZE || z >= SIZE) {
         return;
     }
+    // Partial chunks have no mip 0 to edit; they must be regenerated at full resolution first.
+    if (minResidentMip_ > 0) {
+        return;
+    }
 
     const BlockMaterial previousBlock = getBlock(x, y, z, 0);
     const bool previousSolid = isSolid(previousBlock);
@@ -61,6 +76,7 @@ void Chunk::setBlock(uint8_t x, uint8_t y, uint8_t z, const BlockMaterial blockI
         } else if (solidVoxelCount_ > 0) {
             --solidVoxelCount_;
         }
+        updateOccupancyAbove(x, y, z, newSolid);
     }
 
     uint8_t px = x;
@@ -82,6 +98,237 @@ void Chunk::setBlock(uint8_t x, uint8_t y, uint8_t z, const BlockMaterial blockI
     }
 }
 
+size_t Chunk::applyEdits(const LocalBlockEdit* edits, size_t count) {
+    if (edits == nullptr || count == 0 || minResidentMip_ > 0) {
+        return 0;
+    }
+
+    // One bit per voxel of mip 1; coarser levels are derived from it level by level.
+    constexpr size_t kMip1Volume = (SIZE / 2) * (SIZE / 2) * (SIZE / 2);
+    std::array<uint64_t, kMip1Volume / 64> touchedParents{};
+    size_t changedCount = 0;
+
+    for (size_t i = 0; i < count; ++i) {
+        const LocalBlockEdit& edit = edits[i];
+        if (edit.x >= SIZE || edit.y >= SIZE || edit.z >= SIZE) {
+            continue;
+        }
+
+        const bool previousSolid = isSolid(getBlock(edit.x, edit.y, edit.z, 0));
+        bool changed = false;
+        setBlockInStorage(mips_[0], edit.x, edit.y, edit.z, edit.block, &changed);
+        if (!changed) {
+            continue;
+        }
+
+        ++changedCount;
+        const bool newSolid = isSolid(edit.block);
+        if (previousSolid != newSolid) {
+            if (newSolid) {
+                ++solidVoxelCount_;
+            } else if (solidVoxelCount_ > 0) {
+                --solidVoxelCount_;
+            }
+            updateOccupancyAbove(edit.x, edit.y, edit.z, newSolid);
+        }
+
+        const uint16_t parentIndex = getVoxelIndex(
+            static_cast<uint8_t>(edit.x >> 1),
+            static_cast<uint8_t>(edit.y >> 1),
+            static_cast<uint8_t>(edit.z >> 1),
+            mipSize(1)
+        );
+        touchedParents[parentIndex / 64] |= (1ULL << (parentIndex % 64));
+    }
+
+    if (changedCount == 0) {
+        return 0;
+    }
+
+    for (uint8_t level = 1; level <= MAX_MIP_LEVEL; ++level) {
+        const uint8_t size = mipSize(level);
+        const size_t volume = static_cast<size_t>(size) * size * size;
+        std::array<uint64_t, kMip1Volume / 64> nextTouched{};
+        bool anyChanged = false;
+
+        for (size_t index = 0; index < volume; ++index) {
+            if ((touchedParents[index / 64] & (1ULL << (index % 64))) == 0) {
+                continue;
+            }
+
+            const uint8_t px = static_cast<uint8_t>(index % size);
+            const uint8_t py = static_cast<uint8_t>((index / size) % size);
+            const uint8_t pz = static_cast<uint8_t>(index / (static_cast<size_t>(size) * size));
+            bool parentChanged = false;
+            setBlockInStorage(
+                mips_[level],
+                px,
+                py,
+                pz,
+                downsampleBlockFromChildren(mips_[level - 1], px, py, pz),
+                &parentChanged
+            );
+            if (!parentChanged || level == MAX_MIP_LEVEL) {
+                continue;
+            }
+
+            anyChanged = true;
+            const uint8_t nextSize = mipSize(static_cast<uint8_t>(level + 1));
+            const uint16_t nextIndex = getVoxelIndex(
+                static_cast<uint8_t>(px >> 1),
+                static_cast<uint8_t>(py >> 1),
+                static_cast<uint8_t>(pz >> 1),
+                nextSize
+            );
+            nextTouched[nextIndex / 64] |= (1ULL << (nextIndex % 64));
+        }
+
+        if (!anyChanged) {
+            break;
+        }
+        touchedParents = nextTouched;
+    }
+
+    return changedCount;
+}
+
+void Chunk::fillMipLevel(uint8_t mipLevel, const std::vector<BlockMaterial>& blocks) {
+    const uint8_t level = std::min<uint8_t>(mipLevel, MAX_MIP_LEVEL);
+    const size_t size = mipSize(level);
+    if (blocks.size() != size * size * size) {
+        return;
+    }
+
+    for (uint8_t finer = 0; finer < level; ++finer) {
+        resetStorage(mips_[finer], finer);
+        mips_[finer].palette.shrink_to_fit();
+        mips_[finer].data.shrink_to_fit();
+    }
+
+    resetStorage(mips_[level], level);
+    fillStorageFromDense(mips_[level], blocks);
+
+    // Each voxel at this level stands in for 8^level mip-0 voxels.
+    size_t solidCount = 0;
+    for (const BlockMaterial block : blocks) {
+        if (isSolid(block)) {
+            ++solidCount;
+        }
+    }
+    solidCount <<= (3u * level);
+    solidVoxelCount_ = static_cast<uint16_t>(std::min<size_t>(solidCount, VOLUME));
+    minResidentMip_ = level;
+
+    for (uint8_t parentLevel = static_cast<uint8_t>(level + 1); parentLevel <= MAX_MIP_LEVEL; ++parentLevel) {
+        MipStorage& parent = mips_[parentLevel];
+        resetStorage(parent, parentLevel);
+        for (uint8_t pz = 0; pz < parent.size; ++pz) {
+            for (uint8_t py = 0; py < parent.size; ++py) {
+                for (uint8_t px = 0; px < parent.size; ++px) {
+                    const BlockMaterial parentBlock =
+                        downsampleBlockFromChildren(mips_[parentLevel - 1], px, py, pz);
+                    setBlockInStorage(parent, px, py, pz, parentBlock, nullptr);
+                }
+            }
+        }
+    }
+    rebuildOccupancy();
+}
+
+void Chunk::releaseMipsBelow(uint8_t mipLevel) {
+    const uint8_t level = std::min<uint8_t>(mipLevel, MAX_MIP_LEVEL);
+    for (uint8_t finer = minResidentMip_; finer < level; ++finer) {
+        resetStorage(mips_[finer], finer);
+        mips_[finer].palette.shrink_to_fit();
+        mips_[finer].data.shrink_to_fit();
+    }
+    minResidentMip_ = std::max(minResidentMip_, level);
+}
+
+bool Chunk::isOccupied(uint8_t x, uint8_t y, uint8_t z, uint8_t mipLevel) const {
+    uint8_t level = std::min<uint8_t>(mipLevel, MAX_MIP_LEVEL);
+    if (level < minResidentMip_) {
+        const uint8_t shift = static_cast<uint8_t>(minResidentMip_ - level);
+        x = static_cast<uint8_t>(x >> shift);
+        y = static_cast<uint8_t>(y >> shift);
+        z = static_cast<uint8_t>(z >> shift);
+        level = minResidentMip_;
+    }
+
+    const uint8_t size = mipSize(level);
+    if (x >= size || y >= size || z >= size) {
+        return false;
+    }
+    if (level == minResidentMip_) {
+        return isSolid(getBlock(x, y, z, level));
+    }
+    if (level == MAX_MIP_LEVEL) {
+        return solidVoxelCount_ > 0;
+    }
+    return occupancyBit(level, getVoxelIndex(x, y, z, size));
+}
+
+bool Chunk::occupancyBit(uint8_t mipLevel, uint16_t voxelIndex) const {
+    const uint64_t word = occupancy_[kOccupancyWordOffset[mipLevel] + voxelIndex / 64];
+    return (word >> (voxelIndex % 64)) & 1ULL;
+}
+
+void Chunk::setOccupancyBit(uint8_t mipLevel, uint16_t voxelIndex, bool occupied) {
+    uint64_t& word = occupancy_[kOccupancyWordOffset[mipLevel] + voxelIndex / 64];
+    const uint64_t bit = 1ULL << (voxelIndex % 64);
+    word = occupied ? (word | bit) : (word & ~bit);
+}
+
+bool Chunk::anyChildOccupied(uint8_t mipLevel, uint8_t px, uint8_t py, uint8_t pz) const {
+    const uint8_t childLevel = static_cast<uint8_t>(mipLevel - 1);
+    for (uint8_t dz = 0; dz < 2; ++dz) {
+        for (uint8_t dy = 0; dy < 2; ++dy) {
+            for (uint8_t dx = 0; dx < 2; ++dx) {
+                if (isOccupied(
+                        static_cast<uint8_t>((px << 1) + dx),
+                        static_cast<uint8_t>((py << 1) + dy),
+                        static_cast<uint8_t>((pz << 1) + dz),
+                        childLevel)) {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+void Chunk::updateOccupancyAbove(uint8_t x, uint8_t y, uint8_t z, bool solid) {
+    for (uint8_t level = 1; level < MAX_MIP_LEVEL; ++level) {
+        x = static_cast<uint8_t>(x >> 1);
+        y = static_cast<uint8_t>(y >> 1);
+        z = static_cast<uint8_t>(z >> 1);
+
+        // A new solid block occupies every ancestor; clearing one needs the siblings.
+        const bool occupied = solid || anyChildOccupied(level, x, y, z);
+        const uint16_t index = getVoxelIndex(x, y, z, mipSize(level));
+        if (occupancyBit(level, index) == occupied) {
+            return;
+        }
+        setOccupancyBit(level, index, occupied);
+    }
+}
+
+void Chunk::rebuildOccupancy() {
+    occupancy_.fill(0ULL);
+    for (uint8_t level = std::max<uint8_t>(minResidentMip_ + 1, 1); level < MAX_MIP_LEVEL; ++level) {
+        const uint8_t size = mipSize(level);
+        for (uint8_t z = 0; z < size; ++z) {
+            for (uint8_t y = 0; y < size; ++y) {
+                for (uint8_t x = 0; x < size; ++x) {
+                    if (anyChildOccupied(level, x, y, z)) {
+                        setOccupancyBit(level, getVoxelIndex(x, y, z, size), true);
+                    }
+                }
+            }
+        }
+    }
+}
+
 uint16_t Chunk::getVoxelIndex(uint8_t x, uint8_t y, uint8_t z, uint8_t size) {
     const uint16_t stride = static_cast<uint16_t>(size);
     return static_cast<uint16_t>((static_cast<uint16_t>(z) * stride * stride) +
@@ -174,6 +421,46 @@ void Chunk::resizeBitArray(MipStorage& storage, uint8_t newBitsPerBlock) {
     }
 }
 
+void Chunk::resetStorage(MipStorage& storage, uint8_t mipLevel) {
+    storage.bitsPerBlock = 0;
+    storage.size = mipSize(mipLevel);
+    storage.palette.assign(1, airBlock());
+    storage.data.clear();
+}
+
+void Chunk::fillStorageFromDense(MipStorage& storage, const std::vector<BlockMaterial>& blocks) {
+    storage.palette.clear();
+    std::vector<uint32_t> paletteIndices(blocks.size(), 0u);
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        auto it = std::find(storage.palette.begin(), storage.palette.end(), blocks[i]);
+        if (it == storage.palette.end()) {
+            paletteIndices[i] = static_cast<uint32_t>(storage.palette.size());
+            storage.palette.push_back(blocks[i]);
+        } else {
+            paletteIndices[i] = static_cast<uint32_t>(std::distance(storage.palette.begin(), it));
+        }
+    }
+    if (storage.palette.empty()) {
+        storage.palette.push_back(airBlock());
+    }
+
+    uint8_t bitsPerBlock = 0;
+    while ((1ULL << bitsPerBlock) < storage.palette.size()) {
+        ++bitsPerBlock;
+    }
+
+    const size_t dataWords = (blocks.size() * bitsPerBlock + 63) / 64;
+    storage.bitsPerBlock = bitsPerBlock;
+    storage.data.assign(dataWords, 0ULL);
+    if (bitsPerBlock == 0) {
+        return;
+    }
+
+    for (size_t i = 0; i < paletteIndices.size(); ++i) {
+        setPaletteIndex(storage, static_cast<uint16_t>(i), paletteIndices[i]);
+    }
+}
+
 bool Chunk::isSolid(BlockMaterial block) {
     return block.unpack().id != 0u;
 }
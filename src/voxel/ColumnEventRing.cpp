@@ -0,0 +1,83 @@
+#include "solum_engine/voxel/ColumnEventRing.h"
+
+#include <algorithm>
+
+namespace {
+uint64_t packColumnCoord(const ColumnCoord& coord) {
+    return static_cast<uint64_t>(static_cast<uint32_t>(coord.v.x)) |
+           (static_cast<uint64_t>(static_cast<uint32_t>(coord.v.y)) << 32u);
+}
+
+ColumnCoord unpackColumnCoord(uint64_t packed) {
+    return ColumnCoord{
+        static_cast<int32_t>(static_cast<uint32_t>(packed & 0xFFFFFFFFull)),
+        static_cast<int32_t>(static_cast<uint32_t>(packed >> 32u))
+    };
+}
+}  // namespace
+
+ColumnEventRing::ColumnEventRing(std::size_t capacity) {
+    std::size_t roundedCapacity = 1;
+    while (roundedCapacity < std::max<std::size_t>(capacity, 2)) {
+        roundedCapacity <<= 1;
+    }
+    slots_ = std::vector<Slot>(roundedCapacity);
+    mask_ = static_cast<uint64_t>(roundedCapacity - 1);
+}
+
+void ColumnEventRing::publish(const ColumnEvent& event) {
+    const uint64_t sequence = head_.load(std::memory_order_relaxed);
+    Slot& slot = slots_[static_cast<std::size_t>(sequence & mask_)];
+
+    slot.version.store(kWriting, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.packedCoord.store(packColumnCoord(event.coord), std::memory_order_relaxed);
+    slot.type.store(static_cast<uint8_t>(event.type), std::memory_order_relaxed);
+    slot.borderMask.store(event.borderMask, std::memory_order_relaxed);
+    slot.chunkZMask.store(event.chunkZMask, std::memory_order_relaxed);
+    slot.version.store(sequence + 1, std::memory_order_release);
+
+    head_.store(sequence + 1, std::memory_order_release);
+}
+
+bool ColumnEventRing::read(uint64_t& cursor, std::vector<ColumnEvent>& outEvents, std::size_t maxCount) const {
+    const uint64_t headSequence = head_.load(std::memory_order_acquire);
+    if (cursor > headSequence) {
+        cursor = headSequence;
+    }
+    if (headSequence - cursor > static_cast<uint64_t>(slots_.size())) {
+        cursor = headSequence;
+        return false;
+    }
+
+    const uint64_t available = headSequence - cursor;
+    const uint64_t count = std::min<uint64_t>(available, static_cast<uint64_t>(maxCount));
+    outEvents.reserve(outEvents.size() + static_cast<std::size_t>(count));
+    for (uint64_t i = 0; i < count; ++i) {
+        const uint64_t sequence = cursor + i;
+        const Slot& slot = slots_[static_cast<std::size_t>(sequence & mask_)];
+
+        const uint64_t versionBefore = slot.version.load(std::memory_order_acquire);
+        const uint64_t packedCoord = slot.packedCoord.load(std::memory_order_relaxed);
+        const uint8_t type = slot.type.load(std::memory_order_relaxed);
+        const uint8_t borderMask = slot.borderMask.load(std::memory_order_relaxed);
+        const uint32_t chunkZMask = slot.chunkZMask.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const uint64_t versionAfter = slot.version.load(std::memory_order_relaxed);
+
+        // Anything but this event's stable version means the producer lapped us mid-read.
+        if (versionBefore != sequence + 1 || versionAfter != versionBefore) {
+            cursor = head_.load(std::memory_order_acquire);
+            return false;
+        }
+        outEvents.push_back(ColumnEvent{
+            unpackColumnCoord(packedCoord),
+            static_cast<ColumnEventType>(type),
+            borderMask,
+            chunkZMask
+        });
+    }
+
+    cursor += count;
+    return true;
+}
@@ -0,0 +1,268 @@
+#include "solum_engine/voxel/FarFieldTerrain.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include "solum_engine/resources/Constants.h"
+#include "solum_engine/voxel/TerrainGenerator.h"
+
+namespace {
+constexpr int32_t kMaxFarFieldLevel = 20;
+
+int32_t floorDiv(int32_t value, int32_t divisor) {
+    int32_t quotient = value / divisor;
+    if ((value % divisor) != 0 && ((value < 0) != (divisor < 0))) {
+        --quotient;
+    }
+    return quotient;
+}
+}  // namespace
+
+std::size_t FarFieldTerrain::TileKeyHash::operator()(const TileKey& key) const noexcept {
+    std::size_t h = static_cast<std::size_t>(static_cast<uint32_t>(key.x)) * 73856093u;
+    h ^= static_cast<std::size_t>(static_cast<uint32_t>(key.y)) * 19349663u;
+    h ^= static_cast<std::size_t>(static_cast<uint32_t>(key.level)) * 83492791u;
+    return h;
+}
+
+FarFieldTerrain::FarFieldTerrain()
+    : FarFieldTerrain(Config{}) {}
+
+FarFieldTerrain::FarFieldTerrain(Config config)
+    : config_(std::move(config)) {
+    sanitizeConfig(config_);
+}
+
+void FarFieldTerrain::setInnerRadiusBlocks(int32_t radiusBlocks) {
+    config_.innerRadiusBlocks = radiusBlocks;
+    sanitizeConfig(config_);
+    hasSelection_ = false;
+}
+
+float FarFieldTerrain::seamRadiusBlocks() const noexcept {
+    return static_cast<float>(std::max(0, config_.innerRadiusBlocks - config_.seamOverlapBlocks));
+}
+
+float FarFieldTerrain::viewDistanceBlocks() const noexcept {
+    return static_cast<float>(config_.outerRadiusBlocks + cfg::COLUMN_HEIGHT_BLOCKS);
+}
+
+int32_t FarFieldTerrain::tileSizeBlocks(int32_t level) const noexcept {
+    return (config_.baseSampleSpacing * static_cast<int32_t>(kTileCells)) << level;
+}
+
+void FarFieldTerrain::update(const glm::vec3& cameraPosition, std::vector<uint32_t>& outDirtySlots) {
+    if (!std::isfinite(cameraPosition.x) || !std::isfinite(cameraPosition.y)) {
+        return;
+    }
+
+    // Reselect only when the camera crosses half a finest tile, so tiles are not rebuilt every frame.
+    const int32_t quantum = std::max(1, tileSizeBlocks(0) / 2);
+    const glm::ivec2 anchor{
+        floorDiv(static_cast<int32_t>(std::floor(cameraPosition.x)), quantum),
+        floorDiv(static_cast<int32_t>(std::floor(cameraPosition.y)), quantum)
+    };
+    if (!hasSelection_ || anchor != selectionAnchor_) {
+        selectionAnchor_ = anchor;
+        hasSelection_ = true;
+        selectTiles(anchor * quantum + glm::ivec2(quantum / 2));
+    }
+
+    uint32_t built = 0;
+    while (!pendingBuilds_.empty() && built < config_.maxTileBuildsPerUpdate) {
+        const TileKey key = pendingBuilds_.back();
+        if (residentTiles_.find(key) != residentTiles_.end()) {
+            pendingBuilds_.pop_back();
+            continue;
+        }
+
+        uint32_t slot = 0;
+        if (!allocateSlot(slot)) {
+            // Out of slots: drop tiles the camera left behind early rather than stall the rebuild.
+            retireStaleTiles(outDirtySlots);
+            if (!allocateSlot(slot)) {
+                pendingBuilds_.clear();
+                break;
+            }
+        }
+
+        pendingBuilds_.pop_back();
+        buildTile(key, tiles_[slot]);
+        residentTiles_.emplace(key, slot);
+        outDirtySlots.push_back(slot);
+        ++built;
+    }
+
+    // Old tiles keep covering the view until every replacement exists.
+    if (pendingBuilds_.empty()) {
+        retireStaleTiles(outDirtySlots);
+    }
+}
+
+void FarFieldTerrain::selectTiles(const glm::ivec2& center) {
+    desiredTiles_.clear();
+    pendingBuilds_.clear();
+
+    // Tiles entirely inside this disc are covered by voxel meshes wherever the camera sits
+    // within the current anchor cell, up to half a cell diagonal from its center.
+    const float quantum = static_cast<float>(tileSizeBlocks(0) / 2);
+    const float skipRadius = std::max(0.0f, seamRadiusBlocks() - quantum * std::sqrt(2.0f));
+
+    int32_t topLevel = 0;
+    while (topLevel < kMaxFarFieldLevel && tileSizeBlocks(topLevel) < config_.outerRadiusBlocks) {
+        ++topLevel;
+    }
+
+    const int32_t rootSize = tileSizeBlocks(topLevel);
+    const int32_t outer = config_.outerRadiusBlocks;
+    const int32_t minX = floorDiv(center.x - outer, rootSize);
+    const int32_t maxX = floorDiv(center.x + outer - 1, rootSize);
+    const int32_t minY = floorDiv(center.y - outer, rootSize);
+    const int32_t maxY = floorDiv(center.y + outer - 1, rootSize);
+    for (int32_t y = minY; y <= maxY; ++y) {
+        for (int32_t x = minX; x <= maxX; ++x) {
+            selectTilesRecursive(center, TileKey{topLevel, x, y}, skipRadius);
+        }
+    }
+
+    auto tileDistance = [this, &center](const TileKey& key) {
+        const int64_t size = tileSizeBlocks(key.level);
+        const int64_t cx = static_cast<int64_t>(key.x) * size + size / 2 - center.x;
+        const int64_t cy = static_cast<int64_t>(key.y) * size + size / 2 - center.y;
+        return std::max(std::abs(cx), std::abs(cy));
+    };
+
+    for (const TileKey& key : desiredTiles_) {
+        if (residentTiles_.find(key) == residentTiles_.end()) {
+            pendingBuilds_.push_back(key);
+        }
+    }
+    // Nearest tiles build first; update() consumes from the back.
+    std::sort(pendingBuilds_.begin(), pendingBuilds_.end(), [&tileDistance](const TileKey& a, const TileKey& b) {
+        return tileDistance(a) > tileDistance(b);
+    });
+}
+
+void FarFieldTerrain::selectTilesRecursive(const glm::ivec2& center, const TileKey& key, float skipRadius) {
+    const int64_t size = tileSizeBlocks(key.level);
+    const int64_t minX = static_cast<int64_t>(key.x) * size;
+    const int64_t minY = static_cast<int64_t>(key.y) * size;
+    const int64_t maxX = minX + size;
+    const int64_t maxY = minY + size;
+
+    const int64_t dx = std::max<int64_t>({minX - center.x, int64_t{0}, center.x - maxX});
+    const int64_t dy = std::max<int64_t>({minY - center.y, int64_t{0}, center.y - maxY});
+    const int64_t distance = std::max(dx, dy);
+    const int64_t outer = config_.outerRadiusBlocks;
+    if ((dx * dx) + (dy * dy) >= outer * outer) {
+        return;
+    }
+
+    // Voxel meshes cover a disc, so a tile is skipped only when its farthest corner is inside it.
+    const double farX = static_cast<double>(std::max(maxX - center.x, center.x - minX));
+    const double farY = static_cast<double>(std::max(maxY - center.y, center.y - minY));
+    const double skip = static_cast<double>(skipRadius);
+    if ((farX * farX) + (farY * farY) <= skip * skip) {
+        return;
+    }
+
+    if (key.level > 0 && static_cast<float>(distance) < static_cast<float>(size) * config_.lodDistanceFactor) {
+        for (int32_t child = 0; child < 4; ++child) {
+            selectTilesRecursive(
+                center,
+                TileKey{key.level - 1, key.x * 2 + (child & 1), key.y * 2 + (child >> 1)},
+                skipRadius
+            );
+        }
+        return;
+    }
+
+    desiredTiles_.insert(key);
+}
+
+bool FarFieldTerrain::allocateSlot(uint32_t& outSlot) {
+    if (!freeSlots_.empty()) {
+        outSlot = freeSlots_.back();
+        freeSlots_.pop_back();
+        return true;
+    }
+    if (tiles_.size() >= config_.maxTiles) {
+        return false;
+    }
+    outSlot = static_cast<uint32_t>(tiles_.size());
+    tiles_.emplace_back();
+    return true;
+}
+
+void FarFieldTerrain::buildTile(const TileKey& key, Tile& tile) const {
+    const int32_t spacing = config_.baseSampleSpacing << key.level;
+    const int32_t size = tileSizeBlocks(key.level);
+    tile.origin = glm::ivec2(key.x * size, key.y * size);
+    tile.spacing = spacing;
+    tile.active = true;
+
+    // One extra sample on each side gives central-difference slopes at the tile edges.
+    constexpr int32_t kPaddedAxis = static_cast<int32_t>(kTileSamplesPerAxis) + 2;
+    std::vector<int32_t> heights(static_cast<std::size_t>(kPaddedAxis * kPaddedAxis), 0);
+    for (int32_t y = 0; y < kPaddedAxis; ++y) {
+        for (int32_t x = 0; x < kPaddedAxis; ++x) {
+            heights[static_cast<std::size_t>(y * kPaddedAxis + x)] = TerrainGenerator::sampleHeightmapSurface(
+                tile.origin.x + (x - 1) * spacing,
+                tile.origin.y + (y - 1) * spacing
+            );
+        }
+    }
+
+    auto heightAt = [&heights](int32_t x, int32_t y) {
+        return heights[static_cast<std::size_t>((y + 1) * kPaddedAxis + (x + 1))];
+    };
+
+    tile.samples.resize(kTileSampleCount);
+    tile.minZ = cfg::COLUMN_HEIGHT_BLOCKS;
+    tile.maxZ = 0;
+    const float inverseSpan = 1.0f / (2.0f * static_cast<float>(spacing));
+    for (int32_t y = 0; y < static_cast<int32_t>(kTileSamplesPerAxis); ++y) {
+        for (int32_t x = 0; x < static_cast<int32_t>(kTileSamplesPerAxis); ++x) {
+            const int32_t height = heightAt(x, y);
+            const float slopeX = static_cast<float>(heightAt(x + 1, y) - heightAt(x - 1, y)) * inverseSpan;
+            const float slopeY = static_cast<float>(heightAt(x, y + 1) - heightAt(x, y - 1)) * inverseSpan;
+            const float flatness = 1.0f / std::sqrt(1.0f + slopeX * slopeX + slopeY * slopeY);
+            const uint16_t materialId = TerrainGenerator::surfaceMaterialIdForFlatness(flatness);
+
+            tile.samples[static_cast<std::size_t>(y) * kTileSamplesPerAxis + static_cast<std::size_t>(x)] =
+                (static_cast<uint32_t>(height) & 0xFFFFu) | (static_cast<uint32_t>(materialId) << 16u);
+            tile.minZ = std::min(tile.minZ, height);
+            tile.maxZ = std::max(tile.maxZ, height);
+        }
+    }
+}
+
+void FarFieldTerrain::retireStaleTiles(std::vector<uint32_t>& outDirtySlots) {
+    for (auto it = residentTiles_.begin(); it != residentTiles_.end();) {
+        if (desiredTiles_.find(it->first) != desiredTiles_.end()) {
+            ++it;
+            continue;
+        }
+        tiles_[it->second].active = false;
+        freeSlots_.push_back(it->second);
+        outDirtySlots.push_back(it->second);
+        it = residentTiles_.erase(it);
+    }
+}
+
+void FarFieldTerrain::sanitizeConfig(Config& config) {
+    config.baseSampleSpacing = std::clamp(config.baseSampleSpacing, 1, 1 << 10);
+    config.innerRadiusBlocks = std::max(0, config.innerRadiusBlocks);
+    const int32_t finestTileSize = config.baseSampleSpacing * static_cast<int32_t>(kTileCells);
+    config.outerRadiusBlocks = std::max(config.outerRadiusBlocks, config.innerRadiusBlocks + finestTileSize);
+    config.seamOverlapBlocks = std::clamp(config.seamOverlapBlocks, 0, config.innerRadiusBlocks);
+    if (!std::isfinite(config.lodDistanceFactor) || config.lodDistanceFactor < 1.0f) {
+        config.lodDistanceFactor = 1.0f;
+    }
+    if (!std::isfinite(config.sinkBlocks) || config.sinkBlocks < 0.0f) {
+        config.sinkBlocks = 0.0f;
+    }
+    config.maxTiles = std::max(config.maxTiles, 1u);
+    config.maxTileBuildsPerUpdate = std::max(config.maxTileBuildsPerUpdate, 1u);
+}
@@ -5,7 +5,9 @@
 #include <cmath>
 #include <cstdlib>
 #include <exception>
+#include <iostream>
 #include <iterator>
+#include <limits>
 #include <mutex>
 #include <utility>
 
@@ -53,6 +55,36 @@ struct PaddedChunkBlockSource final : IBlockSource {
     }
 };
 
+// Seeded with the cell origin and LOD so equal content at another cell never aliases.
+uint64_t hashPaddedSnapshot(const PaddedChunkBlockSource& snapshot, uint8_t lodLevel) {
+    constexpr uint64_t kMultiplier = 0x9e3779b97f4a7c15ull;
+    auto mix = [](uint64_t value) {
+        value ^= value >> 33u;
+        value *= 0xff51afd7ed558ccdull;
+        value ^= value >> 33u;
+        value *= 0xc4ceb9fe1a85ec53ull;
+        value ^= value >> 33u;
+        return value;
+    };
+
+    uint64_t hash = mix(static_cast<uint64_t>(static_cast<uint32_t>(snapshot.origin.v.x)) |
+                        (static_cast<uint64_t>(static_cast<uint32_t>(snapshot.origin.v.y)) << 32u));
+    hash = (hash ^ mix(static_cast<uint64_t>(static_cast<uint32_t>(snapshot.origin.v.z)) |
+                       (static_cast<uint64_t>(lodLevel) << 32u))) * kMultiplier;
+
+    const size_t blockCount = snapshot.blocks.size();
+    size_t i = 0;
+    for (; i + 1 < blockCount; i += 2) {
+        const uint64_t word = static_cast<uint64_t>(snapshot.blocks[i].data) |
+                              (static_cast<uint64_t>(snapshot.blocks[i + 1].data) << 32u);
+        hash = (hash ^ mix(word)) * kMultiplier;
+    }
+    if (i < blockCount) {
+        hash = (hash ^ mix(static_cast<uint64_t>(snapshot.blocks[i].data))) * kMultiplier;
+    }
+    return mix(hash);
+}
+
 struct FootprintDistanceRange {
     int32_t minDistanceChunks = 0;
     int32_t maxDistanceChunks = 0;
@@ -93,14 +125,15 @@ FootprintDistanceRange footprintDistanceRangeForCell(int32_t cellX,
     const int32_t minChunkY = cellY * spanChunks;
     const int32_t maxChunkY = minChunkY + spanChunks - 1;
 
-    const int32_t minDx = minDistanceToInterval(centerChunk.v.x, minChunkX, maxChunkX);
-    const int32_t minDy = minDistanceToInterval(centerChunk.v.y, minChunkY, maxChunkY);
-    const int32_t maxDx = maxDistanceToInterval(centerChunk.v.x, minChunkX, maxChunkX);
-    const int32_t maxDy = maxDistanceToInterval(centerChunk.v.y, minChunkY, maxChunkY);
+    const double minDx = minDistanceToInterval(centerChunk.v.x, minChunkX, maxChunkX);
+    const double minDy = minDistanceToInterval(centerChunk.v.y, minChunkY, maxChunkY);
+    const double maxDx = maxDistanceToInterval(centerChunk.v.x, minChunkX, maxChunkX);
+    const double maxDy = maxDistanceToInterval(centerChunk.v.y, minChunkY, maxChunkY);
 
+    // Euclidean, so the active window is a disc rather than a square.
     return FootprintDistanceRange{
-        std::max(minDx, minDy),
-        std::max(maxDx, maxDy)
+        static_cast<int32_t>(std::floor(std::sqrt((minDx * minDx) + (minDy * minDy)))),
+        static_cast<int32_t>(std::ceil(std::sqrt((maxDx * maxDx) + (maxDy * maxDy))))
     };
 }
 
@@ -108,6 +141,7 @@ FootprintDistanceRange footprintDistanceRangeForCell(int32_t cellX,
 
 struct MeshManager::MeshGenerationResult {
     TileLodCellCoord coord;
+    uint32_t zMask = 0u;
     std::vector<Meshlet> meshlets;
     bool meshed = false;
 };
@@ -122,7 +156,27 @@ MeshManager::MeshManager(const World& world, Config config)
     sanitizeConfig(config_);
     const uint8_t maxConfiguredLod = static_cast<uint8_t>(config_.lodChunkRadii.size() - 1);
     meshTileSizeChunks_ = std::max(1, static_cast<int32_t>(chunkSpanForLod(maxConfiguredLod)));
-    processedWorldGenerationRevision_.store(world_.generationRevision(), std::memory_order_release);
+
+    // Widest window any caller uses: two tiles of prefetch plus a tile of prune slack.
+    // The grid is wider than that window so two live tiles never share a slot.
+    tileGridWindowExtraChunks_ = std::max(kMinPrefetchChunks, 2 * meshTileSizeChunks_) + meshTileSizeChunks_;
+    residentMipRadii_ = residentMipRadii(config_);
+    const int32_t windowRadiusTiles =
+        (maxConfiguredRadius() + tileGridWindowExtraChunks_ + meshTileSizeChunks_ - 1) / meshTileSizeChunks_ + 1;
+    const int32_t windowTiles = 2 * windowRadiusTiles + 1;
+    tileGridExtent_ = 1;
+    while (tileGridExtent_ < windowTiles) {
+        tileGridExtent_ <<= 1;
+    }
+    tileGrid_.resize(static_cast<size_t>(tileGridExtent_) * static_cast<size_t>(tileGridExtent_));
+
+    ObserverState primary;
+    primary.lod.sseProjectionScale = config_.lodSseFallbackProjectionScale;
+    primary.lod.maxRadiusChunks = maxConfiguredRadius();
+    primary.lod.lodSseTargetPixels = config_.lodSseTargetPixels;
+    primary.policy = StreamingPolicy(config_.streamingPolicy);
+    observers_.emplace(kPrimaryStreamingObserver, std::move(primary));
+    columnEventCursor_ = world_.columnEvents().head();
 }
 
 MeshManager::~MeshManager() {
@@ -136,19 +190,86 @@ void MeshManager::updatePlayerPosition(const glm::vec3& playerWorldPosition, flo
         return;
     }
 
+    const auto updateStart = std::chrono::steady_clock::now();
+    updateObserver(kPrimaryStreamingObserver, playerWorldPosition, sseProjectionScale);
+
+    if (world_.columnEvents().head() != columnEventCursor_) {
+        scheduleRemeshForNewColumns();
+    }
+
+    scheduleDirtyCells();
+    retryDeferredCells();
+
+    // Integration gets what is left of the update target after scheduling, smoothed so a
+    // single heavy sweep does not starve the next few calls.
+    const float schedulingMs =
+        std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - updateStart).count();
+    smoothedSchedulingMs_ += (schedulingMs - smoothedSchedulingMs_) * 0.25f;
+    const float budgetMs = std::max(
+        config_.completionBudgetMinMs,
+        config_.meshUpdateTargetMs - smoothedSchedulingMs_
+    );
+    applyCompletedTileResultsBudgeted(budgetMs);
+}
+
+void MeshManager::updateView(const StreamingView& view) {
+    updateObserverView(kPrimaryStreamingObserver, view);
+}
+
+StreamingObserverId MeshManager::registerObserver(const ObserverConfig& observerConfig) {
+    ObserverState observer;
+    observer.lod.sseProjectionScale = config_.lodSseFallbackProjectionScale;
+    observer.lod.maxRadiusChunks = (observerConfig.maxRadiusChunks > 0)
+        ? std::min(observerConfig.maxRadiusChunks, maxConfiguredRadius())
+        : maxConfiguredRadius();
+    observer.lod.lodSseTargetPixels =
+        (std::isfinite(observerConfig.lodSseTargetPixels) && observerConfig.lodSseTargetPixels > 0.0f)
+        ? observerConfig.lodSseTargetPixels
+        : config_.lodSseTargetPixels;
+    observer.policy = StreamingPolicy(config_.streamingPolicy);
+
+    std::unique_lock<std::shared_mutex> lock(meshMutex_);
+    const StreamingObserverId id = nextObserverId_++;
+    observers_.emplace(id, std::move(observer));
+    return id;
+}
+
+void MeshManager::removeObserver(StreamingObserverId id) {
+    if (id == kPrimaryStreamingObserver) {
+        return;
+    }
+
+    {
+        std::unique_lock<std::shared_mutex> lock(meshMutex_);
+        if (observers_.erase(id) == 0) {
+            return;
+        }
+        // Tiles it alone held fall back to the remaining observers' LODs or are released.
+        refreshTilesLocked(kMinPrefetchChunks + meshTileSizeChunks_);
+    }
+    meshRevision_.fetch_add(1, std::memory_order_acq_rel);
+}
+
+void MeshManager::updateObserver(StreamingObserverId id,
+                                 const glm::vec3& worldPosition,
+                                 float sseProjectionScale) {
+    if (shuttingDown_.load(std::memory_order_acquire)) {
+        return;
+    }
+
     const float safeSseProjectionScale =
         (std::isfinite(sseProjectionScale) && sseProjectionScale > 0.0f)
         ? sseProjectionScale
         : config_.lodSseFallbackProjectionScale;
 
-    const BlockCoord playerBlock{
-        static_cast<int32_t>(std::floor(playerWorldPosition.x)),
-        static_cast<int32_t>(std::floor(playerWorldPosition.y)),
-        static_cast<int32_t>(std::floor(playerWorldPosition.z))
+    const BlockCoord observerBlock{
+        static_cast<int32_t>(std::floor(worldPosition.x)),
+        static_cast<int32_t>(std::floor(worldPosition.y)),
+        static_cast<int32_t>(std::floor(worldPosition.z))
     };
-    const ChunkCoord centerChunk = block_to_chunk(playerBlock);
-    const ColumnCoord centerColumn = chunk_to_column(centerChunk);
+    const ChunkCoord centerChunk = block_to_chunk(observerBlock);
 
+    ObserverLodParams observerLod;
     ChunkCoord previousCenterChunk{};
     bool hadPreviousCenter = false;
     bool centerChanged = false;
@@ -156,24 +277,36 @@ void MeshManager::updatePlayerPosition(const glm::vec3& playerWorldPosition, flo
     constexpr float kSseScaleChangeAbsoluteThreshold = 0.01f;
     {
         std::unique_lock<std::shared_mutex> lock(meshMutex_);
-        if (hasLastSseProjectionScale_) {
-            const float scaleDelta = std::abs(safeSseProjectionScale - lastSseProjectionScale_);
+        const auto observerIt = observers_.find(id);
+        if (observerIt == observers_.end()) {
+            return;
+        }
+
+        ObserverState& observer = observerIt->second;
+        if (observer.hasSseProjectionScale) {
+            const float scaleDelta = std::abs(safeSseProjectionScale - observer.lod.sseProjectionScale);
             sseScaleChanged = scaleDelta > kSseScaleChangeAbsoluteThreshold;
         } else {
             sseScaleChanged = true;
         }
 
-        lastPlayerWorldPosition_ = playerWorldPosition;
-        lastSseProjectionScale_ = safeSseProjectionScale;
-        hasLastSseProjectionScale_ = true;
+        observer.lod.position = worldPosition;
+        observer.lod.sseProjectionScale = safeSseProjectionScale;
+        observer.hasSseProjectionScale = true;
+        if (observer.policy.hasView()) {
+            StreamingView view = observer.policy.view();
+            view.position = worldPosition;
+            observer.policy.setView(view);
+        }
 
-        if (!hasLastScheduledCenter_ || !(centerChunk == lastScheduledCenterChunk_)) {
-            hadPreviousCenter = hasLastScheduledCenter_;
-            previousCenterChunk = lastScheduledCenterChunk_;
-            lastScheduledCenterChunk_ = centerChunk;
-            hasLastScheduledCenter_ = true;
+        if (!observer.hasCenter || !(centerChunk == observer.lod.centerChunk)) {
+            hadPreviousCenter = observer.hasCenter;
+            previousCenterChunk = observer.lod.centerChunk;
+            observer.lod.centerChunk = centerChunk;
+            observer.hasCenter = true;
             centerChanged = true;
         }
+        observerLod = observer.lod;
     }
 
     if (centerChanged) {
@@ -183,41 +316,32 @@ void MeshManager::updatePlayerPosition(const glm::vec3& playerWorldPosition, flo
                   std::abs(centerChunk.v.y - previousCenterChunk.v.y))
             : 0;
         scheduleTilesAround(
-            centerChunk,
-            playerWorldPosition,
-            safeSseProjectionScale,
+            id,
+            observerLod,
             hadPreviousCenter ? &previousCenterChunk : nullptr,
             centerShiftChunks
         );
     } else if (sseScaleChanged) {
         // A projection-scale change (e.g. framebuffer resize/FOV change) invalidates
         // SSE-based LOD selection across the active window, so force a full refresh.
-        scheduleTilesAround(
-            centerChunk,
-            playerWorldPosition,
-            safeSseProjectionScale,
-            nullptr,
-            meshTileSizeChunks_ * 4
-        );
+        scheduleTilesAround(id, observerLod, nullptr, meshTileSizeChunks_ * 4);
     }
+}
 
-    const uint64_t worldRevision = world_.generationRevision();
-    const uint64_t processedRevision = processedWorldGenerationRevision_.load(std::memory_order_acquire);
-    if (worldRevision != processedRevision) {
-        scheduleRemeshForNewColumns(centerColumn);
+void MeshManager::updateObserverView(StreamingObserverId id, const StreamingView& view) {
+    std::unique_lock<std::shared_mutex> lock(meshMutex_);
+    const auto observerIt = observers_.find(id);
+    if (observerIt != observers_.end()) {
+        observerIt->second.policy.setView(view);
     }
-
-    // Limit integration of completed meshing to one tile per update call.
-    applyCompletedTileResultsBudgeted();
 }
 
-void MeshManager::scheduleTilesAround(const ChunkCoord& centerChunk,
-                                      const glm::vec3& playerWorldPosition,
-                                      float sseProjectionScale,
+void MeshManager::scheduleTilesAround(StreamingObserverId observerId,
+                                      const ObserverLodParams& observerLod,
                                       const ChunkCoord* previousCenterChunk,
                                       int32_t centerShiftChunks) {
     struct ScheduledTileLod {
-        int32_t distanceSq = 0;
+        int32_t score = 0;
         TileLodCoord coord{};
         jobsystem::Priority priority = jobsystem::Priority::Low;
         bool forceRemesh = false;
@@ -229,7 +353,8 @@ void MeshManager::scheduleTilesAround(const ChunkCoord& centerChunk,
     std::unordered_map<MeshTileCoord, int8_t> desiredUpdatesByTile;
     std::unordered_set<MeshTileCoord> tilesToProcess;
 
-    const int32_t maxRadiusChunks = std::max(0, maxConfiguredRadius());
+    const ChunkCoord& centerChunk = observerLod.centerChunk;
+    const int32_t maxRadiusChunks = std::max(0, observerLod.maxRadiusChunks);
     const int32_t clampedCenterShift = std::min(centerShiftChunks, 2);
     const int32_t prefetchChunks = std::max(kMinPrefetchChunks, clampedCenterShift * meshTileSizeChunks_);
     const int32_t scheduleOuterRadiusChunks = maxRadiusChunks + prefetchChunks;
@@ -287,23 +412,28 @@ void MeshManager::scheduleTilesAround(const ChunkCoord& centerChunk,
     int32_t sweepHeight = 0;
     {
         std::unique_lock<std::shared_mutex> lock(meshMutex_);
-        if (!hasLodRefreshScanCenter_ || !(centerChunk == lodRefreshScanCenterChunk_)) {
-            lodRefreshScanCenterChunk_ = centerChunk;
-            hasLodRefreshScanCenter_ = true;
+        const auto observerIt = observers_.find(observerId);
+        if (observerIt == observers_.end()) {
+            return;
+        }
+        ObserverState& observer = observerIt->second;
+        if (!observer.hasLodRefreshScanCenter || !(centerChunk == observer.lodRefreshScanCenterChunk)) {
+            observer.lodRefreshScanCenterChunk = centerChunk;
+            observer.hasLodRefreshScanCenter = true;
             if (treatAsLargeJump) {
-                lodRefreshScanNextIndex_ = 0;
+                observer.lodRefreshScanNextIndex = 0;
             }
         }
 
         sweepWidth = (maxTileX - minTileX) + 1;
         sweepHeight = (maxTileY - minTileY) + 1;
         const int32_t sweepTotal = std::max(0, sweepWidth * sweepHeight);
-        sweepStartIndex = std::clamp(lodRefreshScanNextIndex_, 0, std::max(0, sweepTotal - 1));
+        sweepStartIndex = std::clamp(observer.lodRefreshScanNextIndex, 0, std::max(0, sweepTotal - 1));
         const int32_t baseBudget = 128;
         const int32_t shiftBudget = std::max(0, centerShiftChunks) * 64;
         const int32_t sweepBudget = baseBudget + shiftBudget;
         sweepCount = std::min(sweepTotal, sweepBudget);
-        lodRefreshScanNextIndex_ = (lodRefreshScanNextIndex_ + sweepCount) % std::max(1, sweepTotal);
+        observer.lodRefreshScanNextIndex = (observer.lodRefreshScanNextIndex + sweepCount) % std::max(1, sweepTotal);
     }
 
     for (int32_t i = 0; i < sweepCount; ++i) {
@@ -330,15 +460,22 @@ void MeshManager::scheduleTilesAround(const ChunkCoord& centerChunk,
     }
 
     std::unordered_map<MeshTileCoord, int8_t> previousDesiredByTile;
+    StreamingPolicy policy;
     {
         std::shared_lock<std::shared_mutex> lock(meshMutex_);
+        const auto observerIt = observers_.find(observerId);
+        if (observerIt == observers_.end()) {
+            return;
+        }
+        // Hysteresis runs against this observer's own previous choice, not the combined LOD.
+        const ObserverState& observer = observerIt->second;
+        policy = observer.policy;
         previousDesiredByTile.reserve(tilesToProcess.size());
         for (const MeshTileCoord& tileCoord : tilesToProcess) {
-            const auto tileIt = meshTiles_.find(tileCoord);
-            if (tileIt == meshTiles_.end()) {
-                continue;
+            const auto desiredIt = observer.desiredLodByTile.find(tileCoord);
+            if (desiredIt != observer.desiredLodByTile.end()) {
+                previousDesiredByTile.emplace(tileCoord, desiredIt->second);
             }
-            previousDesiredByTile.emplace(tileCoord, tileIt->second.desiredLod);
         }
     }
 
@@ -358,20 +495,8 @@ void MeshManager::scheduleTilesAround(const ChunkCoord& centerChunk,
             continue;
         }
 
-        const int8_t visibleDesired = desiredLodForTile(
-            tileCoord,
-            centerChunk,
-            playerWorldPosition,
-            sseProjectionScale,
-            0
-        );
-        const int8_t prefetchDesired = desiredLodForTile(
-            tileCoord,
-            centerChunk,
-            playerWorldPosition,
-            sseProjectionScale,
-            prefetchChunks
-        );
+        const int8_t visibleDesired = desiredLodForTile(tileCoord, observerLod, 0);
+        const int8_t prefetchDesired = desiredLodForTile(tileCoord, observerLod, prefetchChunks);
         const int8_t candidateDesired = (visibleDesired >= 0) ? visibleDesired : prefetchDesired;
         const auto previousDesiredIt = previousDesiredByTile.find(tileCoord);
         const int8_t previousDesired = (previousDesiredIt != previousDesiredByTile.end())
@@ -381,29 +506,34 @@ void MeshManager::scheduleTilesAround(const ChunkCoord& centerChunk,
             tileCoord,
             candidateDesired,
             previousDesired,
-            playerWorldPosition,
-            sseProjectionScale
+            observerLod
         );
         desiredUpdatesByTile[tileCoord] = baseDesired;
         if (baseDesired < 0) {
             continue;
         }
 
-        const int32_t distanceSq = distances.minDistanceChunks * distances.minDistanceChunks;
+        const int32_t score = policy.hasView()
+            ? tileScore(policy, tileCoord)
+            : distances.minDistanceChunks * distances.minDistanceChunks;
         const int32_t lodMax = std::min<int32_t>(maxLod, static_cast<int32_t>(baseDesired) + 1);
         const int32_t activeWindowExtraChunks = prefetchChunks + meshTileSizeChunks_;
 
+        glm::vec2 tileMinBlocks{0.0f};
+        glm::vec2 tileMaxBlocks{0.0f};
+        tileBoundsBlocks(tileCoord, tileMinBlocks, tileMaxBlocks);
+        const jobsystem::Priority basePriority = priorityFromLodLevel(static_cast<uint8_t>(baseDesired));
         primaryJobsToSchedule.push_back(ScheduledTileLod{
-            distanceSq,
+            score,
             TileLodCoord{tileCoord, static_cast<uint8_t>(baseDesired)},
-            priorityFromLodLevel(static_cast<uint8_t>(baseDesired)),
+            policy.hasView() ? policy.demoteOutOfView(basePriority, tileMinBlocks, tileMaxBlocks) : basePriority,
             false,
             activeWindowExtraChunks
         });
 
         for (int32_t lod = static_cast<int32_t>(baseDesired) + 1; lod <= lodMax; ++lod) {
             backfillJobsToSchedule.push_back(ScheduledTileLod{
-                distanceSq,
+                score,
                 TileLodCoord{tileCoord, static_cast<uint8_t>(lod)},
                 jobsystem::Priority::Low,
                 false,
@@ -414,8 +544,8 @@ void MeshManager::scheduleTilesAround(const ChunkCoord& centerChunk,
 
     auto sortScheduledJobs = [](std::vector<ScheduledTileLod>& jobs) {
         std::sort(jobs.begin(), jobs.end(), [](const ScheduledTileLod& a, const ScheduledTileLod& b) {
-            if (a.distanceSq != b.distanceSq) {
-                return a.distanceSq < b.distanceSq;
+            if (a.score != b.score) {
+                return a.score < b.score;
             }
             if (!(a.coord.tile == b.coord.tile)) {
                 return a.coord.tile < b.coord.tile;
@@ -428,49 +558,29 @@ void MeshManager::scheduleTilesAround(const ChunkCoord& centerChunk,
 
     {
         std::unique_lock<std::shared_mutex> lock(meshMutex_);
+        const auto observerIt = observers_.find(observerId);
+        if (observerIt == observers_.end()) {
+            return;
+        }
 
+        std::unordered_map<MeshTileCoord, int8_t>& observerDesired = observerIt->second.desiredLodByTile;
         for (const auto& [tileCoord, desiredLod] : desiredUpdatesByTile) {
             if (desiredLod < 0) {
-                auto tileIt = meshTiles_.find(tileCoord);
-                if (tileIt != meshTiles_.end()) {
-                    tileIt->second.desiredLod = -1;
-                }
+                observerDesired.erase(tileCoord);
                 continue;
             }
-            MeshTileState& tileState = meshTiles_[tileCoord];
-            tileState.desiredLod = desiredLod;
-        }
-
-        for (auto& [tileCoord, tileState] : meshTiles_) {
-            if (!tileInBounds(tileCoord, minTileX, maxTileX, minTileY, maxTileY)) {
-                tileState.desiredLod = -1;
-            }
+            observerDesired[tileCoord] = desiredLod;
+            acquireTileLocked(tileCoord);
         }
-
-        refreshRenderedLodsLocked();
-
-        const int32_t pruneExtraChunks = prefetchChunks + meshTileSizeChunks_;
-        for (auto it = meshTiles_.begin(); it != meshTiles_.end();) {
-            if (isTileWithinActiveWindowLocked(it->first, pruneExtraChunks)) {
-                ++it;
-                continue;
-            }
-
-            bool hasPendingForTile = false;
-            for (const TileLodCellCoord& pending : pendingTileJobs_) {
-                if (pending.tileLod.tile == it->first) {
-                    hasPendingForTile = true;
-                    break;
-                }
-            }
-
-            if (hasPendingForTile) {
+        for (auto it = observerDesired.begin(); it != observerDesired.end();) {
+            if (!tileInBounds(it->first, minTileX, maxTileX, minTileY, maxTileY)) {
+                it = observerDesired.erase(it);
+            } else {
                 ++it;
-                continue;
             }
-
-            it = meshTiles_.erase(it);
         }
+
+        refreshTilesLocked(prefetchChunks + meshTileSizeChunks_);
     }
 
     for (const ScheduledTileLod& scheduled : primaryJobsToSchedule) {
@@ -492,141 +602,209 @@ void MeshManager::scheduleTilesAround(const ChunkCoord& centerChunk,
     }
 }
 
-void MeshManager::scheduleRemeshForNewColumns(const ColumnCoord& centerColumn) {
+void MeshManager::scheduleRemeshForNewColumns() {
     constexpr std::size_t kRemeshColumnsPerUpdate = 512;
-    const uint64_t processedRevision = processedWorldGenerationRevision_.load(std::memory_order_acquire);
-    std::vector<ColumnCoord> generatedColumns;
-    const uint64_t nextRevision = world_.copyGeneratedColumnsSince(
-        processedRevision,
-        generatedColumns,
-        kRemeshColumnsPerUpdate
-    );
-    if (nextRevision == processedRevision) {
-        return;
+    std::vector<ColumnEvent> events;
+    if (world_.columnEvents().read(columnEventCursor_, events, kRemeshColumnsPerUpdate)) {
+        // Released fine mips leave the coarser meshes built from them valid.
+        events.erase(
+            std::remove_if(events.begin(), events.end(), [](const ColumnEvent& event) {
+                return event.type == ColumnEventType::Evicted;
+            }),
+            events.end()
+        );
+    } else {
+        // Lapped by the producer: remesh everything generated in range. Unchanged cells
+        // come straight back out of the mesh cache.
+        std::cerr << "MeshManager: column event feed overflowed, resyncing." << std::endl;
+        std::vector<ColumnCoord> generatedColumns;
+        world_.copyGeneratedColumns(generatedColumns);
+        events.clear();
+        events.reserve(generatedColumns.size());
+        for (const ColumnCoord& coord : generatedColumns) {
+            events.push_back(ColumnEvent{coord, ColumnEventType::Generated, kColumnBorderAll});
+        }
     }
-    processedWorldGenerationRevision_.store(nextRevision, std::memory_order_release);
 
-    if (generatedColumns.empty()) {
+    if (events.empty()) {
         return;
     }
 
-    const int32_t remeshRadius = std::max(0, maxConfiguredRadius() + meshTileSizeChunks_ + kMinPrefetchChunks);
-    std::unordered_set<MeshTileCoord> tilesToRemesh;
-
+    struct RemeshWindow {
+        ColumnCoord center{};
+        int32_t radius = 0;
+    };
+    std::vector<RemeshWindow> windows;
     {
-        std::unique_lock<std::shared_mutex> lock(meshMutex_);
-        for (const ColumnCoord& coord : generatedColumns) {
-            const int32_t dx = std::abs(coord.v.x - centerColumn.v.x);
-            const int32_t dy = std::abs(coord.v.y - centerColumn.v.y);
-            if (dx > remeshRadius || dy > remeshRadius) {
+        std::shared_lock<std::shared_mutex> lock(meshMutex_);
+        windows.reserve(observers_.size());
+        for (const auto& [id, observer] : observers_) {
+            if (!observer.hasCenter) {
                 continue;
             }
+            windows.push_back(RemeshWindow{
+                chunk_to_column(observer.lod.centerChunk),
+                std::max(0, observer.lod.maxRadiusChunks + meshTileSizeChunks_ + kMinPrefetchChunks)
+            });
+        }
+    }
 
-            if (!knownGeneratedColumns_.insert(coord).second) {
-                continue;
+    events.erase(
+        std::remove_if(
+            events.begin(),
+            events.end(),
+            [&windows](const ColumnEvent& event) {
+                // Euclidean, matching the disc the tiles are meshed in.
+                for (const RemeshWindow& window : windows) {
+                    const int64_t dx = static_cast<int64_t>(event.coord.v.x) - window.center.v.x;
+                    const int64_t dy = static_cast<int64_t>(event.coord.v.y) - window.center.v.y;
+                    if ((dx * dx) + (dy * dy) <= static_cast<int64_t>(window.radius) * window.radius) {
+                        return false;
+                    }
+                }
+                return true;
             }
+        ),
+        events.end()
+    );
 
-            const int32_t tileX = floor_div(coord.v.x, meshTileSizeChunks_);
-            const int32_t tileY = floor_div(coord.v.y, meshTileSizeChunks_);
-            const int32_t localX = floor_mod(coord.v.x, meshTileSizeChunks_);
-            const int32_t localY = floor_mod(coord.v.y, meshTileSizeChunks_);
-            tilesToRemesh.insert(MeshTileCoord{tileX, tileY});
-
-            const bool touchesLeftEdge = (localX == 0);
-            const bool touchesRightEdge = (localX == meshTileSizeChunks_ - 1);
-            const bool touchesBottomEdge = (localY == 0);
-            const bool touchesTopEdge = (localY == meshTileSizeChunks_ - 1);
-
-            if (touchesLeftEdge) {
-                tilesToRemesh.insert(MeshTileCoord{tileX - 1, tileY});
-            }
-            if (touchesRightEdge) {
-                tilesToRemesh.insert(MeshTileCoord{tileX + 1, tileY});
-            }
-            if (touchesBottomEdge) {
-                tilesToRemesh.insert(MeshTileCoord{tileX, tileY - 1});
-            }
-            if (touchesTopEdge) {
-                tilesToRemesh.insert(MeshTileCoord{tileX, tileY + 1});
-            }
+    markColumnEventsDirty(events);
+}
 
-            if (touchesLeftEdge && touchesBottomEdge) {
-                tilesToRemesh.insert(MeshTileCoord{tileX - 1, tileY - 1});
-            }
-            if (touchesLeftEdge && touchesTopEdge) {
-                tilesToRemesh.insert(MeshTileCoord{tileX - 1, tileY + 1});
-            }
-            if (touchesRightEdge && touchesBottomEdge) {
-                tilesToRemesh.insert(MeshTileCoord{tileX + 1, tileY - 1});
-            }
-            if (touchesRightEdge && touchesTopEdge) {
-                tilesToRemesh.insert(MeshTileCoord{tileX + 1, tileY + 1});
-            }
-        }
+void MeshManager::markColumnsDirty(const std::vector<ColumnCoord>& columns) {
+    std::vector<ColumnEvent> events;
+    events.reserve(columns.size());
+    for (const ColumnCoord& column : columns) {
+        events.push_back(ColumnEvent{column, ColumnEventType::Generated, kColumnBorderAll});
     }
+    markColumnEventsDirty(events);
+}
 
-    if (tilesToRemesh.empty()) {
+void MeshManager::markColumnEventsDirty(const std::vector<ColumnEvent>& events) {
+    if (events.empty()) {
         return;
     }
 
-    ChunkCoord seamCenterChunk{};
-    glm::vec3 seamPlayerWorldPosition{
-        static_cast<float>(centerColumn.v.x * cfg::CHUNK_SIZE),
-        static_cast<float>(centerColumn.v.y * cfg::CHUNK_SIZE),
-        static_cast<float>(cfg::COLUMN_HEIGHT_BLOCKS) * 0.5f
-    };
-    float seamSseProjectionScale = config_.lodSseFallbackProjectionScale;
+    std::vector<ObserverLodParams> observerLods;
     {
         std::shared_lock<std::shared_mutex> lock(meshMutex_);
-        seamCenterChunk = hasLastScheduledCenter_
-            ? lastScheduledCenterChunk_
-            : ChunkCoord{centerColumn.v.x, centerColumn.v.y, 0};
-        if (hasLastSseProjectionScale_) {
-            seamPlayerWorldPosition = lastPlayerWorldPosition_;
-            seamSseProjectionScale = lastSseProjectionScale_;
+        observerLods.reserve(observers_.size());
+        for (const auto& [id, observer] : observers_) {
+            if (observer.hasCenter) {
+                observerLods.push_back(observer.lod);
+            }
         }
     }
+    // Nothing is meshed before the first position update.
+    if (observerLods.empty()) {
+        return;
+    }
 
+    // Finest desired LOD across observers plus one coarser backfill level, evaluated
+    // once per touched tile.
     const int8_t maxLod = static_cast<int8_t>(config_.lodChunkRadii.size() - 1);
-    for (const MeshTileCoord& tileCoord : tilesToRemesh) {
-        const int8_t visibleDesired = desiredLodForTile(
-            tileCoord,
-            seamCenterChunk,
-            seamPlayerWorldPosition,
-            seamSseProjectionScale,
-            0
-        );
-        const int8_t prefetchDesired = desiredLodForTile(
-            tileCoord,
-            seamCenterChunk,
-            seamPlayerWorldPosition,
-            seamSseProjectionScale,
-            kMinPrefetchChunks
-        );
-        const int8_t baseDesired = (visibleDesired >= 0) ? visibleDesired : prefetchDesired;
-        if (baseDesired < 0) {
-            continue;
+    std::unordered_map<MeshTileCoord, int8_t> baseLodByTile;
+    auto baseLodForTile = [&](const MeshTileCoord& tileCoord) -> int8_t {
+        const auto it = baseLodByTile.find(tileCoord);
+        if (it != baseLodByTile.end()) {
+            return it->second;
         }
 
-        const int32_t lodMax = std::min<int32_t>(maxLod, static_cast<int32_t>(baseDesired) + 1);
-        const int32_t activeWindowExtraChunks = kMinPrefetchChunks + meshTileSizeChunks_;
+        int8_t baseDesired = -1;
+        for (const ObserverLodParams& observerLod : observerLods) {
+            const int8_t visibleDesired = desiredLodForTile(tileCoord, observerLod, 0);
+            const int8_t prefetchDesired = desiredLodForTile(tileCoord, observerLod, kMinPrefetchChunks);
+            const int8_t observerDesired = (visibleDesired >= 0) ? visibleDesired : prefetchDesired;
+            if (observerDesired >= 0 && (baseDesired < 0 || observerDesired < baseDesired)) {
+                baseDesired = observerDesired;
+            }
+        }
+        baseLodByTile.emplace(tileCoord, baseDesired);
+        return baseDesired;
+    };
 
-        scheduleTileLodMeshing(
-            TileLodCoord{tileCoord, static_cast<uint8_t>(baseDesired)},
-            priorityFromLodLevel(static_cast<uint8_t>(baseDesired)),
-            true,
-            activeWindowExtraChunks
-        );
+    std::unique_lock<std::shared_mutex> lock(meshMutex_);
+    for (const ColumnEvent& event : events) {
+        const ColumnCoord& column = event.coord;
+        // Edits are what the player is looking at; they jump ahead of streaming work.
+        const bool edited = event.type == ColumnEventType::Edited;
+        // Cells above and below also read the changed chunks through their z padding.
+        const uint32_t paddedChunkZMask =
+            event.chunkZMask | (event.chunkZMask << 1) | (event.chunkZMask >> 1);
+        // A column is read by the cells containing it and, through the one-voxel
+        // border, by the cells containing any of its 8 neighbors. At LOD 0 that border
+        // is the column's outermost block, so neighbors only care when the face they pad
+        // with changed; a coarser voxel spans 2^lod blocks and always reads past it.
+        for (int32_t dy = -1; dy <= 1; ++dy) {
+            const bool borderY = (dy == 0) ||
+                (dy < 0 && (event.borderMask & kColumnBorderMinusY) != 0) ||
+                (dy > 0 && (event.borderMask & kColumnBorderPlusY) != 0);
+            for (int32_t dx = -1; dx <= 1; ++dx) {
+                const bool borderX = (dx == 0) ||
+                    (dx < 0 && (event.borderMask & kColumnBorderMinusX) != 0) ||
+                    (dx > 0 && (event.borderMask & kColumnBorderPlusX) != 0);
+                const bool lod0Reads = borderX && borderY;
+                const ColumnCoord reader{column.v.x + dx, column.v.y + dy};
+                const MeshTileCoord tileCoord{
+                    floor_div(reader.v.x, meshTileSizeChunks_),
+                    floor_div(reader.v.y, meshTileSizeChunks_)
+                };
+                const int8_t baseDesired = baseLodForTile(tileCoord);
+                if (baseDesired < 0) {
+                    continue;
+                }
 
-        for (int32_t lod = static_cast<int32_t>(baseDesired) + 1; lod <= lodMax; ++lod) {
-            scheduleTileLodMeshing(
-                TileLodCoord{tileCoord, static_cast<uint8_t>(lod)},
-                jobsystem::Priority::Low,
-                true,
-                activeWindowExtraChunks
-            );
+                const int32_t lodMax = std::min<int32_t>(maxLod, static_cast<int32_t>(baseDesired) + 1);
+                for (int32_t lod = baseDesired; lod <= lodMax; ++lod) {
+                    if (lod == 0 && !lod0Reads) {
+                        continue;
+                    }
+                    jobsystem::Priority priority = (lod == baseDesired)
+                        ? priorityFromLodLevel(static_cast<uint8_t>(lod))
+                        : jobsystem::Priority::Low;
+                    if (edited) {
+                        priority = std::max(priority, (lod == baseDesired)
+                            ? jobsystem::Priority::High
+                            : jobsystem::Priority::Normal);
+                    }
+                    const TileLodCellCoord cellCoord = cellForColumn(reader, static_cast<uint8_t>(lod));
+                    const uint32_t zMask = cellZMaskForChunks(paddedChunkZMask, static_cast<uint8_t>(lod));
+                    auto [dirtyIt, inserted] = dirtyCells_.try_emplace(cellCoord, DirtyCellState{priority, zMask});
+                    if (!inserted) {
+                        dirtyIt->second.priority = std::max(dirtyIt->second.priority, priority);
+                        dirtyIt->second.zMask |= zMask;
+                    }
+                }
+            }
+        }
+    }
+}
+
+void MeshManager::scheduleDirtyCells() {
+    constexpr std::size_t kDirtyCellsPerUpdate = 2048;
+    std::vector<std::pair<TileLodCellCoord, DirtyCellState>> cellsToSchedule;
+    {
+        std::unique_lock<std::shared_mutex> lock(meshMutex_);
+        if (dirtyCells_.empty()) {
+            return;
+        }
+
+        cellsToSchedule.reserve(std::min(kDirtyCellsPerUpdate, dirtyCells_.size()));
+        for (auto it = dirtyCells_.begin();
+             it != dirtyCells_.end() && cellsToSchedule.size() < kDirtyCellsPerUpdate;) {
+            const TileLodCellCoord& cellCoord = it->first;
+            if (MeshTileState* tileState = acquireTileLocked(cellCoord.tileLod.tile)) {
+                prepareLodCellsLocked(tileState->lodStates[cellCoord.tileLod.lodLevel], cellCoord.tileLod.lodLevel);
+                cellsToSchedule.emplace_back(cellCoord, it->second);
+            }
+            it = dirtyCells_.erase(it);
         }
     }
+
+    const int32_t activeWindowExtraChunks = kMinPrefetchChunks + meshTileSizeChunks_;
+    for (const auto& [cellCoord, dirty] : cellsToSchedule) {
+        scheduleTileLodCellMeshing(cellCoord, dirty.priority, true, activeWindowExtraChunks, dirty.zMask);
+    }
 }
 
 std::vector<Meshlet> MeshManager::meshLodCell(const ChunkCoord& cellCoord, uint8_t lodLevel) const {
@@ -689,35 +867,83 @@ std::vector<Meshlet> MeshManager::meshLodCell(const ChunkCoord& cellCoord, uint8
         }
     }
 
+    const uint64_t contentHash = hashPaddedSnapshot(snapshot, lodLevel);
+    std::vector<Meshlet> cachedMeshlets;
+    if (tryGetCachedMesh(contentHash, cellCoord, lodLevel, cachedMeshlets)) {
+        return cachedMeshlets;
+    }
+
     const glm::ivec3 sectionExtent{kChunkExtent, kChunkExtent, kChunkExtent};
     const glm::ivec3 meshletOrigin{
         sectionOriginMip.v.x * voxelScale,
         sectionOriginMip.v.y * voxelScale,
         sectionOriginMip.v.z * voxelScale
     };
-    return mesher.mesh(
+    std::vector<Meshlet> meshlets = mesher.mesh(
         snapshot,
         sectionOriginMip,
         sectionExtent,
         meshletOrigin,
         voxelScale
     );
+    storeCachedMesh(contentHash, cellCoord, lodLevel, meshlets);
+    return meshlets;
+}
+
+bool MeshManager::tryGetCachedMesh(uint64_t contentHash,
+                                   const ChunkCoord& cellCoord,
+                                   uint8_t lodLevel,
+                                   std::vector<Meshlet>& outMeshlets) const {
+    if (config_.meshCacheCapacity == 0) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(meshCacheMutex_);
+    const auto it = meshCache_.find(contentHash);
+    if (it == meshCache_.end() || !(it->second.cellCoord == cellCoord) || it->second.lodLevel != lodLevel) {
+        return false;
+    }
+
+    meshCacheLru_.splice(meshCacheLru_.begin(), meshCacheLru_, it->second.lruIt);
+    outMeshlets = it->second.meshlets;
+    return true;
+}
+
+void MeshManager::storeCachedMesh(uint64_t contentHash,
+                                  const ChunkCoord& cellCoord,
+                                  uint8_t lodLevel,
+                                  const std::vector<Meshlet>& meshlets) const {
+    if (config_.meshCacheCapacity == 0) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(meshCacheMutex_);
+    const auto existing = meshCache_.find(contentHash);
+    if (existing != meshCache_.end()) {
+        meshCacheLru_.erase(existing->second.lruIt);
+        meshCache_.erase(existing);
+    }
+
+    while (meshCache_.size() >= config_.meshCacheCapacity && !meshCacheLru_.empty()) {
+        meshCache_.erase(meshCacheLru_.back());
+        meshCacheLru_.pop_back();
+    }
+
+    meshCacheLru_.push_front(contentHash);
+    meshCache_.emplace(contentHash, MeshCacheEntry{cellCoord, lodLevel, meshlets, meshCacheLru_.begin()});
 }
 
 void MeshManager::scheduleTileLodMeshing(const TileLodCoord& coord,
                                          jobsystem::Priority priority,
                                          bool forceRemesh,
                                          int32_t activeWindowExtraChunks) {
-    if (!isTileFootprintGenerated(coord.tile)) {
-        return;
-    }
-
     {
         std::unique_lock<std::shared_mutex> lock(meshMutex_);
-        MeshTileState& tileState = meshTiles_[coord.tile];
-        MeshTileLodState& lodState = tileState.lodStates[coord.lodLevel];
-        const int32_t cellsPerAxis = cellCountPerAxisForLod(coord.lodLevel);
-        lodState.expectedCellCount = cellsPerAxis * cellsPerAxis;
+        MeshTileState* tileState = acquireTileLocked(coord.tile);
+        if (tileState == nullptr) {
+            return;
+        }
+        prepareLodCellsLocked(tileState->lodStates[coord.lodLevel], coord.lodLevel);
     }
 
     const int32_t cellsPerAxis = cellCountPerAxisForLod(coord.lodLevel);
@@ -731,7 +957,8 @@ void MeshManager::scheduleTileLodMeshing(const TileLodCoord& coord,
                 },
                 priority,
                 forceRemesh,
-                activeWindowExtraChunks
+                activeWindowExtraChunks,
+                allCellZMask(coord.lodLevel)
             );
         }
     }
@@ -740,19 +967,19 @@ void MeshManager::scheduleTileLodMeshing(const TileLodCoord& coord,
 void MeshManager::scheduleTileLodCellMeshing(const TileLodCellCoord& coord,
                                              jobsystem::Priority priority,
                                              bool forceRemesh,
-                                             int32_t activeWindowExtraChunks) {
-    if (!isTileFootprintGenerated(coord.tileLod.tile)) {
+                                             int32_t activeWindowExtraChunks,
+                                             uint32_t zMask) {
+    const int32_t clampedActiveWindowExtraChunks = std::max(0, activeWindowExtraChunks);
+    zMask &= allCellZMask(coord.tileLod.lodLevel);
+    if (zMask == 0u) {
         return;
     }
 
-    const int32_t clampedActiveWindowExtraChunks = std::max(0, activeWindowExtraChunks);
-    const uint32_t cellKey = packCellKey(coord.cellX, coord.cellY);
-
     {
         std::unique_lock<std::shared_mutex> lock(meshMutex_);
         if (pendingTileJobs_.find(coord) != pendingTileJobs_.end()) {
             if (forceRemesh) {
-                deferredRemeshTileLods_.insert(coord);
+                deferredRemeshTileLods_[coord] |= zMask;
             }
             return;
         }
@@ -761,31 +988,78 @@ void MeshManager::scheduleTileLodCellMeshing(const TileLodCellCoord& coord,
             return;
         }
 
-        const auto tileIt = meshTiles_.find(coord.tileLod.tile);
-        if (tileIt != meshTiles_.end() && !forceRemesh) {
-            const auto lodIt = tileIt->second.lodStates.find(coord.tileLod.lodLevel);
-            if (lodIt != tileIt->second.lodStates.end() &&
-                lodIt->second.cellMeshes.find(cellKey) != lodIt->second.cellMeshes.end()) {
+        const MeshTileState* tileState = findTileLocked(coord.tileLod.tile);
+        const MeshTileLodState* lodState =
+            (tileState != nullptr) ? &tileState->lodStates[coord.tileLod.lodLevel] : nullptr;
+        const size_t cellIndex = cellSlotIndex(coord);
+        const bool cellMeshed = lodState != nullptr &&
+                                cellIndex < lodState->cellMeshed.size() &&
+                                lodState->cellMeshed[cellIndex] != 0u;
+        if (cellMeshed && !forceRemesh) {
+            deferredCells_.erase(coord);
+            return;
+        }
+        // Partial results only patch an existing mesh.
+        if (!cellMeshed) {
+            zMask = allCellZMask(coord.tileLod.lodLevel);
+        }
+    }
+
+    const CellDependencyState dependencies = cellDependencyState(coord);
+    if (dependencies == CellDependencyState::FootprintMissing) {
+        // Rescheduled by scheduleRemeshForNewColumns once the footprint arrives.
+        return;
+    }
+
+    {
+        std::unique_lock<std::shared_mutex> lock(meshMutex_);
+        if (pendingTileJobs_.find(coord) != pendingTileJobs_.end()) {
+            if (forceRemesh) {
+                deferredRemeshTileLods_[coord] |= zMask;
+            }
+            return;
+        }
+
+        if (dependencies == CellDependencyState::BorderMissing) {
+            const auto now = std::chrono::steady_clock::now();
+            auto [deferredIt, inserted] = deferredCells_.try_emplace(
+                coord,
+                DeferredCellState{now, priority, forceRemesh, clampedActiveWindowExtraChunks, zMask}
+            );
+            if (!inserted) {
+                deferredIt->second.priority = priority;
+                deferredIt->second.forceRemesh = deferredIt->second.forceRemesh || forceRemesh;
+                deferredIt->second.activeWindowExtraChunks = clampedActiveWindowExtraChunks;
+                deferredIt->second.zMask |= zMask;
+                zMask = deferredIt->second.zMask;
+            }
+
+            const float waitedSeconds =
+                std::chrono::duration<float>(now - deferredIt->second.firstDeferred).count();
+            if (waitedSeconds < config_.meshDependencyDeadlineSeconds) {
                 return;
             }
+            // Deadline passed: mesh against unknown neighbors; the border column's
+            // arrival forces a remesh of this cell later.
         }
 
+        deferredCells_.erase(coord);
         pendingTileJobs_.insert(coord);
     }
 
     try {
         jobs_.schedule(
             priority,
-            [this, coord, clampedActiveWindowExtraChunks]() -> MeshGenerationResult {
+            [this, coord, clampedActiveWindowExtraChunks, zMask]() -> MeshGenerationResult {
                 {
                     std::shared_lock<std::shared_mutex> lock(meshMutex_);
                     if (!isTileWithinActiveWindowLocked(coord.tileLod.tile, clampedActiveWindowExtraChunks)) {
-                        return MeshGenerationResult{coord, {}, false};
+                        return MeshGenerationResult{coord, zMask, {}, false};
                     }
                 }
 
-                if (!isTileFootprintGenerated(coord.tileLod.tile)) {
-                    return MeshGenerationResult{coord, {}, false};
+                if (cellDependencyState(coord) == CellDependencyState::FootprintMissing) {
+                    return MeshGenerationResult{coord, zMask, {}, false};
                 }
 
                 const uint8_t lodLevel = coord.tileLod.lodLevel;
@@ -804,20 +1078,25 @@ void MeshManager::scheduleTileLodCellMeshing(const TileLodCellCoord& coord,
                 const int32_t localEndY = std::min(cellsPerAxis, localStartY + cellSpanLodCells);
 
                 std::vector<Meshlet> meshlets;
-                std::unordered_map<ColumnCoord, uint32_t> emptyMaskCache;
-                const int32_t cacheColumnsX = std::max(1, (localEndX - localStartX) * spanChunks);
-                const int32_t cacheColumnsY = std::max(1, (localEndY - localStartY) * spanChunks);
-                emptyMaskCache.reserve(static_cast<size_t>(cacheColumnsX * cacheColumnsY));
+                std::unordered_map<ColumnCoord, ColumnChunkMasks> maskCache;
+                // Enclosure checks also read a one-column ring around the footprint.
+                const int32_t cacheColumnsX = std::max(1, (localEndX - localStartX) * spanChunks) + 2;
+                const int32_t cacheColumnsY = std::max(1, (localEndY - localStartY) * spanChunks) + 2;
+                maskCache.reserve(static_cast<size_t>(cacheColumnsX * cacheColumnsY));
 
                 for (int32_t y = localStartY; y < localEndY; ++y) {
                     for (int32_t x = localStartX; x < localEndX; ++x) {
                         for (int32_t z = 0; z < zCount; ++z) {
+                            if ((zMask & (1u << z)) == 0u) {
+                                continue;
+                            }
                             const ChunkCoord cellCoord{
                                 baseCellX + x,
                                 baseCellY + y,
                                 z
                             };
-                            if (isLodCellAllAir(cellCoord, lodLevel, emptyMaskCache)) {
+                            if (isLodCellAllAir(cellCoord, lodLevel, maskCache) ||
+                                isLodCellEnclosed(cellCoord, lodLevel, maskCache)) {
                                 continue;
                             }
 
@@ -835,6 +1114,7 @@ void MeshManager::scheduleTileLodCellMeshing(const TileLodCellCoord& coord,
 
                 return MeshGenerationResult{
                     coord,
+                    zMask,
                     std::move(meshlets),
                     true
                 };
@@ -866,11 +1146,9 @@ void MeshManager::scheduleTileLodCellMeshing(const TileLodCellCoord& coord,
                 auto& completedForTile = completedTileResultsByTile_[tileCoord];
                 completedForTile.push_back(CompletedTileCellResult{
                     meshResult.coord,
+                    meshResult.zMask,
                     std::move(meshResult.meshlets)
                 });
-                if (completedTileResultQueued_.insert(tileCoord).second) {
-                    completedTileResultOrder_.push_back(tileCoord);
-                }
             }
         );
     } catch (const std::exception&) {
@@ -880,90 +1158,245 @@ void MeshManager::scheduleTileLodCellMeshing(const TileLodCellCoord& coord,
     }
 }
 
-void MeshManager::applyCompletedTileResultsBudgeted() {
-    std::vector<CompletedTileCellResult> completedForTile;
+void MeshManager::retryDeferredCells() {
+    struct RetryCell {
+        TileLodCellCoord coord{};
+        DeferredCellState state{};
+    };
+
+    std::vector<RetryCell> retries;
     {
         std::unique_lock<std::shared_mutex> lock(meshMutex_);
-        while (!completedTileResultOrder_.empty()) {
-            const MeshTileCoord tileCoord = completedTileResultOrder_.front();
-            completedTileResultOrder_.pop_front();
-            completedTileResultQueued_.erase(tileCoord);
+        if (deferredCells_.empty()) {
+            return;
+        }
 
-            auto completedIt = completedTileResultsByTile_.find(tileCoord);
-            if (completedIt == completedTileResultsByTile_.end() || completedIt->second.empty()) {
+        const auto now = std::chrono::steady_clock::now();
+        for (auto it = deferredCells_.begin(); it != deferredCells_.end();) {
+            if (!isTileWithinActiveWindowLocked(it->first.tileLod.tile, it->second.activeWindowExtraChunks)) {
+                it = deferredCells_.erase(it);
                 continue;
             }
 
-            completedForTile = std::move(completedIt->second);
-            completedTileResultsByTile_.erase(completedIt);
-            break;
+            const float waitedSeconds = std::chrono::duration<float>(now - it->second.firstDeferred).count();
+            if (waitedSeconds >= config_.meshDependencyDeadlineSeconds) {
+                retries.push_back(RetryCell{it->first, it->second});
+            }
+            ++it;
         }
     }
 
-    if (completedForTile.empty()) {
-        return;
+    // Cells whose border completes in time are picked up by scheduleRemeshForNewColumns;
+    // only expired ones need a retry from here.
+    for (const RetryCell& retry : retries) {
+        scheduleTileLodCellMeshing(
+            retry.coord,
+            retry.state.priority,
+            retry.state.forceRemesh,
+            retry.state.activeWindowExtraChunks,
+            retry.state.zMask
+        );
+    }
+}
+
+void MeshManager::applyCompletedTileResultsBudgeted(float budgetMs) {
+    const auto deadline = std::chrono::steady_clock::now() +
+                          std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                              std::chrono::duration<float, std::milli>(budgetMs));
+
+    struct ObserverOrigin {
+        MeshTileCoord centerTile{};
+        StreamingPolicy policy;
+    };
+
+    std::vector<MeshTileCoord> tileOrder;
+    std::vector<ObserverOrigin> origins;
+    {
+        std::shared_lock<std::shared_mutex> lock(meshMutex_);
+        if (completedTileResultsByTile_.empty()) {
+            return;
+        }
+        tileOrder.reserve(completedTileResultsByTile_.size());
+        for (const auto& [tileCoord, _] : completedTileResultsByTile_) {
+            tileOrder.push_back(tileCoord);
+        }
+        origins.reserve(observers_.size());
+        for (const auto& [id, observer] : observers_) {
+            if (!observer.hasCenter) {
+                continue;
+            }
+            origins.push_back(ObserverOrigin{
+                MeshTileCoord{
+                    floor_div(observer.lod.centerChunk.v.x, meshTileSizeChunks_),
+                    floor_div(observer.lod.centerChunk.v.y, meshTileSizeChunks_)
+                },
+                observer.policy
+            });
+        }
     }
 
-    std::sort(
-        completedForTile.begin(),
-        completedForTile.end(),
-        [](const CompletedTileCellResult& a, const CompletedTileCellResult& b) {
-            if (a.coord.tileLod.lodLevel != b.coord.tileLod.lodLevel) {
-                return a.coord.tileLod.lodLevel < b.coord.tileLod.lodLevel;
+    // Nearest to whichever observer is closest.
+    std::unordered_map<MeshTileCoord, int32_t> distanceByTile;
+    distanceByTile.reserve(tileOrder.size());
+    for (const MeshTileCoord& tile : tileOrder) {
+        int32_t best = origins.empty() ? 0 : std::numeric_limits<int32_t>::max();
+        for (const ObserverOrigin& origin : origins) {
+            int32_t distance = 0;
+            if (origin.policy.hasView()) {
+                distance = tileScore(origin.policy, tile);
+            } else {
+                // Same chunk-squared units as tileScore so mixed observers compare fairly.
+                const int32_t dx = (tile.x - origin.centerTile.x) * meshTileSizeChunks_;
+                const int32_t dy = (tile.y - origin.centerTile.y) * meshTileSizeChunks_;
+                distance = (dx * dx) + (dy * dy);
             }
-            if (a.coord.cellY != b.coord.cellY) {
-                return a.coord.cellY < b.coord.cellY;
+            best = std::min(best, distance);
+        }
+        distanceByTile.emplace(tile, best);
+    }
+    auto tileDistance = [&distanceByTile](const MeshTileCoord& tile) {
+        return distanceByTile.find(tile)->second;
+    };
+    std::sort(tileOrder.begin(), tileOrder.end(), [&](const MeshTileCoord& a, const MeshTileCoord& b) {
+        const int32_t distanceA = tileDistance(a);
+        const int32_t distanceB = tileDistance(b);
+        if (distanceA != distanceB) {
+            return distanceA < distanceB;
+        }
+        return a < b;
+    });
+
+    // Always integrate the nearest tile so progress is made even on a starved budget.
+    bool integratedAny = false;
+    for (const MeshTileCoord& tileCoord : tileOrder) {
+        if (integratedAny && std::chrono::steady_clock::now() >= deadline) {
+            break;
+        }
+
+        std::vector<CompletedTileCellResult> completedForTile;
+        {
+            std::unique_lock<std::shared_mutex> lock(meshMutex_);
+            auto completedIt = completedTileResultsByTile_.find(tileCoord);
+            if (completedIt == completedTileResultsByTile_.end()) {
+                continue;
             }
-            return a.coord.cellX < b.coord.cellX;
+            completedForTile = std::move(completedIt->second);
+            completedTileResultsByTile_.erase(completedIt);
         }
-    );
 
-    for (CompletedTileCellResult& completed : completedForTile) {
-        onTileLodCellMeshed(completed.coord, std::move(completed.meshlets));
+        // Stable, so two results for one cell still land in completion order.
+        std::stable_sort(
+            completedForTile.begin(),
+            completedForTile.end(),
+            [](const CompletedTileCellResult& a, const CompletedTileCellResult& b) {
+                if (a.coord.tileLod.lodLevel != b.coord.tileLod.lodLevel) {
+                    return a.coord.tileLod.lodLevel < b.coord.tileLod.lodLevel;
+                }
+                if (a.coord.cellY != b.coord.cellY) {
+                    return a.coord.cellY < b.coord.cellY;
+                }
+                return a.coord.cellX < b.coord.cellX;
+            }
+        );
+
+        for (CompletedTileCellResult& completed : completedForTile) {
+            onTileLodCellMeshed(completed.coord, completed.zMask, std::move(completed.meshlets));
+        }
+        integratedAny = true;
     }
 }
 
-void MeshManager::onTileLodCellMeshed(const TileLodCellCoord& coord, std::vector<Meshlet>&& meshlets) {
+void MeshManager::onTileLodCellMeshed(const TileLodCellCoord& coord,
+                                      uint32_t zMask,
+                                      std::vector<Meshlet>&& meshlets) {
     if (shuttingDown_.load(std::memory_order_acquire)) {
         return;
     }
 
-    bool needsDeferredRemesh = false;
+    uint32_t deferredZMask = 0u;
     {
         std::unique_lock<std::shared_mutex> lock(meshMutex_);
         pendingTileJobs_.erase(coord);
 
-        MeshTileState& tileState = meshTiles_[coord.tileLod.tile];
-        MeshTileLodState& lodState = tileState.lodStates[coord.tileLod.lodLevel];
-        lodState.cellMeshes[packCellKey(coord.cellX, coord.cellY)] = std::move(meshlets);
-        const int32_t cellsPerAxis = cellCountPerAxisForLod(coord.tileLod.lodLevel);
-        lodState.expectedCellCount = cellsPerAxis * cellsPerAxis;
+        MeshTileState* tileState = acquireTileLocked(coord.tileLod.tile);
+        if (tileState == nullptr) {
+            // The tile slid out of the grid while this cell was in flight.
+            deferredRemeshTileLods_.erase(coord);
+            return;
+        }
 
+        MeshTileLodState& lodState = tileState->lodStates[coord.tileLod.lodLevel];
+        prepareLodCellsLocked(lodState, coord.tileLod.lodLevel);
+        const size_t cellIndex = cellSlotIndex(coord);
+        const uint32_t allZMask = allCellZMask(coord.tileLod.lodLevel);
         auto deferredIt = deferredRemeshTileLods_.find(coord);
         if (deferredIt != deferredRemeshTileLods_.end()) {
+            deferredZMask = deferredIt->second;
             deferredRemeshTileLods_.erase(deferredIt);
-            needsDeferredRemesh = true;
         }
 
-        refreshRenderedLodsLocked();
+        if (zMask == allZMask) {
+            lodState.cellMeshes[cellIndex] = std::move(meshlets);
+        } else if (lodState.cellMeshed[cellIndex] == 0u) {
+            // The tile was reset while a partial remesh ran; there is nothing to patch.
+            deferredZMask = allZMask;
+        } else {
+            // Meshlet origins are their LOD cell's origin, so z picks out the replaced cells.
+            const int32_t cellHeightBlocks =
+                cfg::CHUNK_SIZE * static_cast<int32_t>(chunkSpanForLod(coord.tileLod.lodLevel));
+            std::vector<Meshlet>& cellMeshes = lodState.cellMeshes[cellIndex];
+            cellMeshes.erase(
+                std::remove_if(cellMeshes.begin(), cellMeshes.end(), [&](const Meshlet& meshlet) {
+                    const int32_t cellZ = floor_div(meshlet.origin.z, cellHeightBlocks);
+                    return cellZ >= 0 && cellZ < cfg::COLUMN_HEIGHT && (zMask & (1u << cellZ)) != 0u;
+                }),
+                cellMeshes.end()
+            );
+            cellMeshes.insert(
+                cellMeshes.end(),
+                std::make_move_iterator(meshlets.begin()),
+                std::make_move_iterator(meshlets.end())
+            );
+        }
+
+        if (lodState.cellMeshed[cellIndex] == 0u && zMask == allZMask) {
+            lodState.cellMeshed[cellIndex] = 1u;
+            ++lodState.meshedCellCount;
+        }
+
+        // Only this tile's renderable LOD can change, so skip the full-map refresh.
+        tileState->renderedLod = chooseRenderableLodForTileLocked(*tileState);
     }
 
     meshRevision_.fetch_add(1, std::memory_order_acq_rel);
 
-    if (needsDeferredRemesh) {
+    if (deferredZMask != 0u) {
         const int32_t activeWindowExtraChunks = kMinPrefetchChunks + meshTileSizeChunks_;
         scheduleTileLodCellMeshing(
             coord,
             priorityFromLodLevel(coord.tileLod.lodLevel),
             true,
-            activeWindowExtraChunks
+            activeWindowExtraChunks,
+            deferredZMask
         );
     }
 }
 
 std::vector<Meshlet> MeshManager::copyMeshlets() const {
     std::shared_lock<std::shared_mutex> lock(meshMutex_);
+    return collectMeshletsLocked(nullptr, 0, nullptr);
+}
 
+std::vector<Meshlet> MeshManager::copyMeshletsAround(const ColumnCoord& centerColumn,
+                                                     int32_t columnRadius,
+                                                     std::vector<MeshletGroupRange>* outGroups) const {
+    std::shared_lock<std::shared_mutex> lock(meshMutex_);
+    return collectMeshletsLocked(&centerColumn, std::max(0, columnRadius), outGroups);
+}
+
+std::vector<Meshlet> MeshManager::collectMeshletsLocked(const ColumnCoord* centerColumn,
+                                                        int32_t columnRadius,
+                                                        std::vector<MeshletGroupRange>* outGroups) const {
     struct SelectedTileLodState {
         MeshTileCoord tile{};
         uint8_t lod = 0;
@@ -971,202 +1404,45 @@ std::vector<Meshlet> MeshManager::copyMeshlets() const {
     };
 
     std::vector<SelectedTileLodState> selected;
-    selected.reserve(meshTiles_.size());
+    std::vector<int8_t> selectedLodBySlot(tileGrid_.size(), -1);
+    std::unordered_map<MeshTileCoord, int8_t> selectedOverflowLod;
+
+    auto selectTile = [&](const MeshTileState& tileState) -> int8_t {
+        if (centerColumn != nullptr) {
+            const FootprintDistanceRange distances = footprintDistanceRangeForCell(
+                tileState.coord.x,
+                tileState.coord.y,
+                meshTileSizeChunks_,
+                ChunkCoord{centerColumn->v.x, centerColumn->v.y, 0}
+            );
+            if (distances.minDistanceChunks > columnRadius) {
+                return -1;
+            }
+        }
 
-    for (const auto& [tileCoord, tileState] : meshTiles_) {
         const int8_t chosenLod = chooseRenderableLodForTileLocked(tileState);
         if (chosenLod < 0) {
-            continue;
-        }
-
-        const auto lodIt = tileState.lodStates.find(static_cast<uint8_t>(chosenLod));
-        if (lodIt == tileState.lodStates.end()) {
-            continue;
+            return -1;
         }
 
         selected.push_back(SelectedTileLodState{
-            tileCoord,
+            tileState.coord,
             static_cast<uint8_t>(chosenLod),
-            &lodIt->second
+            &tileState.lodStates[static_cast<size_t>(chosenLod)]
         });
-    }
-
-    std::sort(selected.begin(), selected.end(), [](const SelectedTileLodState& a, const SelectedTileLodState& b) {
-        if (a.tile == b.tile) {
-            return a.lod < b.lod;
-        }
-        return a.tile < b.tile;
-    });
-
-    size_t totalMeshletCount = 0;
-    for (const SelectedTileLodState& entry : selected) {
-        for (const auto& [_, cellMeshlets] : entry.lodState->cellMeshes) {
-            totalMeshletCount += cellMeshlets.size();
-        }
-    }
-
-    std::unordered_map<MeshTileCoord, uint8_t> selectedLodByTile;
-    selectedLodByTile.reserve(selected.size());
-    for (const SelectedTileLodState& entry : selected) {
-        selectedLodByTile[entry.tile] = entry.lod;
-    }
-
-    std::vector<Meshlet> skirtMeshlets;
-    auto appendSkirtQuad = [&skirtMeshlets](uint32_t faceDirection,
-                                            const glm::ivec3& origin,
-                                            uint32_t voxelScale,
-                                            uint16_t materialId) {
-        Meshlet skirt{};
-        skirt.origin = origin;
-        skirt.faceDirection = faceDirection;
-        skirt.voxelScale = std::max(voxelScale, 1u);
-        skirt.packedQuadLocalOffsets[0] = packMeshletLocalOffset(0u, 0u, 0u);
-        skirt.quadMaterialIds[0] = materialId;
-        skirt.quadAoData[0] = packMeshletQuadAoData(3u, 3u, 3u, 3u, false);
-        skirt.quadCount = 1u;
-        skirtMeshlets.push_back(skirt);
+        return chosenLod;
     };
 
-    for (const SelectedTileLodState& entry : selected) {
-        if (entry.lod == 0u) {
-            continue;
-        }
-
-        const auto isFinerNeighbor = [&selectedLodByTile, &entry](int32_t dx, int32_t dy) {
-            const auto neighborIt = selectedLodByTile.find(MeshTileCoord{entry.tile.x + dx, entry.tile.y + dy});
-            return neighborIt != selectedLodByTile.end() && neighborIt->second < entry.lod;
-        };
-
-        const bool skirtPlusX = isFinerNeighbor(+1, 0);
-        const bool skirtMinusX = isFinerNeighbor(-1, 0);
-        const bool skirtPlusY = isFinerNeighbor(0, +1);
-        const bool skirtMinusY = isFinerNeighbor(0, -1);
-        if (!skirtPlusX && !skirtMinusX && !skirtPlusY && !skirtMinusY) {
-            continue;
-        }
-
-        const int32_t tileMinX = entry.tile.x * meshTileSizeChunks_ * cfg::CHUNK_SIZE;
-        const int32_t tileMinY = entry.tile.y * meshTileSizeChunks_ * cfg::CHUNK_SIZE;
-        const int32_t tileMaxX = tileMinX + meshTileSizeChunks_ * cfg::CHUNK_SIZE;
-        const int32_t tileMaxY = tileMinY + meshTileSizeChunks_ * cfg::CHUNK_SIZE;
-
-        for (const auto& [_, cellMeshlets] : entry.lodState->cellMeshes) {
-            for (const Meshlet& meshlet : cellMeshlets) {
-                if (meshlet.faceDirection != Direction::PlusZ || meshlet.quadCount == 0u) {
-                    continue;
-                }
-
-                const uint32_t voxelScale = std::max(meshlet.voxelScale, 1u);
-                for (uint32_t quadIndex = 0; quadIndex < meshlet.quadCount; ++quadIndex) {
-                    const uint16_t packed = meshlet.packedQuadLocalOffsets[quadIndex];
-                    const uint16_t materialId = meshlet.quadMaterialIds[quadIndex];
-                    const uint32_t localX = static_cast<uint32_t>(packed & 0x1Fu);
-                    const uint32_t localY = static_cast<uint32_t>((packed >> 5u) & 0x1Fu);
-                    const uint32_t localZ = static_cast<uint32_t>((packed >> 10u) & 0x1Fu);
-
-                    const int32_t worldX = meshlet.origin.x + static_cast<int32_t>(localX * voxelScale);
-                    const int32_t worldY = meshlet.origin.y + static_cast<int32_t>(localY * voxelScale);
-                    const int32_t worldZ = meshlet.origin.z + static_cast<int32_t>(localZ * voxelScale);
-
-                    if (skirtMinusX && worldX == tileMinX) {
-                        appendSkirtQuad(
-                            Direction::MinusX,
-                            glm::ivec3(worldX, worldY, worldZ),
-                            voxelScale,
-                            materialId
-                        );
-                    }
-                    if (skirtPlusX && (worldX + static_cast<int32_t>(voxelScale)) == tileMaxX) {
-                        appendSkirtQuad(
-                            Direction::PlusX,
-                            glm::ivec3(worldX, worldY, worldZ),
-                            voxelScale,
-                            materialId
-                        );
-                    }
-                    if (skirtMinusY && worldY == tileMinY) {
-                        appendSkirtQuad(
-                            Direction::MinusY,
-                            glm::ivec3(worldX, worldY, worldZ),
-                            voxelScale,
-                            materialId
-                        );
-                    }
-                    if (skirtPlusY && (worldY + static_cast<int32_t>(voxelScale)) == tileMaxY) {
-                        appendSkirtQuad(
-                            Direction::PlusY,
-                            glm::ivec3(worldX, worldY, worldZ),
-                            voxelScale,
-                            materialId
-                        );
-                    }
-                }
-            }
-        }
-    }
-
-    totalMeshletCount += skirtMeshlets.size();
-
-    std::vector<Meshlet> meshlets;
-    meshlets.reserve(totalMeshletCount);
-
-    for (const SelectedTileLodState& entry : selected) {
-        for (const auto& [_, cellMeshlets] : entry.lodState->cellMeshes) {
-            meshlets.insert(meshlets.end(), cellMeshlets.begin(), cellMeshlets.end());
+    for (size_t slot = 0; slot < tileGrid_.size(); ++slot) {
+        if (tileGrid_[slot].occupied) {
+            selectedLodBySlot[slot] = selectTile(tileGrid_[slot]);
         }
     }
-    meshlets.insert(meshlets.end(), skirtMeshlets.begin(), skirtMeshlets.end());
-
-    return meshlets;
-}
-
-std::vector<Meshlet> MeshManager::copyMeshletsAround(const ColumnCoord& centerColumn, int32_t columnRadius) const {
-    std::shared_lock<std::shared_mutex> lock(meshMutex_);
-
-    struct SelectedTileLodState {
-        MeshTileCoord tile{};
-        uint8_t lod = 0;
-        const MeshTileLodState* lodState = nullptr;
-    };
-
-    std::vector<SelectedTileLodState> selected;
-    selected.reserve(meshTiles_.size());
-
-    const int32_t clampedRadius = std::max(0, columnRadius);
-    const int32_t minColumnX = centerColumn.v.x - clampedRadius;
-    const int32_t maxColumnX = centerColumn.v.x + clampedRadius;
-    const int32_t minColumnY = centerColumn.v.y - clampedRadius;
-    const int32_t maxColumnY = centerColumn.v.y + clampedRadius;
-
-    auto intersectsView = [this, minColumnX, maxColumnX, minColumnY, maxColumnY](const MeshTileCoord& tileCoord) {
-        const int32_t tileMinX = tileCoord.x * meshTileSizeChunks_;
-        const int32_t tileMaxX = tileMinX + meshTileSizeChunks_ - 1;
-        const int32_t tileMinY = tileCoord.y * meshTileSizeChunks_;
-        const int32_t tileMaxY = tileMinY + meshTileSizeChunks_ - 1;
-        return !(tileMaxX < minColumnX || tileMinX > maxColumnX ||
-                 tileMaxY < minColumnY || tileMinY > maxColumnY);
-    };
-
-    for (const auto& [tileCoord, tileState] : meshTiles_) {
-        if (!intersectsView(tileCoord)) {
-            continue;
-        }
-
-        const int8_t chosenLod = chooseRenderableLodForTileLocked(tileState);
-        if (chosenLod < 0) {
-            continue;
-        }
-
-        const auto lodIt = tileState.lodStates.find(static_cast<uint8_t>(chosenLod));
-        if (lodIt == tileState.lodStates.end()) {
-            continue;
+    for (const auto& [tileCoord, tileState] : overflowTiles_) {
+        const int8_t chosenLod = selectTile(tileState);
+        if (chosenLod >= 0) {
+            selectedOverflowLod.emplace(tileCoord, chosenLod);
         }
-
-        selected.push_back(SelectedTileLodState{
-            tileCoord,
-            static_cast<uint8_t>(chosenLod),
-            &lodIt->second
-        });
     }
 
     std::sort(selected.begin(), selected.end(), [](const SelectedTileLodState& a, const SelectedTileLodState& b) {
@@ -1178,18 +1454,24 @@ std::vector<Meshlet> MeshManager::copyMeshletsAround(const ColumnCoord& centerCo
 
     size_t totalMeshletCount = 0;
     for (const SelectedTileLodState& entry : selected) {
-        for (const auto& [_, cellMeshlets] : entry.lodState->cellMeshes) {
+        for (const std::vector<Meshlet>& cellMeshlets : entry.lodState->cellMeshes) {
             totalMeshletCount += cellMeshlets.size();
         }
     }
 
-    std::unordered_map<MeshTileCoord, uint8_t> selectedLodByTile;
-    selectedLodByTile.reserve(selected.size());
-    for (const SelectedTileLodState& entry : selected) {
-        selectedLodByTile[entry.tile] = entry.lod;
-    }
+    auto selectedLodForTile = [this, &selectedLodBySlot, &selectedOverflowLod](const MeshTileCoord& tileCoord) -> int8_t {
+        const size_t slot = tileSlotIndex(tileCoord);
+        const MeshTileState& tileState = tileGrid_[slot];
+        if (tileState.occupied && tileState.coord == tileCoord) {
+            return selectedLodBySlot[slot];
+        }
+        const auto overflowIt = selectedOverflowLod.find(tileCoord);
+        return (overflowIt != selectedOverflowLod.end()) ? overflowIt->second : -1;
+    };
 
     std::vector<Meshlet> skirtMeshlets;
+    // Skirt ranges are relative to the first skirt meshlet until the skirts are appended.
+    std::vector<MeshletGroupRange> skirtGroups;
     auto appendSkirtQuad = [&skirtMeshlets](uint32_t faceDirection,
                                             const glm::ivec3& origin,
                                             uint32_t voxelScale,
@@ -1210,9 +1492,9 @@ std::vector<Meshlet> MeshManager::copyMeshletsAround(const ColumnCoord& centerCo
             continue;
         }
 
-        const auto isFinerNeighbor = [&selectedLodByTile, &entry](int32_t dx, int32_t dy) {
-            const auto neighborIt = selectedLodByTile.find(MeshTileCoord{entry.tile.x + dx, entry.tile.y + dy});
-            return neighborIt != selectedLodByTile.end() && neighborIt->second < entry.lod;
+        const auto isFinerNeighbor = [&selectedLodForTile, &entry](int32_t dx, int32_t dy) {
+            const int8_t neighborLod = selectedLodForTile(MeshTileCoord{entry.tile.x + dx, entry.tile.y + dy});
+            return neighborLod >= 0 && neighborLod < static_cast<int8_t>(entry.lod);
         };
 
         const bool skirtPlusX = isFinerNeighbor(+1, 0);
@@ -1227,8 +1509,9 @@ std::vector<Meshlet> MeshManager::copyMeshletsAround(const ColumnCoord& centerCo
         const int32_t tileMinY = entry.tile.y * meshTileSizeChunks_ * cfg::CHUNK_SIZE;
         const int32_t tileMaxX = tileMinX + meshTileSizeChunks_ * cfg::CHUNK_SIZE;
         const int32_t tileMaxY = tileMinY + meshTileSizeChunks_ * cfg::CHUNK_SIZE;
+        const size_t firstSkirt = skirtMeshlets.size();
 
-        for (const auto& [_, cellMeshlets] : entry.lodState->cellMeshes) {
+        for (const std::vector<Meshlet>& cellMeshlets : entry.lodState->cellMeshes) {
             for (const Meshlet& meshlet : cellMeshlets) {
                 if (meshlet.faceDirection != Direction::PlusZ || meshlet.quadCount == 0u) {
                     continue;
@@ -1281,6 +1564,13 @@ std::vector<Meshlet> MeshManager::copyMeshletsAround(const ColumnCoord& centerCo
                 }
             }
         }
+
+        if (skirtMeshlets.size() > firstSkirt) {
+            skirtGroups.push_back(MeshletGroupRange{
+                static_cast<uint32_t>(firstSkirt),
+                static_cast<uint32_t>(skirtMeshlets.size() - firstSkirt)
+            });
+        }
     }
 
     totalMeshletCount += skirtMeshlets.size();
@@ -1289,10 +1579,23 @@ std::vector<Meshlet> MeshManager::copyMeshletsAround(const ColumnCoord& centerCo
     meshlets.reserve(totalMeshletCount);
 
     for (const SelectedTileLodState& entry : selected) {
-        for (const auto& [_, cellMeshlets] : entry.lodState->cellMeshes) {
+        for (const std::vector<Meshlet>& cellMeshlets : entry.lodState->cellMeshes) {
+            if (outGroups != nullptr && !cellMeshlets.empty()) {
+                outGroups->push_back(MeshletGroupRange{
+                    static_cast<uint32_t>(meshlets.size()),
+                    static_cast<uint32_t>(cellMeshlets.size())
+                });
+            }
             meshlets.insert(meshlets.end(), cellMeshlets.begin(), cellMeshlets.end());
         }
     }
+
+    if (outGroups != nullptr) {
+        const uint32_t skirtBase = static_cast<uint32_t>(meshlets.size());
+        for (const MeshletGroupRange& skirtGroup : skirtGroups) {
+            outGroups->push_back(MeshletGroupRange{skirtBase + skirtGroup.firstMeshlet, skirtGroup.meshletCount});
+        }
+    }
     meshlets.insert(meshlets.end(), skirtMeshlets.begin(), skirtMeshlets.end());
 
     return meshlets;
@@ -1306,39 +1609,95 @@ bool MeshManager::hasPendingJobs() const {
     std::shared_lock<std::shared_mutex> lock(meshMutex_);
     return !pendingTileJobs_.empty() ||
            !deferredRemeshTileLods_.empty() ||
-           !completedTileResultsByTile_.empty() ||
-           !completedTileResultOrder_.empty();
+           !deferredCells_.empty() ||
+           !dirtyCells_.empty() ||
+           !completedTileResultsByTile_.empty();
+}
+
+std::vector<int32_t> MeshManager::residentMipRadii(Config config) {
+    sanitizeConfig(config);
+    const int32_t lodCount = static_cast<int32_t>(config.lodChunkRadii.size());
+    const int32_t tileSpanChunks = static_cast<int32_t>(chunkSpanForLod(static_cast<uint8_t>(lodCount - 1)));
+    // A tile at a given depth holds columns up to its diagonal further out, and meshing
+    // also reads the one-column border and the observer sits anywhere in its own column.
+    const int32_t footprintSlackColumns =
+        static_cast<int32_t>(std::ceil(static_cast<float>(tileSpanChunks) * std::sqrt(2.0f))) + 2;
+    const int32_t windowExtraChunks = std::max(kMinPrefetchChunks, 2 * tileSpanChunks) + tileSpanChunks;
+    const int32_t meshWindowRadius = config.lodChunkRadii.back() + windowExtraChunks + footprintSlackColumns;
+
+    const float projectionScale = std::max(1.0e-4f, config.lodMipRingProjectionScale);
+    const float targetPixels = std::max(1.0e-4f, config.lodSseTargetPixels);
+    const float holdPixels = targetPixels - std::max(0.0f, config.lodSseHysteresisPixels);
+
+    std::vector<int32_t> radii;
+    radii.reserve(static_cast<size_t>(lodCount));
+    for (int32_t mip = 0; mip + 1 < lodCount; ++mip) {
+        // LOD mip stays selected until LOD mip + 1 meets the target (see desiredLodForTile),
+        // and applyLodHysteresis keeps it until its own error drops below holdPixels.
+        const float coarserErrorBlocks = 0.5f * static_cast<float>(chunkSpanForLod(static_cast<uint8_t>(mip + 1)));
+        const float ownErrorBlocks = (mip == 0) ? 0.0f : 0.5f * static_cast<float>(chunkSpanForLod(static_cast<uint8_t>(mip)));
+        if (holdPixels <= 0.0f) {
+            radii.push_back(meshWindowRadius);
+            continue;
+        }
+        const float depthBlocks = std::max(
+            coarserErrorBlocks * projectionScale / targetPixels,
+            ownErrorBlocks * projectionScale / holdPixels
+        );
+        const float radius = std::ceil(depthBlocks / static_cast<float>(cfg::CHUNK_SIZE)) +
+                             static_cast<float>(footprintSlackColumns);
+        radii.push_back(static_cast<int32_t>(std::min(radius, static_cast<float>(meshWindowRadius))));
+    }
+    radii.push_back(meshWindowRadius);
+    return radii;
 }
 
 int8_t MeshManager::desiredLodForTile(const MeshTileCoord& tileCoord,
-                                      const ChunkCoord& centerChunk,
-                                      const glm::vec3& playerWorldPosition,
-                                      float sseProjectionScale,
+                                      const ObserverLodParams& observerLod,
                                       int32_t extraChunks) const {
-    const int32_t radiusChunks = std::max(0, maxConfiguredRadius() + extraChunks);
+    const int32_t radiusChunks = std::max(0, observerLod.maxRadiusChunks + extraChunks);
     const FootprintDistanceRange distances = footprintDistanceRangeForCell(
         tileCoord.x,
         tileCoord.y,
         meshTileSizeChunks_,
-        centerChunk
+        observerLod.centerChunk
     );
     if (distances.minDistanceChunks > radiusChunks) {
         return -1;
     }
 
-    const float depthBlocks = tileDepthEstimateBlocks(tileCoord, playerWorldPosition, extraChunks);
+    const float depthBlocks = tileDepthEstimateBlocks(tileCoord, observerLod.position, extraChunks);
     for (int32_t lodIndex = static_cast<int32_t>(config_.lodChunkRadii.size()) - 1; lodIndex >= 0; --lodIndex) {
         const float ssePixels = projectedSsePixels(
             static_cast<uint8_t>(lodIndex),
             depthBlocks,
-            sseProjectionScale
+            observerLod.sseProjectionScale
         );
-        if (ssePixels <= config_.lodSseTargetPixels) {
-            return static_cast<int8_t>(lodIndex);
+        if (ssePixels <= observerLod.lodSseTargetPixels) {
+            return std::max(static_cast<int8_t>(lodIndex), finestResidentLodForTile(tileCoord, observerLod));
         }
     }
 
-    return 0;
+    return finestResidentLodForTile(tileCoord, observerLod);
+}
+
+int8_t MeshManager::finestResidentLodForTile(const MeshTileCoord& tileCoord,
+                                             const ObserverLodParams& observerLod) const {
+    const int8_t maxLod = static_cast<int8_t>(config_.lodChunkRadii.size() - 1);
+    const FootprintDistanceRange distances = footprintDistanceRangeForCell(
+        tileCoord.x,
+        tileCoord.y,
+        meshTileSizeChunks_,
+        observerLod.centerChunk
+    );
+    // Same slack residentMipRadii adds for the border columns and the observer offset.
+    const int32_t reachColumns = distances.maxDistanceChunks + 2;
+    for (size_t mip = 0; mip < residentMipRadii_.size() && static_cast<int8_t>(mip) < maxLod; ++mip) {
+        if (reachColumns <= residentMipRadii_[mip]) {
+            return static_cast<int8_t>(mip);
+        }
+    }
+    return maxLod;
 }
 
 float MeshManager::tileDepthEstimateBlocks(const MeshTileCoord& tileCoord,
@@ -1370,8 +1729,7 @@ float MeshManager::projectedSsePixels(uint8_t lodLevel, float depthBlocks, float
 int8_t MeshManager::applyLodHysteresis(const MeshTileCoord& tileCoord,
                                        int8_t candidateLod,
                                        int8_t previousLod,
-                                       const glm::vec3& playerWorldPosition,
-                                       float sseProjectionScale) const {
+                                       const ObserverLodParams& observerLod) const {
     if (candidateLod < 0) {
         return -1;
     }
@@ -1384,25 +1742,26 @@ int8_t MeshManager::applyLodHysteresis(const MeshTileCoord& tileCoord,
         return candidateLod;
     }
 
-    const float depthBlocks = tileDepthEstimateBlocks(tileCoord, playerWorldPosition, 0);
+    const float depthBlocks = tileDepthEstimateBlocks(tileCoord, observerLod.position, 0);
     const float previousSsePixels = projectedSsePixels(
         static_cast<uint8_t>(previousLod),
         depthBlocks,
-        sseProjectionScale
+        observerLod.sseProjectionScale
     );
 
     if (candidateLod > previousLod) {
         const float coarseSwitchThreshold = std::max(
             0.0f,
-            config_.lodSseTargetPixels - config_.lodSseHysteresisPixels
+            observerLod.lodSseTargetPixels - config_.lodSseHysteresisPixels
         );
         if (previousSsePixels > coarseSwitchThreshold) {
-            return previousLod;
+            // Never hold a LOD whose mip has already been released under the tile.
+            return std::max(previousLod, finestResidentLodForTile(tileCoord, observerLod));
         }
         return candidateLod;
     }
 
-    const float fineSwitchThreshold = config_.lodSseTargetPixels + config_.lodSseHysteresisPixels;
+    const float fineSwitchThreshold = observerLod.lodSseTargetPixels + config_.lodSseHysteresisPixels;
     if (previousSsePixels < fineSwitchThreshold) {
         return previousLod;
     }
@@ -1410,39 +1769,161 @@ int8_t MeshManager::applyLodHysteresis(const MeshTileCoord& tileCoord,
 }
 
 bool MeshManager::isTileWithinActiveWindowLocked(const MeshTileCoord& tileCoord, int32_t extraChunks) const {
-    if (!hasLastScheduledCenter_) {
+    bool anyCenter = false;
+    for (const auto& [id, observer] : observers_) {
+        if (!observer.hasCenter) {
+            continue;
+        }
+        anyCenter = true;
+
+        const int32_t radiusChunks = std::max(0, observer.lod.maxRadiusChunks + extraChunks);
+        const FootprintDistanceRange distances = footprintDistanceRangeForCell(
+            tileCoord.x,
+            tileCoord.y,
+            meshTileSizeChunks_,
+            observer.lod.centerChunk
+        );
+        if (distances.minDistanceChunks <= radiusChunks) {
+            return true;
+        }
+    }
+    return !anyCenter;
+}
+
+int8_t MeshManager::combinedDesiredLodLocked(const MeshTileCoord& tileCoord) const {
+    int8_t combined = -1;
+    for (const auto& [id, observer] : observers_) {
+        const auto desiredIt = observer.desiredLodByTile.find(tileCoord);
+        if (desiredIt == observer.desiredLodByTile.end() || desiredIt->second < 0) {
+            continue;
+        }
+        if (combined < 0 || desiredIt->second < combined) {
+            combined = desiredIt->second;
+        }
+    }
+    return combined;
+}
+
+void MeshManager::refreshTilesLocked(int32_t pruneExtraChunks) {
+    // Single linear pass: release tiles that left every window (results still in flight
+    // for them are dropped on arrival) and refresh the rest.
+    auto refreshTile = [this, pruneExtraChunks](MeshTileState& tileState) {
+        if (!isTileWithinActiveWindowLocked(tileState.coord, pruneExtraChunks)) {
+            resetTileLocked(tileState);
+            return false;
+        }
+        tileState.desiredLod = combinedDesiredLodLocked(tileState.coord);
+        tileState.renderedLod = chooseRenderableLodForTileLocked(tileState);
         return true;
+    };
+
+    for (MeshTileState& tileState : tileGrid_) {
+        if (tileState.occupied) {
+            refreshTile(tileState);
+        }
     }
+    for (auto it = overflowTiles_.begin(); it != overflowTiles_.end();) {
+        if (refreshTile(it->second)) {
+            ++it;
+        } else {
+            it = overflowTiles_.erase(it);
+        }
+    }
+}
 
-    const int32_t radiusChunks = std::max(0, maxConfiguredRadius() + extraChunks);
-    const FootprintDistanceRange distances = footprintDistanceRangeForCell(
-        tileCoord.x,
-        tileCoord.y,
-        meshTileSizeChunks_,
-        lastScheduledCenterChunk_
-    );
+int32_t MeshManager::tileScore(const StreamingPolicy& policy, const MeshTileCoord& tileCoord) const {
+    glm::vec2 minBlocks{0.0f};
+    glm::vec2 maxBlocks{0.0f};
+    tileBoundsBlocks(tileCoord, minBlocks, maxBlocks);
+    const double distanceChunks =
+        static_cast<double>(policy.effectiveDistanceToRectBlocks(minBlocks, maxBlocks)) / cfg::CHUNK_SIZE;
+    return static_cast<int32_t>(std::min(
+        distanceChunks * distanceChunks,
+        static_cast<double>(std::numeric_limits<int32_t>::max())
+    ));
+}
 
-    return distances.minDistanceChunks <= radiusChunks;
+void MeshManager::tileBoundsBlocks(const MeshTileCoord& tileCoord, glm::vec2& outMin, glm::vec2& outMax) const {
+    const float tileSpanBlocks = static_cast<float>(meshTileSizeChunks_ * cfg::CHUNK_SIZE);
+    outMin = glm::vec2{static_cast<float>(tileCoord.x), static_cast<float>(tileCoord.y)} * tileSpanBlocks;
+    outMax = outMin + glm::vec2{tileSpanBlocks, tileSpanBlocks};
 }
 
-bool MeshManager::isTileFootprintGenerated(const MeshTileCoord& tileCoord) const {
-    const int32_t baseChunkX = tileCoord.x * meshTileSizeChunks_;
-    const int32_t baseChunkY = tileCoord.y * meshTileSizeChunks_;
+MeshManager::CellColumnBounds MeshManager::cellColumnBounds(const TileLodCellCoord& coord) const {
+    const int32_t spanChunks = static_cast<int32_t>(chunkSpanForLod(coord.tileLod.lodLevel));
+    const int32_t lodCellsPerAxis = std::max(1, meshTileSizeChunks_ / spanChunks);
+    const int32_t cellSpanLodCells = cellSpanLodCellsForLod(coord.tileLod.lodLevel);
+    const int32_t localStartX = static_cast<int32_t>(coord.cellX) * cellSpanLodCells;
+    const int32_t localEndX = std::min(lodCellsPerAxis, localStartX + cellSpanLodCells);
+    const int32_t localStartY = static_cast<int32_t>(coord.cellY) * cellSpanLodCells;
+    const int32_t localEndY = std::min(lodCellsPerAxis, localStartY + cellSpanLodCells);
+
+    const int32_t tileOriginChunkX = coord.tileLod.tile.x * meshTileSizeChunks_;
+    const int32_t tileOriginChunkY = coord.tileLod.tile.y * meshTileSizeChunks_;
+    return CellColumnBounds{
+        tileOriginChunkX + localStartX * spanChunks,
+        tileOriginChunkX + std::max(localStartX + 1, localEndX) * spanChunks - 1,
+        tileOriginChunkY + localStartY * spanChunks,
+        tileOriginChunkY + std::max(localStartY + 1, localEndY) * spanChunks - 1
+    };
+}
 
-    for (int32_t dy = 0; dy < meshTileSizeChunks_; ++dy) {
-        for (int32_t dx = 0; dx < meshTileSizeChunks_; ++dx) {
-            if (!world_.isColumnGenerated(ColumnCoord{baseChunkX + dx, baseChunkY + dy})) {
-                return false;
-            }
-        }
+TileLodCellCoord MeshManager::cellForColumn(const ColumnCoord& column, uint8_t lodLevel) const {
+    const int32_t spanChunks = static_cast<int32_t>(chunkSpanForLod(lodLevel));
+    const int32_t cellSpanChunks = spanChunks * cellSpanLodCellsForLod(lodLevel);
+    const int32_t localX = floor_mod(column.v.x, meshTileSizeChunks_);
+    const int32_t localY = floor_mod(column.v.y, meshTileSizeChunks_);
+    return TileLodCellCoord{
+        TileLodCoord{
+            MeshTileCoord{
+                floor_div(column.v.x, meshTileSizeChunks_),
+                floor_div(column.v.y, meshTileSizeChunks_)
+            },
+            lodLevel
+        },
+        static_cast<uint16_t>(localX / cellSpanChunks),
+        static_cast<uint16_t>(localY / cellSpanChunks)
+    };
+}
+
+MeshManager::CellDependencyState MeshManager::cellDependencyState(const TileLodCellCoord& coord) const {
+    const CellColumnBounds bounds = cellColumnBounds(coord);
+    if (!world_.isColumnRangeGenerated(ColumnCoord{bounds.minX, bounds.minY},
+                                       ColumnCoord{bounds.maxX, bounds.maxY})) {
+        return CellDependencyState::FootprintMissing;
+    }
+
+    // meshLodCell reads a one-voxel border at every mip, which always lies in the adjacent column.
+    const bool borderGenerated =
+        world_.isColumnRangeGenerated(ColumnCoord{bounds.minX - 1, bounds.minY - 1},
+                                      ColumnCoord{bounds.maxX + 1, bounds.minY - 1}) &&
+        world_.isColumnRangeGenerated(ColumnCoord{bounds.minX - 1, bounds.maxY + 1},
+                                      ColumnCoord{bounds.maxX + 1, bounds.maxY + 1}) &&
+        world_.isColumnRangeGenerated(ColumnCoord{bounds.minX - 1, bounds.minY},
+                                      ColumnCoord{bounds.minX - 1, bounds.maxY}) &&
+        world_.isColumnRangeGenerated(ColumnCoord{bounds.maxX + 1, bounds.minY},
+                                      ColumnCoord{bounds.maxX + 1, bounds.maxY});
+    return borderGenerated ? CellDependencyState::Ready : CellDependencyState::BorderMissing;
+}
+
+bool MeshManager::lookupColumnChunkMasks(const ColumnCoord& column,
+                                         std::unordered_map<ColumnCoord, ColumnChunkMasks>& maskCache,
+                                         ColumnChunkMasks& outMasks) const {
+    const auto cacheIt = maskCache.find(column);
+    if (cacheIt != maskCache.end()) {
+        outMasks = cacheIt->second;
+        return outMasks.known;
     }
 
-    return true;
+    outMasks = ColumnChunkMasks{};
+    outMasks.known = world_.tryGetColumnChunkMasks(column, outMasks.emptyMask, outMasks.fullMask);
+    maskCache.emplace(column, outMasks);
+    return outMasks.known;
 }
 
 bool MeshManager::isLodCellAllAir(const ChunkCoord& cellCoord,
                                   uint8_t lodLevel,
-                                  std::unordered_map<ColumnCoord, uint32_t>& emptyMaskCache) const {
+                                  std::unordered_map<ColumnCoord, ColumnChunkMasks>& maskCache) const {
     const int32_t spanChunks = static_cast<int32_t>(chunkSpanForLod(lodLevel));
     const int32_t zStart = cellCoord.v.z * spanChunks;
     if (zStart < 0 || zStart >= cfg::COLUMN_HEIGHT) {
@@ -1466,19 +1947,12 @@ bool MeshManager::isLodCellAllAir(const ChunkCoord& cellCoord,
     for (int32_t dy = 0; dy < spanChunks; ++dy) {
         for (int32_t dx = 0; dx < spanChunks; ++dx) {
             const ColumnCoord columnCoord{baseColumnX + dx, baseColumnY + dy};
-            uint32_t emptyMask = 0u;
-
-            const auto cacheIt = emptyMaskCache.find(columnCoord);
-            if (cacheIt != emptyMaskCache.end()) {
-                emptyMask = cacheIt->second;
-            } else {
-                if (!world_.tryGetColumnEmptyChunkMask(columnCoord, emptyMask)) {
-                    return false;
-                }
-                emptyMaskCache.emplace(columnCoord, emptyMask);
+            ColumnChunkMasks masks;
+            if (!lookupColumnChunkMasks(columnCoord, maskCache, masks)) {
+                return false;
             }
 
-            if ((emptyMask & zMask) != zMask) {
+            if ((masks.emptyMask & zMask) != zMask) {
                 return false;
             }
         }
@@ -1487,19 +1961,63 @@ bool MeshManager::isLodCellAllAir(const ChunkCoord& cellCoord,
     return true;
 }
 
-int8_t MeshManager::chooseRenderableLodForTileLocked(const MeshTileState& state) const {
-    auto hasMesh = [&state](int32_t lod) {
-        if (lod < 0) {
-            return false;
+bool MeshManager::isLodCellEnclosed(const ChunkCoord& cellCoord,
+                                    uint8_t lodLevel,
+                                    std::unordered_map<ColumnCoord, ColumnChunkMasks>& maskCache) const {
+    const int32_t spanChunks = static_cast<int32_t>(chunkSpanForLod(lodLevel));
+    const int32_t zStart = cellCoord.v.z * spanChunks;
+    // Padding above and below the world reads as air, so those faces are always exposed.
+    if (zStart <= 0 || zStart + spanChunks >= cfg::COLUMN_HEIGHT) {
+        return false;
+    }
+
+    // The padding is one voxel at this LOD, at most one chunk thick, so it only
+    // reaches the chunk layer adjacent to each face. Edges and corners are never read
+    // for face culling and are skipped.
+    const uint32_t spanMask = ((spanChunks >= 32) ? 0xFFFFFFFFu : ((1u << spanChunks) - 1u)) << zStart;
+    const uint32_t paddedMask = spanMask | (spanMask << 1u) | (spanMask >> 1u);
+
+    const int32_t baseColumnX = cellCoord.v.x * spanChunks;
+    const int32_t baseColumnY = cellCoord.v.y * spanChunks;
+
+    // The footprint's own columns first: they fail fastest near the surface.
+    for (int32_t dy = 0; dy < spanChunks; ++dy) {
+        for (int32_t dx = 0; dx < spanChunks; ++dx) {
+            ColumnChunkMasks masks;
+            if (!lookupColumnChunkMasks(ColumnCoord{baseColumnX + dx, baseColumnY + dy}, maskCache, masks) ||
+                (masks.fullMask & paddedMask) != paddedMask) {
+                return false;
+            }
         }
-        const auto lodIt = state.lodStates.find(static_cast<uint8_t>(lod));
-        if (lodIt == state.lodStates.end()) {
-            return false;
+    }
+
+    for (int32_t i = 0; i < spanChunks; ++i) {
+        const std::array<ColumnCoord, 4> sideColumns{
+            ColumnCoord{baseColumnX - 1, baseColumnY + i},
+            ColumnCoord{baseColumnX + spanChunks, baseColumnY + i},
+            ColumnCoord{baseColumnX + i, baseColumnY - 1},
+            ColumnCoord{baseColumnX + i, baseColumnY + spanChunks}
+        };
+        for (const ColumnCoord& sideColumn : sideColumns) {
+            ColumnChunkMasks masks;
+            if (!lookupColumnChunkMasks(sideColumn, maskCache, masks) ||
+                (masks.fullMask & spanMask) != spanMask) {
+                return false;
+            }
         }
-        if (lodIt->second.expectedCellCount <= 0) {
+    }
+
+    return true;
+}
+
+int8_t MeshManager::chooseRenderableLodForTileLocked(const MeshTileState& state) const {
+    const int32_t lodCount = static_cast<int32_t>(config_.lodChunkRadii.size());
+    auto hasMesh = [&state, lodCount](int32_t lod) {
+        if (lod < 0 || lod >= lodCount) {
             return false;
         }
-        return static_cast<int32_t>(lodIt->second.cellMeshes.size()) >= lodIt->second.expectedCellCount;
+        const MeshTileLodState& lodState = state.lodStates[static_cast<size_t>(lod)];
+        return lodState.expectedCellCount > 0 && lodState.meshedCellCount >= lodState.expectedCellCount;
     };
 
     if (state.desiredLod >= 0 && hasMesh(state.desiredLod)) {
@@ -1510,7 +2028,6 @@ int8_t MeshManager::chooseRenderableLodForTileLocked(const MeshTileState& state)
         return state.renderedLod;
     }
 
-    const int32_t lodCount = static_cast<int32_t>(config_.lodChunkRadii.size());
     if (state.desiredLod >= 0) {
         for (int32_t lod = static_cast<int32_t>(state.desiredLod) + 1; lod < lodCount; ++lod) {
             if (hasMesh(lod)) {
@@ -1524,25 +2041,84 @@ int8_t MeshManager::chooseRenderableLodForTileLocked(const MeshTileState& state)
         }
     }
 
-    int8_t coarsest = -1;
-    for (const auto& [lod, lodState] : state.lodStates) {
-        if (lodState.expectedCellCount <= 0) {
-            continue;
+    for (int32_t lod = lodCount - 1; lod >= 0; --lod) {
+        if (hasMesh(lod)) {
+            return static_cast<int8_t>(lod);
         }
-        if (static_cast<int32_t>(lodState.cellMeshes.size()) < lodState.expectedCellCount) {
-            continue;
-        }
-        if (static_cast<int8_t>(lod) > coarsest) {
-            coarsest = static_cast<int8_t>(lod);
+    }
+    return -1;
+}
+
+size_t MeshManager::tileSlotIndex(const MeshTileCoord& tileCoord) const {
+    const int32_t mask = tileGridExtent_ - 1;
+    return static_cast<size_t>(tileCoord.y & mask) * static_cast<size_t>(tileGridExtent_) +
+           static_cast<size_t>(tileCoord.x & mask);
+}
+
+MeshManager::MeshTileState* MeshManager::findTileLocked(const MeshTileCoord& tileCoord) {
+    return const_cast<MeshTileState*>(static_cast<const MeshManager*>(this)->findTileLocked(tileCoord));
+}
+
+const MeshManager::MeshTileState* MeshManager::findTileLocked(const MeshTileCoord& tileCoord) const {
+    const MeshTileState& tileState = tileGrid_[tileSlotIndex(tileCoord)];
+    if (tileState.occupied && tileState.coord == tileCoord) {
+        return &tileState;
+    }
+    if (overflowTiles_.empty()) {
+        return nullptr;
+    }
+    const auto overflowIt = overflowTiles_.find(tileCoord);
+    return (overflowIt != overflowTiles_.end()) ? &overflowIt->second : nullptr;
+}
+
+MeshManager::MeshTileState* MeshManager::acquireTileLocked(const MeshTileCoord& tileCoord) {
+    if (!isTileWithinActiveWindowLocked(tileCoord, tileGridWindowExtraChunks_)) {
+        return nullptr;
+    }
+
+    if (MeshTileState* existing = findTileLocked(tileCoord)) {
+        return existing;
+    }
+
+    // One observer's window never wraps onto itself, so a live owner means another
+    // observer a grid width away holds the slot; spill instead of evicting it.
+    MeshTileState& tileState = tileGrid_[tileSlotIndex(tileCoord)];
+    if (tileState.occupied && isTileWithinActiveWindowLocked(tileState.coord, tileGridWindowExtraChunks_)) {
+        MeshTileState& overflowState = overflowTiles_[tileCoord];
+        overflowState.coord = tileCoord;
+        overflowState.occupied = true;
+        return &overflowState;
+    }
+
+    resetTileLocked(tileState);
+    tileState.coord = tileCoord;
+    tileState.occupied = true;
+    return &tileState;
+}
+
+void MeshManager::resetTileLocked(MeshTileState& tileState) {
+    for (MeshTileLodState& lodState : tileState.lodStates) {
+        for (std::vector<Meshlet>& cellMeshlets : lodState.cellMeshes) {
+            cellMeshlets.clear();
         }
+        std::fill(lodState.cellMeshed.begin(), lodState.cellMeshed.end(), uint8_t{0});
+        lodState.meshedCellCount = 0;
     }
-    return coarsest;
+    tileState.occupied = false;
+    tileState.desiredLod = -1;
+    tileState.renderedLod = -1;
 }
 
-void MeshManager::refreshRenderedLodsLocked() {
-    for (auto& [_, tileState] : meshTiles_) {
-        tileState.renderedLod = chooseRenderableLodForTileLocked(tileState);
+void MeshManager::prepareLodCellsLocked(MeshTileLodState& lodState, uint8_t lodLevel) const {
+    const int32_t cellsPerAxis = cellCountPerAxisForLod(lodLevel);
+    const int32_t cellCount = cellsPerAxis * cellsPerAxis;
+    if (lodState.expectedCellCount == cellCount) {
+        return;
     }
+    lodState.expectedCellCount = cellCount;
+    lodState.cellMeshes.assign(static_cast<size_t>(cellCount), {});
+    lodState.cellMeshed.assign(static_cast<size_t>(cellCount), 0u);
+    lodState.meshedCellCount = 0;
 }
 
 int32_t MeshManager::cellSpanChunksForLod(uint8_t lodLevel) const {
@@ -1562,8 +2138,9 @@ int32_t MeshManager::cellCountPerAxisForLod(uint8_t lodLevel) const {
     return std::max(1, (lodCellsPerAxis + cellSpanLodCells - 1) / cellSpanLodCells);
 }
 
-uint32_t MeshManager::packCellKey(uint16_t cellX, uint16_t cellY) const {
-    return (static_cast<uint32_t>(cellY) << 16u) | static_cast<uint32_t>(cellX);
+size_t MeshManager::cellSlotIndex(const TileLodCellCoord& coord) const {
+    const int32_t cellsPerAxis = cellCountPerAxisForLod(coord.tileLod.lodLevel);
+    return static_cast<size_t>(coord.cellY) * static_cast<size_t>(cellsPerAxis) + static_cast<size_t>(coord.cellX);
 }
 
 bool MeshManager::tileInBounds(const MeshTileCoord& tileCoord,
@@ -1594,6 +2171,22 @@ int32_t MeshManager::chunkZCountForLod(uint8_t lodLevel) {
     return std::max(1, cfg::COLUMN_HEIGHT / spanChunks);
 }
 
+uint32_t MeshManager::allCellZMask(uint8_t lodLevel) {
+    static_assert(cfg::COLUMN_HEIGHT <= 32, "LOD cell z masks are 32 bits");
+    const int32_t zCount = chunkZCountForLod(lodLevel);
+    return (zCount >= 32) ? 0xFFFFFFFFu : ((1u << zCount) - 1u);
+}
+
+uint32_t MeshManager::cellZMaskForChunks(uint32_t chunkZMask, uint8_t lodLevel) {
+    uint32_t cellMask = 0;
+    for (int32_t chunkZ = 0; chunkZ < cfg::COLUMN_HEIGHT; ++chunkZ) {
+        if ((chunkZMask & (uint32_t{1} << chunkZ)) != 0) {
+            cellMask |= uint32_t{1} << (chunkZ >> lodLevel);
+        }
+    }
+    return cellMask & allCellZMask(lodLevel);
+}
+
 jobsystem::Priority MeshManager::priorityFromLodLevel(uint8_t lodLevel) {
     if (lodLevel == 0) {
         return jobsystem::Priority::Critical;
@@ -1643,4 +2236,13 @@ void MeshManager::sanitizeConfig(Config& config) {
         config.lodSseFallbackProjectionScale <= 0.0f) {
         config.lodSseFallbackProjectionScale = 390.0f;
     }
+    if (!std::isfinite(config.meshDependencyDeadlineSeconds) || config.meshDependencyDeadlineSeconds < 0.0f) {
+        config.meshDependencyDeadlineSeconds = 0.5f;
+    }
+    if (!std::isfinite(config.completionBudgetMinMs) || config.completionBudgetMinMs <= 0.0f) {
+        config.completionBudgetMinMs = 1.0f;
+    }
+    if (!std::isfinite(config.meshUpdateTargetMs) || config.meshUpdateTargetMs < config.completionBudgetMinMs) {
+        config.meshUpdateTargetMs = std::max(8.0f, config.completionBudgetMinMs);
+    }
 }
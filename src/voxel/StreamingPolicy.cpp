@@ -0,0 +1,125 @@
+#include "solum_engine/voxel/StreamingPolicy.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace {
+glm::vec2 horizontalDirection(const glm::vec3& vector, float& outLength) {
+    const glm::vec2 horizontal{vector.x, vector.y};
+    outLength = glm::length(horizontal);
+    if (!std::isfinite(outLength) || outLength <= 1e-4f) {
+        outLength = 0.0f;
+        return glm::vec2{0.0f, 0.0f};
+    }
+    return horizontal / outLength;
+}
+}  // namespace
+
+StreamingPolicy::StreamingPolicy()
+    : StreamingPolicy(Config{}) {}
+
+StreamingPolicy::StreamingPolicy(Config config)
+    : config_(std::move(config)) {
+    sanitizeConfig(config_);
+}
+
+void StreamingPolicy::setView(const StreamingView& view) {
+    view_ = view;
+    hasView_ = true;
+
+    // Looking straight down or up has no meaningful horizontal cone.
+    float forwardLength = 0.0f;
+    forwardXY_ = horizontalDirection(view.forward, forwardLength);
+    forwardWeight_ = std::clamp(forwardLength, 0.0f, 1.0f);
+
+    glm::vec2 lookahead = glm::vec2{view.velocity.x, view.velocity.y} * config_.lookaheadSeconds;
+    const float lookaheadLength = glm::length(lookahead);
+    if (!std::isfinite(lookaheadLength)) {
+        lookahead = glm::vec2{0.0f, 0.0f};
+    } else if (lookaheadLength > config_.maxLookaheadBlocks) {
+        lookahead *= config_.maxLookaheadBlocks / lookaheadLength;
+    }
+    predictedXY_ = glm::vec2{view.position.x, view.position.y} + lookahead;
+}
+
+float StreamingPolicy::effectiveDistanceBlocks(const glm::vec2& pointXY) const {
+    const glm::vec2 currentXY{view_.position.x, view_.position.y};
+    const float distance = std::min(glm::length(pointXY - currentXY), glm::length(pointXY - predictedXY_));
+    return distance * directionScale(pointXY);
+}
+
+float StreamingPolicy::effectiveDistanceToRectBlocks(const glm::vec2& minXY, const glm::vec2& maxXY) const {
+    const glm::vec2 currentXY{view_.position.x, view_.position.y};
+    const float currentDistance = glm::length(currentXY - glm::clamp(currentXY, minXY, maxXY));
+    const float predictedDistance = glm::length(predictedXY_ - glm::clamp(predictedXY_, minXY, maxXY));
+    return std::min(currentDistance, predictedDistance) * directionScale((minXY + maxXY) * 0.5f);
+}
+
+jobsystem::Priority StreamingPolicy::demoteOutOfView(jobsystem::Priority priority,
+                                                     const glm::vec2& minXY,
+                                                     const glm::vec2& maxXY) const {
+    if (priority == jobsystem::Priority::Low || directionScale((minXY + maxXY) * 0.5f) <= 1.0f) {
+        return priority;
+    }
+    return static_cast<jobsystem::Priority>(static_cast<uint8_t>(priority) - 1u);
+}
+
+bool StreamingPolicy::differsSignificantly(const StreamingView& view) const {
+    if (!hasView_) {
+        return true;
+    }
+
+    constexpr float kForwardCosineThreshold = 0.94f;
+    constexpr float kVelocityThresholdBlocksPerSecond = 8.0f;
+
+    float forwardLength = 0.0f;
+    const glm::vec2 forwardXY = horizontalDirection(view.forward, forwardLength);
+    if (std::abs(std::clamp(forwardLength, 0.0f, 1.0f) - forwardWeight_) > 0.25f) {
+        return true;
+    }
+    if (forwardWeight_ > 0.0f && glm::dot(forwardXY, forwardXY_) < kForwardCosineThreshold) {
+        return true;
+    }
+    const glm::vec2 velocityDelta{view.velocity.x - view_.velocity.x, view.velocity.y - view_.velocity.y};
+    return glm::length(velocityDelta) > kVelocityThresholdBlocksPerSecond;
+}
+
+float StreamingPolicy::directionScale(const glm::vec2& pointXY) const {
+    if (forwardWeight_ <= 0.0f) {
+        return 1.0f;
+    }
+
+    const glm::vec2 offset = pointXY - glm::vec2{view_.position.x, view_.position.y};
+    const float distance = glm::length(offset);
+    if (distance <= config_.nearRadiusBlocks) {
+        return 1.0f;
+    }
+
+    const float cosine = glm::dot(offset / distance, forwardXY_);
+    if (cosine >= config_.viewConeCosine) {
+        return 1.0f;
+    }
+
+    const float outsideCone = (config_.viewConeCosine - cosine) / (config_.viewConeCosine + 1.0f);
+    return 1.0f + (config_.behindDistanceScale - 1.0f) * std::clamp(outsideCone, 0.0f, 1.0f) * forwardWeight_;
+}
+
+void StreamingPolicy::sanitizeConfig(Config& config) {
+    if (!std::isfinite(config.lookaheadSeconds) || config.lookaheadSeconds < 0.0f) {
+        config.lookaheadSeconds = 0.0f;
+    }
+    if (!std::isfinite(config.maxLookaheadBlocks) || config.maxLookaheadBlocks < 0.0f) {
+        config.maxLookaheadBlocks = 0.0f;
+    }
+    if (!std::isfinite(config.viewConeCosine)) {
+        config.viewConeCosine = 0.5f;
+    }
+    config.viewConeCosine = std::clamp(config.viewConeCosine, -0.99f, 1.0f);
+    if (!std::isfinite(config.behindDistanceScale) || config.behindDistanceScale < 1.0f) {
+        config.behindDistanceScale = 1.0f;
+    }
+    if (!std::isfinite(config.nearRadiusBlocks) || config.nearRadiusBlocks < 0.0f) {
+        config.nearRadiusBlocks = 0.0f;
+    }
+}
@@ -23,6 +23,8 @@ constexpr float kNoiseVerticalFrequency = 0.08f;
 constexpr float kNoiseMaxStrengthBlocks = 12.0f;
 constexpr float kNoiseFalloffBlocks = 20.0f;
 constexpr float kGrassFlatnessThreshold = 0.75f;
+constexpr uint16_t kStoneMaterialId = 1;
+constexpr uint16_t kGrassMaterialId = 2;
 
 struct HeightmapData {
     int width = 0;
@@ -282,11 +284,29 @@ int findSurfaceForStructure(int worldX, int worldY, const DensityFn& densityAtWo
 
 } // namespace
 
+int TerrainGenerator::sampleHeightmapSurface(int worldX, int worldY) {
+    return sampleTerrainHeight(getHeightmapData(), worldX, worldY);
+}
+
+uint16_t TerrainGenerator::surfaceMaterialIdForFlatness(float flatness) {
+    return (flatness >= kGrassFlatnessThreshold) ? kGrassMaterialId : kStoneMaterialId;
+}
+
 void TerrainGenerator::generateColumn(const glm::ivec3& origin, Column& col) {
+    generateColumn(origin, col, 0);
+}
+
+void TerrainGenerator::generateColumn(const glm::ivec3& origin, Column& col, uint8_t minMip) {
+    const uint8_t mipLevel = std::min<uint8_t>(minMip, Chunk::MAX_MIP_LEVEL);
+    if (mipLevel > 0) {
+        generateCoarseColumn(origin, col, mipLevel);
+        return;
+    }
+
     const HeightmapData& heightmap = getHeightmapData();
 
-    UnpackedBlockMaterial stone{1, 0, Direction::PlusZ, 0};
-    UnpackedBlockMaterial grass{2, 0, Direction::PlusZ, 0};
+    UnpackedBlockMaterial stone{kStoneMaterialId, 0, Direction::PlusZ, 0};
+    UnpackedBlockMaterial grass{kGrassMaterialId, 0, Direction::PlusZ, 0};
     UnpackedBlockMaterial air{0, 0, Direction::PlusZ, 0};
 
     const BlockMaterial stonePacked = stone.pack();
@@ -426,6 +446,9 @@ void TerrainGenerator::generateColumn(const glm::ivec3& origin, Column& col) {
         return;
     }
 
+    // Anchors inside this column read the bare terrain surface instead of re-sampling density.
+    col.rebuildSurfaceMetadata();
+
     const int32_t placementPadding = std::max(0, structureManager.maxHorizontalReach());
     const glm::ivec2 placementMin{
         origin.x - placementPadding,
@@ -443,12 +466,11 @@ void TerrainGenerator::generateColumn(const glm::ivec3& origin, Column& col) {
     const glm::ivec3 clipMax{origin.x + kChunkSize, origin.y + kChunkSize, kColumnHeight};
 
     for (const StructureManager::PlacementPoint& point : placementPoints) {
-        const int32_t surfaceZ = findSurfaceForStructure(
-            point.worldXY.x,
-            point.worldXY.y,
-            densityAtWorld,
-            cachedHeightAtWorld
-        );
+        const int localX = point.worldXY.x - origin.x;
+        const int localY = point.worldXY.y - origin.y;
+        const int32_t surfaceZ = (localX >= 0 && localX < kChunkSize && localY >= 0 && localY < kChunkSize)
+            ? col.surfaceHeight(static_cast<uint8_t>(localX), static_cast<uint8_t>(localY))
+            : findSurfaceForStructure(point.worldXY.x, point.worldXY.y, densityAtWorld, cachedHeightAtWorld);
         if (surfaceZ < 0 || (surfaceZ + 1) >= kColumnHeight) {
             continue;
         }
@@ -461,3 +483,126 @@ void TerrainGenerator::generateColumn(const glm::ivec3& origin, Column& col) {
         structureManager.placeStructureForPoint(point, anchorWorld, clipMin, clipMax, col);
     }
 }
+
+void TerrainGenerator::generateCoarseColumn(const glm::ivec3& origin, Column& col, uint8_t mipLevel) {
+    const HeightmapData& heightmap = getHeightmapData();
+
+    const BlockMaterial stonePacked = UnpackedBlockMaterial{kStoneMaterialId, 0, Direction::PlusZ, 0}.pack();
+    const BlockMaterial grassPacked = UnpackedBlockMaterial{kGrassMaterialId, 0, Direction::PlusZ, 0}.pack();
+    const BlockMaterial airPacked = UnpackedBlockMaterial{0, 0, Direction::PlusZ, 0}.pack();
+
+    // Every coarse cell is represented by the terrain sample at its center.
+    const int cellScale = 1 << mipLevel;
+    const int cellCenterOffset = cellScale / 2;
+    const int cellsPerChunk = cfg::CHUNK_SIZE >> mipLevel;
+    const int columnCells = cfg::COLUMN_HEIGHT_BLOCKS >> mipLevel;
+    const int heightCacheExtent = cellsPerChunk + 2; // cell x/y in [-1, cellsPerChunk]
+
+    auto cellToWorldX = [&](int cellX) { return origin.x + cellX * cellScale + cellCenterOffset; };
+    auto cellToWorldY = [&](int cellY) { return origin.y + cellY * cellScale + cellCenterOffset; };
+    auto cellToWorldZ = [&](int cellZ) { return origin.z + cellZ * cellScale + cellCenterOffset; };
+
+    std::vector<int> heightCache(static_cast<size_t>(heightCacheExtent) * static_cast<size_t>(heightCacheExtent), 0);
+    for (int cellY = -1; cellY <= cellsPerChunk; ++cellY) {
+        for (int cellX = -1; cellX <= cellsPerChunk; ++cellX) {
+            const size_t cacheIndex =
+                static_cast<size_t>(cellY + 1) * static_cast<size_t>(heightCacheExtent) +
+                static_cast<size_t>(cellX + 1);
+            heightCache[cacheIndex] = sampleTerrainHeight(heightmap, cellToWorldX(cellX), cellToWorldY(cellY));
+        }
+    }
+
+    auto densityAtCell = [&](int cellX, int cellY, int cellZ) -> float {
+        if (cellZ < 0 || cellZ >= columnCells) {
+            return -1.0f;
+        }
+        const size_t cacheIndex =
+            static_cast<size_t>(cellY + 1) * static_cast<size_t>(heightCacheExtent) +
+            static_cast<size_t>(cellX + 1);
+        return sampleDensity(
+            fnGenerator,
+            cellToWorldX(cellX),
+            cellToWorldY(cellY),
+            cellToWorldZ(cellZ),
+            heightCache[cacheIndex]
+        );
+    };
+
+    auto cellIndex = [cellsPerChunk](int x, int y, int z) -> size_t {
+        return (static_cast<size_t>(z) * static_cast<size_t>(cellsPerChunk) + static_cast<size_t>(y)) *
+                   static_cast<size_t>(cellsPerChunk) +
+               static_cast<size_t>(x);
+    };
+
+    auto cellInBounds = [cellsPerChunk, columnCells](int x, int y, int z) {
+        return x >= 0 && y >= 0 && z >= 0 && x < cellsPerChunk && y < cellsPerChunk && z < columnCells;
+    };
+
+    const size_t columnCellCount =
+        static_cast<size_t>(cellsPerChunk) * static_cast<size_t>(cellsPerChunk) * static_cast<size_t>(columnCells);
+    std::vector<float> densityField(columnCellCount, 0.0f);
+    for (int z = 0; z < columnCells; ++z) {
+        for (int y = 0; y < cellsPerChunk; ++y) {
+            for (int x = 0; x < cellsPerChunk; ++x) {
+                densityField[cellIndex(x, y, z)] = densityAtCell(x, y, z);
+            }
+        }
+    }
+
+    auto densityAtLocalOrBorder = [&](int x, int y, int z) -> float {
+        if (cellInBounds(x, y, z)) {
+            return densityField[cellIndex(x, y, z)];
+        }
+        return densityAtCell(x, y, z);
+    };
+
+    const std::array<glm::ivec3, 6> neighborOffsets = {
+        glm::ivec3{+1, 0, 0},
+        glm::ivec3{-1, 0, 0},
+        glm::ivec3{0, +1, 0},
+        glm::ivec3{0, -1, 0},
+        glm::ivec3{0, 0, +1},
+        glm::ivec3{0, 0, -1},
+    };
+
+    const size_t chunkCellCount =
+        static_cast<size_t>(cellsPerChunk) * static_cast<size_t>(cellsPerChunk) * static_cast<size_t>(cellsPerChunk);
+    std::vector<BlockMaterial> chunkBlocks(chunkCellCount, airPacked);
+
+    for (int chunkZ = 0; chunkZ < cfg::COLUMN_HEIGHT; ++chunkZ) {
+        for (int localZ = 0; localZ < cellsPerChunk; ++localZ) {
+            const int z = chunkZ * cellsPerChunk + localZ;
+            for (int y = 0; y < cellsPerChunk; ++y) {
+                for (int x = 0; x < cellsPerChunk; ++x) {
+                    BlockMaterial block = airPacked;
+                    if (densityField[cellIndex(x, y, z)] >= 0.0f) {
+                        block = stonePacked;
+
+                        bool hasExposedFace = false;
+                        for (const glm::ivec3& offset : neighborOffsets) {
+                            if (densityAtLocalOrBorder(x + offset.x, y + offset.y, z + offset.z) < 0.0f) {
+                                hasExposedFace = true;
+                                break;
+                            }
+                        }
+
+                        if (hasExposedFace) {
+                            const float dx = densityAtLocalOrBorder(x + 1, y, z) - densityAtLocalOrBorder(x - 1, y, z);
+                            const float dy = densityAtLocalOrBorder(x, y + 1, z) - densityAtLocalOrBorder(x, y - 1, z);
+                            const float dz = densityAtLocalOrBorder(x, y, z + 1) - densityAtLocalOrBorder(x, y, z - 1);
+                            const float gradLenSq = (dx * dx) + (dy * dy) + (dz * dz);
+                            const float flatness = (gradLenSq > 1e-6f) ? (std::abs(dz) / std::sqrt(gradLenSq)) : 1.0f;
+                            block = (flatness >= kGrassFlatnessThreshold) ? grassPacked : stonePacked;
+                        }
+                    }
+                    chunkBlocks[cellIndex(x, y, localZ)] = block;
+                }
+            }
+        }
+
+        col.getChunk(static_cast<uint8_t>(chunkZ)).fillMipLevel(mipLevel, chunkBlocks);
+    }
+
+    // Structures are sub-cell detail at coarse mips; they appear once the column is upgraded.
+    col.rebuildChunkMasks();
+}
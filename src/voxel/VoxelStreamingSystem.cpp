@@ -10,115 +10,160 @@
 
 namespace {
 struct PreparedMeshUploadData {
-    std::vector<MeshletMetadataGPU> metadata;
+    std::vector<MeshletDescriptorGPU> metadata;
     std::vector<uint32_t> quadData;
-    std::vector<MeshletAabbGPU> meshletAabbsGpu;
     std::vector<MeshletAabb> meshletBounds;
+    std::vector<MeshletGroupGPU> meshletGroups;
     uint32_t totalMeshletCount = 0;
     uint32_t totalQuadCount = 0;
+    // Meshlets that do not fit a descriptor; reported through the streaming stats.
+    uint32_t rejectedMeshletCount = 0;
     uint32_t requiredMeshletCapacity = 64u;
-    uint32_t requiredQuadCapacity = 64u * MESHLET_QUAD_CAPACITY * MESHLET_QUAD_DATA_WORD_STRIDE;
+    uint32_t requiredQuadCapacity = 1024u * MESHLET_QUAD_DATA_WORD_STRIDE;
+    glm::ivec3 meshletOriginBase{0, 0, 0};
 };
 
-MeshletAabb computeMeshletAabb(const Meshlet& meshlet) {
-    if (meshlet.quadCount == 0u) {
-        const glm::vec3 origin = glm::vec3(meshlet.origin);
-        return MeshletAabb{origin, origin};
-    }
-
-    static const std::array<std::array<glm::vec3, 4>, 6> kFaceCornerOffsets{{
-        {{glm::vec3{1.0f, 0.0f, 0.0f}, glm::vec3{1.0f, 1.0f, 0.0f}, glm::vec3{1.0f, 0.0f, 1.0f}, glm::vec3{1.0f, 1.0f, 1.0f}}},
-        {{glm::vec3{0.0f, 0.0f, 0.0f}, glm::vec3{0.0f, 0.0f, 1.0f}, glm::vec3{0.0f, 1.0f, 0.0f}, glm::vec3{0.0f, 1.0f, 1.0f}}},
-        {{glm::vec3{0.0f, 1.0f, 0.0f}, glm::vec3{0.0f, 1.0f, 1.0f}, glm::vec3{1.0f, 1.0f, 0.0f}, glm::vec3{1.0f, 1.0f, 1.0f}}},
-        {{glm::vec3{0.0f, 0.0f, 0.0f}, glm::vec3{1.0f, 0.0f, 0.0f}, glm::vec3{0.0f, 0.0f, 1.0f}, glm::vec3{1.0f, 0.0f, 1.0f}}},
-        {{glm::vec3{0.0f, 0.0f, 1.0f}, glm::vec3{1.0f, 0.0f, 1.0f}, glm::vec3{0.0f, 1.0f, 1.0f}, glm::vec3{1.0f, 1.0f, 1.0f}}},
-        {{glm::vec3{0.0f, 0.0f, 0.0f}, glm::vec3{0.0f, 1.0f, 0.0f}, glm::vec3{1.0f, 0.0f, 0.0f}, glm::vec3{1.0f, 1.0f, 0.0f}}},
-    }};
-
-    const uint32_t safeFaceDirection = std::min(meshlet.faceDirection, 5u);
-    const float voxelScale = static_cast<float>(std::max(meshlet.voxelScale, 1u));
-
-    bool firstVertex = true;
-    glm::vec3 minCorner{0.0f};
-    glm::vec3 maxCorner{0.0f};
-
+// Inclusive range of the quads' local offsets; the descriptor turns it back into exact face bounds.
+void computeMeshletLocalBounds(const Meshlet& meshlet, glm::uvec3& outMin, glm::uvec3& outMax) {
+    outMin = glm::uvec3(0u);
+    outMax = glm::uvec3(0u);
     for (uint32_t quadIndex = 0; quadIndex < meshlet.quadCount; ++quadIndex) {
         const glm::uvec3 local = unpackMeshletLocalOffset(meshlet.packedQuadLocalOffsets[quadIndex]);
-        const glm::vec3 quadBase = glm::vec3(meshlet.origin) + (glm::vec3(local) * voxelScale);
-        for (const glm::vec3& cornerOffset : kFaceCornerOffsets[safeFaceDirection]) {
-            const glm::vec3 vertex = quadBase + (cornerOffset * voxelScale);
-            if (firstVertex) {
-                minCorner = vertex;
-                maxCorner = vertex;
-                firstVertex = false;
-                continue;
-            }
-            minCorner = glm::min(minCorner, vertex);
-            maxCorner = glm::max(maxCorner, vertex);
-        }
+        outMin = (quadIndex == 0u) ? local : glm::min(outMin, local);
+        outMax = (quadIndex == 0u) ? local : glm::max(outMax, local);
     }
-
-    return MeshletAabb{minCorner, maxCorner};
 }
 
-MeshletAabbGPU toGpuAabb(const MeshletAabb& aabb) {
-    return MeshletAabbGPU{
-        glm::vec4(aabb.minCorner, 0.0f),
-        glm::vec4(aabb.maxCorner, 0.0f)
-    };
+// Groups index the compacted arrays, so empty meshlets skipped inside a range shift its start.
+void appendMeshletGroup(PreparedMeshUploadData& prepared, uint32_t firstMeshlet) {
+    const uint32_t endMeshlet = static_cast<uint32_t>(prepared.metadata.size());
+    for (uint32_t first = firstMeshlet; first < endMeshlet; first += MESHLET_GROUP_MAX_MESHLETS) {
+        const uint32_t count = std::min(MESHLET_GROUP_MAX_MESHLETS, endMeshlet - first);
+        MeshletGroupGPU group{};
+        group.minCorner = glm::vec4(prepared.meshletBounds[first].minCorner, 0.0f);
+        group.maxCorner = glm::vec4(prepared.meshletBounds[first].maxCorner, 0.0f);
+        for (uint32_t i = first + 1u; i < first + count; ++i) {
+            group.minCorner = glm::min(group.minCorner, glm::vec4(prepared.meshletBounds[i].minCorner, 0.0f));
+            group.maxCorner = glm::max(group.maxCorner, glm::vec4(prepared.meshletBounds[i].maxCorner, 0.0f));
+        }
+        group.firstMeshlet = first;
+        group.meshletCount = count;
+        prepared.meshletGroups.push_back(group);
+    }
 }
 
-PreparedMeshUploadData prepareMeshUploadData(const std::vector<Meshlet>& meshlets) {
+PreparedMeshUploadData prepareMeshUploadData(const std::vector<Meshlet>& meshlets,
+                                             const std::vector<MeshletGroupRange>& groups,
+                                             const ColumnCoord& centerColumn) {
     PreparedMeshUploadData prepared;
+    prepared.meshletOriginBase = chunk_to_block_origin(column_local_to_chunk(centerColumn, 0)).v;
 
     for (const Meshlet& meshlet : meshlets) {
         if (meshlet.quadCount == 0) {
             continue;
         }
         ++prepared.totalMeshletCount;
-        prepared.totalQuadCount += meshlet.quadCount * MESHLET_QUAD_DATA_WORD_STRIDE;
+        // Upper bound for the reserve below; the palettes are usually far smaller.
+        prepared.totalQuadCount += meshlet.quadCount * MESHLET_QUAD_DATA_WORD_STRIDE +
+                                   meshletPaletteWordCount(meshlet.quadCount);
     }
 
     prepared.metadata.reserve(prepared.totalMeshletCount);
     prepared.quadData.reserve(prepared.totalQuadCount);
-    prepared.meshletAabbsGpu.reserve(prepared.totalMeshletCount);
     prepared.meshletBounds.reserve(prepared.totalMeshletCount);
 
-    for (const Meshlet& meshlet : meshlets) {
+    const Meshlet* previousMeshlet = nullptr;
+    uint32_t ordinal = 0;
+    size_t nextGroup = 0;
+    uint32_t groupStart = 0;
+    for (size_t meshletIndex = 0; meshletIndex < meshlets.size(); ++meshletIndex) {
+        // Without snapshot groups every run of MESHLET_GROUP_MAX_MESHLETS becomes its own group.
+        const bool startsGroup = groups.empty()
+            ? (meshletIndex % MESHLET_GROUP_MAX_MESHLETS) == 0u
+            : (nextGroup < groups.size() && groups[nextGroup].firstMeshlet == meshletIndex);
+        if (startsGroup) {
+            appendMeshletGroup(prepared, groupStart);
+            groupStart = static_cast<uint32_t>(prepared.metadata.size());
+            ++nextGroup;
+        }
+
+        const Meshlet& meshlet = meshlets[meshletIndex];
         if (meshlet.quadCount == 0) {
             continue;
         }
 
-        MeshletMetadataGPU metadata{};
-        metadata.originX = meshlet.origin.x;
-        metadata.originY = meshlet.origin.y;
-        metadata.originZ = meshlet.origin.z;
-        metadata.quadCount = meshlet.quadCount;
-        metadata.faceDirection = meshlet.faceDirection;
-        metadata.dataOffset = static_cast<uint32_t>(prepared.quadData.size());
-        metadata.voxelScale = std::max(meshlet.voxelScale, 1u);
-        prepared.metadata.push_back(metadata);
-        const MeshletAabb meshletBounds = computeMeshletAabb(meshlet);
-        prepared.meshletAabbsGpu.push_back(toGpuAabb(meshletBounds));
-        prepared.meshletBounds.push_back(meshletBounds);
-
-        for (uint32_t i = 0; i < meshlet.quadCount; ++i) {
-            prepared.quadData.push_back(packMeshletQuadData(
-                meshlet.packedQuadLocalOffsets[i],
-                meshlet.quadMaterialIds[i]
-            ));
-            prepared.quadData.push_back(static_cast<uint32_t>(meshlet.quadAoData[i]));
+        // Split face buckets are emitted back to back, so a running ordinal tells them apart.
+        const bool continuesGroup = previousMeshlet != nullptr &&
+            previousMeshlet->origin == meshlet.origin &&
+            previousMeshlet->faceDirection == meshlet.faceDirection &&
+            previousMeshlet->voxelScale == meshlet.voxelScale;
+        ordinal = continuesGroup ? ordinal + 1u : 0u;
+        previousMeshlet = &meshlet;
+
+        MeshletDescriptor descriptor;
+        descriptor.origin = meshlet.origin;
+        descriptor.faceDirection = meshlet.faceDirection;
+        descriptor.quadCount = meshlet.quadCount;
+        descriptor.voxelScale = std::max(meshlet.voxelScale, 1u);
+        descriptor.dataOffset = static_cast<uint32_t>(prepared.quadData.size());
+        descriptor.ordinal = ordinal;
+        computeMeshletLocalBounds(meshlet, descriptor.boundsMin, descriptor.boundsMax);
+
+        MeshletDescriptorGPU encoded{};
+        if (!encodeMeshletDescriptor(descriptor, prepared.meshletOriginBase, encoded)) {
+            ++prepared.rejectedMeshletCount;
+            continue;
         }
+        prepared.metadata.push_back(encoded);
+        prepared.meshletBounds.push_back(meshletDescriptorAabb(descriptor));
+
+        appendMeshletQuadData(meshlet, prepared.quadData);
     }
+    appendMeshletGroup(prepared, groupStart);
+
+    prepared.totalMeshletCount -= prepared.rejectedMeshletCount;
+    prepared.totalQuadCount = static_cast<uint32_t>(prepared.quadData.size());
 
     prepared.requiredMeshletCapacity = std::max(prepared.totalMeshletCount + 16u, 64u);
-    prepared.requiredQuadCapacity = std::max(
-        prepared.totalQuadCount + (1024u * MESHLET_QUAD_DATA_WORD_STRIDE),
-        prepared.requiredMeshletCapacity * MESHLET_QUAD_CAPACITY * MESHLET_QUAD_DATA_WORD_STRIDE
-    );
+    // Sized from the words actually packed, plus an eighth so small growth reuses the buffers;
+    // most meshlets sit far below MESHLET_MAX_DATA_WORDS.
+    prepared.requiredQuadCapacity = prepared.totalQuadCount + (prepared.totalQuadCount / 8u) +
+        (1024u * MESHLET_QUAD_DATA_WORD_STRIDE);
 
     return prepared;
 }
+
+StreamingMeshUpload makeStreamingMeshUpload(PreparedMeshUploadData&& prepared,
+                                            uint64_t meshRevision,
+                                            const ColumnCoord& centerColumn) {
+    return StreamingMeshUpload{
+        std::move(prepared.metadata),
+        std::move(prepared.quadData),
+        std::move(prepared.meshletBounds),
+        std::move(prepared.meshletGroups),
+        prepared.totalMeshletCount,
+        prepared.totalQuadCount,
+        prepared.requiredMeshletCapacity,
+        prepared.requiredQuadCapacity,
+        meshRevision,
+        centerColumn,
+        prepared.meshletOriginBase
+    };
+}
+
+ColumnCoord columnForPosition(const glm::vec3& position) {
+    const BlockCoord block{
+        static_cast<int32_t>(std::floor(position.x)),
+        static_cast<int32_t>(std::floor(position.y)),
+        static_cast<int32_t>(std::floor(position.z))
+    };
+    return chunk_to_column(block_to_chunk(block));
+}
+
+// Covers the mesh prefetch band and tile rounding past an observer's mesh radius.
+constexpr int32_t kObserverLoadMarginColumns = 32;
+// Extra observers share the streaming thread, so their snapshots are rate limited.
+constexpr double kObserverSnapshotIntervalSeconds = 0.25;
 }  // namespace
 
 VoxelStreamingSystem::VoxelStreamingSystem() = default;
@@ -148,8 +193,13 @@ bool VoxelStreamingSystem::initialize() {
         meshConfig.lodChunkRadii.push_back(clampedWorldRadius);
     }
 
+    // LOD selection is screen-space-error driven, so the mip rings come from the SSE
+    // thresholds rather than lodChunkRadii; columns past the mesh window stay coarse.
+    worldConfig.mipGenerationRadii = MeshManager::residentMipRadii(meshConfig);
+
     world_ = std::make_unique<World>(worldConfig);
     meshManager_ = std::make_unique<MeshManager>(*world_, meshConfig);
+    maxMeshRadiusChunks_ = meshConfig.lodChunkRadii.back();
     uploadColumnRadius_ = std::min(
         clampedWorldRadius,
         std::max(1, meshConfig.lodChunkRadii.back() + 1)
@@ -173,6 +223,7 @@ void VoxelStreamingSystem::start(const glm::vec3& initialCameraPosition, uint64_
         streamingStopRequested_ = false;
         hasLatestStreamingCamera_ = true;
         latestStreamingCamera_ = initialCameraPosition;
+        latestStreamingForward_ = glm::vec3{0.0f, 0.0f, 0.0f};
         latestStreamingSseProjectionScale_ = 390.0f;
         pendingMeshUpload_.reset();
         streamerLastPreparedRevision_ = initialUploadedMeshRevision;
@@ -181,6 +232,8 @@ void VoxelStreamingSystem::start(const glm::vec3& initialCameraPosition, uint64_
         streamerLastSnapshotTime_.reset();
         mainUploadInProgress_.store(false, std::memory_order_relaxed);
     }
+    streamerPrimaryView_ = ViewVelocityTracker{};
+    streamerObservers_.clear();
 
     streamingThread_ = std::thread([this] {
         streamingThreadMain();
@@ -204,6 +257,9 @@ void VoxelStreamingSystem::stop() {
         streamingStopRequested_ = false;
         pendingMeshUpload_.reset();
         streamerLastSnapshotTime_.reset();
+        for (auto& [id, observer] : observers_) {
+            observer.pendingMeshUpload.reset();
+        }
     }
     mainUploadInProgress_.store(false, std::memory_order_relaxed);
 }
@@ -212,11 +268,14 @@ void VoxelStreamingSystem::setMainUploadInProgress(bool inProgress) noexcept {
     mainUploadInProgress_.store(inProgress, std::memory_order_relaxed);
 }
 
-void VoxelStreamingSystem::updateCamera(const glm::vec3& cameraPosition, float sseProjectionScale) {
+void VoxelStreamingSystem::updateCamera(const glm::vec3& cameraPosition,
+                                        const glm::vec3& cameraForward,
+                                        float sseProjectionScale) {
     {
         std::lock_guard<std::mutex> lock(streamingMutex_);
         hasLatestStreamingCamera_ = true;
         latestStreamingCamera_ = cameraPosition;
+        latestStreamingForward_ = cameraForward;
         latestStreamingSseProjectionScale_ = sseProjectionScale;
     }
     streamingCv_.notify_one();
@@ -232,6 +291,76 @@ std::optional<StreamingMeshUpload> VoxelStreamingSystem::consumePendingMeshUploa
     return upload;
 }
 
+std::optional<StreamingObserverId> VoxelStreamingSystem::addObserver(const ObserverConfig& config) {
+    if (!world_ || !meshManager_) {
+        return std::nullopt;
+    }
+
+    StreamingObserver observer;
+    observer.config = config;
+    const int32_t meshRadius = (config.meshRadiusChunks > 0)
+        ? std::min(config.meshRadiusChunks, maxMeshRadiusChunks_)
+        : maxMeshRadiusChunks_;
+    const int32_t loadRadius = (config.columnLoadRadius > 0)
+        ? config.columnLoadRadius
+        : meshRadius + kObserverLoadMarginColumns;
+    observer.uploadColumnRadius = std::max(1, std::min(loadRadius, meshRadius + 1));
+
+    MeshManager::ObserverConfig meshObserverConfig;
+    meshObserverConfig.maxRadiusChunks = meshRadius;
+    meshObserverConfig.lodSseTargetPixels = config.lodSseTargetPixels;
+    observer.worldObserver = world_->registerObserver(loadRadius);
+    observer.meshObserver = meshManager_->registerObserver(meshObserverConfig);
+
+    std::lock_guard<std::mutex> lock(streamingMutex_);
+    const StreamingObserverId id = nextObserverId_++;
+    observers_.emplace(id, std::move(observer));
+    return id;
+}
+
+void VoxelStreamingSystem::removeObserver(StreamingObserverId id) {
+    StreamingObserver removed;
+    {
+        std::lock_guard<std::mutex> lock(streamingMutex_);
+        const auto it = observers_.find(id);
+        if (it == observers_.end()) {
+            return;
+        }
+        removed = std::move(it->second);
+        observers_.erase(it);
+    }
+
+    // A streaming-thread update racing this one is a no-op once the ids are gone.
+    meshManager_->removeObserver(removed.meshObserver);
+    world_->removeObserver(removed.worldObserver);
+}
+
+void VoxelStreamingSystem::updateObserver(StreamingObserverId id,
+                                          const glm::vec3& position,
+                                          const glm::vec3& forward,
+                                          float sseProjectionScale) {
+    std::lock_guard<std::mutex> lock(streamingMutex_);
+    const auto it = observers_.find(id);
+    if (it == observers_.end()) {
+        return;
+    }
+    it->second.hasPosition = true;
+    it->second.position = position;
+    it->second.forward = forward;
+    it->second.sseProjectionScale = sseProjectionScale;
+}
+
+std::optional<StreamingMeshUpload> VoxelStreamingSystem::consumeObserverMeshUpload(StreamingObserverId id) {
+    std::lock_guard<std::mutex> lock(streamingMutex_);
+    const auto it = observers_.find(id);
+    if (it == observers_.end() || !it->second.pendingMeshUpload.has_value()) {
+        return std::nullopt;
+    }
+    std::optional<StreamingMeshUpload> upload = std::move(it->second.pendingMeshUpload);
+    it->second.pendingMeshUpload.reset();
+    return upload;
+}
+
 void VoxelStreamingSystem::recordMainUpdateDurationNs(uint64_t ns) noexcept {
     recordTimingNs(TimingStage::MainUpdateWorldStreaming, ns);
 }
@@ -240,14 +369,165 @@ const World* VoxelStreamingSystem::world() const noexcept {
     return world_.get();
 }
 
+int32_t VoxelStreamingSystem::meshRadiusChunks() const noexcept {
+    return maxMeshRadiusChunks_;
+}
+
 int32_t VoxelStreamingSystem::cameraColumnChebyshevDistance(const ColumnCoord& a, const ColumnCoord& b) {
     const int32_t dx = std::abs(a.v.x - b.v.x);
     const int32_t dy = std::abs(a.v.y - b.v.y);
     return std::max(dx, dy);
 }
 
+StreamingView VoxelStreamingSystem::updateStreamingView(ViewVelocityTracker& tracker,
+                                                       const glm::vec3& cameraPosition,
+                                                       const glm::vec3& cameraForward) {
+    constexpr float kVelocitySmoothing = 0.3f;
+    constexpr float kMaxSampleGapSeconds = 0.5f;
+
+    const auto now = std::chrono::steady_clock::now();
+    if (tracker.lastTime.has_value()) {
+        const float dtSeconds = std::chrono::duration<float>(now - *tracker.lastTime).count();
+        if (dtSeconds > kMaxSampleGapSeconds) {
+            // A long stall or a teleport says nothing about where the camera is heading.
+            tracker.velocity = glm::vec3{0.0f, 0.0f, 0.0f};
+        } else if (dtSeconds > 1e-3f) {
+            const glm::vec3 sampleVelocity = (cameraPosition - tracker.lastPosition) / dtSeconds;
+            tracker.velocity += (sampleVelocity - tracker.velocity) * kVelocitySmoothing;
+        }
+    }
+    tracker.lastTime = now;
+    tracker.lastPosition = cameraPosition;
+
+    return StreamingView{cameraPosition, cameraForward, tracker.velocity};
+}
+
+void VoxelStreamingSystem::updateExtraObservers() {
+    struct ObserverInput {
+        StreamingObserverId id = kPrimaryStreamingObserver;
+        StreamingObserverId worldObserver = kPrimaryStreamingObserver;
+        StreamingObserverId meshObserver = kPrimaryStreamingObserver;
+        glm::vec3 position{0.0f, 0.0f, 0.0f};
+        glm::vec3 forward{0.0f, 0.0f, 0.0f};
+        float sseProjectionScale = 390.0f;
+    };
+
+    std::vector<ObserverInput> inputs;
+    {
+        std::lock_guard<std::mutex> lock(streamingMutex_);
+        inputs.reserve(observers_.size());
+        for (const auto& [id, observer] : observers_) {
+            if (observer.hasPosition) {
+                inputs.push_back(ObserverInput{
+                    id,
+                    observer.worldObserver,
+                    observer.meshObserver,
+                    observer.position,
+                    observer.forward,
+                    observer.sseProjectionScale
+                });
+            }
+        }
+    }
+
+    for (auto it = streamerObservers_.begin(); it != streamerObservers_.end();) {
+        const bool live = std::any_of(inputs.begin(), inputs.end(), [&it](const ObserverInput& input) {
+            return input.id == it->first;
+        });
+        it = live ? std::next(it) : streamerObservers_.erase(it);
+    }
+
+    // Scheduling only; the primary camera's mesh update integrates results for everyone.
+    for (const ObserverInput& input : inputs) {
+        StreamerObserverState& state = streamerObservers_[input.id];
+        const StreamingView view = updateStreamingView(state.view, input.position, input.forward);
+        world_->updateObserverView(input.worldObserver, view);
+        world_->updateObserver(input.worldObserver, input.position);
+        meshManager_->updateObserverView(input.meshObserver, view);
+        meshManager_->updateObserver(input.meshObserver, input.position, input.sseProjectionScale);
+    }
+}
+
+void VoxelStreamingSystem::prepareExtraObserverUploads() {
+    struct UploadRequest {
+        StreamingObserverId id = kPrimaryStreamingObserver;
+        ColumnCoord center{};
+        int32_t radius = 1;
+    };
+
+    const uint64_t currentRevision = meshManager_->meshRevision();
+    const auto now = std::chrono::steady_clock::now();
+    std::vector<UploadRequest> requests;
+    {
+        std::lock_guard<std::mutex> lock(streamingMutex_);
+        for (const auto& [id, observer] : observers_) {
+            if (!observer.config.wantsMeshUploads || !observer.hasPosition ||
+                observer.pendingMeshUpload.has_value()) {
+                continue;
+            }
+            const auto stateIt = streamerObservers_.find(id);
+            if (stateIt == streamerObservers_.end()) {
+                continue;
+            }
+
+            const StreamerObserverState& state = stateIt->second;
+            const ColumnCoord center = columnForPosition(observer.position);
+            if (state.hasLastPrepared && state.lastPreparedRevision == currentRevision &&
+                state.lastPreparedCenter == center) {
+                continue;
+            }
+            if (state.lastSnapshotTime.has_value() &&
+                std::chrono::duration<double>(now - *state.lastSnapshotTime).count() <
+                    kObserverSnapshotIntervalSeconds) {
+                continue;
+            }
+            requests.push_back(UploadRequest{id, center, observer.uploadColumnRadius});
+        }
+    }
+
+    for (const UploadRequest& request : requests) {
+        const auto copyStart = std::chrono::steady_clock::now();
+        std::vector<MeshletGroupRange> groups;
+        std::vector<Meshlet> meshlets = meshManager_->copyMeshletsAround(request.center, request.radius, &groups);
+        recordTimingNs(
+            TimingStage::StreamCopyMeshlets,
+            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - copyStart
+            ).count())
+        );
+
+        const auto prepareStart = std::chrono::steady_clock::now();
+        PreparedMeshUploadData prepared = prepareMeshUploadData(meshlets, groups, request.center);
+        recordTimingNs(
+            TimingStage::StreamPrepareUpload,
+            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - prepareStart
+            ).count())
+        );
+        streamMeshletsRejected_.fetch_add(prepared.rejectedMeshletCount, std::memory_order_relaxed);
+
+        {
+            std::lock_guard<std::mutex> lock(streamingMutex_);
+            const auto it = observers_.find(request.id);
+            if (it == observers_.end()) {
+                continue;
+            }
+            it->second.pendingMeshUpload =
+                makeStreamingMeshUpload(std::move(prepared), currentRevision, request.center);
+        }
+
+        StreamerObserverState& state = streamerObservers_[request.id];
+        state.lastPreparedRevision = currentRevision;
+        state.lastPreparedCenter = request.center;
+        state.hasLastPrepared = true;
+        state.lastSnapshotTime = now;
+        streamSnapshotsPrepared_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
 void VoxelStreamingSystem::streamingThreadMain() {
     glm::vec3 cameraPosition{0.0f, 0.0f, 0.0f};
+    glm::vec3 cameraForward{0.0f, 0.0f, 0.0f};
     float cameraSseProjectionScale = 390.0f;
     bool hasCameraPosition = false;
 
@@ -267,6 +547,7 @@ void VoxelStreamingSystem::streamingThreadMain() {
             }
             if (hasLatestStreamingCamera_) {
                 cameraPosition = latestStreamingCamera_;
+                cameraForward = latestStreamingForward_;
                 cameraSseProjectionScale = latestStreamingSseProjectionScale_;
                 hasLatestStreamingCamera_ = false;
                 hasCameraPosition = true;
@@ -278,7 +559,14 @@ void VoxelStreamingSystem::streamingThreadMain() {
             continue;
         }
 
+        const StreamingView view = updateStreamingView(streamerPrimaryView_, cameraPosition, cameraForward);
+
+        // Extra observers only schedule here; the primary update below integrates finished
+        // meshes for all of them, so it must run last.
+        updateExtraObservers();
+
         const auto worldUpdateStart = std::chrono::steady_clock::now();
+        world_->updateView(view);
         world_->updatePlayerPosition(cameraPosition);
         recordTimingNs(
             TimingStage::StreamWorldUpdate,
@@ -288,6 +576,7 @@ void VoxelStreamingSystem::streamingThreadMain() {
         );
 
         const auto meshUpdateStart = std::chrono::steady_clock::now();
+        meshManager_->updateView(view);
         meshManager_->updatePlayerPosition(cameraPosition, cameraSseProjectionScale);
         recordTimingNs(
             TimingStage::StreamMeshUpdate,
@@ -296,12 +585,9 @@ void VoxelStreamingSystem::streamingThreadMain() {
             ).count())
         );
 
-        const BlockCoord cameraBlock{
-            static_cast<int32_t>(std::floor(cameraPosition.x)),
-            static_cast<int32_t>(std::floor(cameraPosition.y)),
-            static_cast<int32_t>(std::floor(cameraPosition.z))
-        };
-        const ColumnCoord centerColumn = chunk_to_column(block_to_chunk(cameraBlock));
+        prepareExtraObserverUploads();
+
+        const ColumnCoord centerColumn = columnForPosition(cameraPosition);
         const bool centerChanged = !streamerHasLastPreparedCenter_ || !(centerColumn == streamerLastPreparedCenter_);
         const int32_t centerShift = streamerHasLastPreparedCenter_
             ? cameraColumnChebyshevDistance(centerColumn, streamerLastPreparedCenter_)
@@ -345,7 +631,8 @@ void VoxelStreamingSystem::streamingThreadMain() {
         }
 
         const auto copyStart = std::chrono::steady_clock::now();
-        std::vector<Meshlet> meshlets = meshManager_->copyMeshletsAround(centerColumn, uploadColumnRadius_);
+        std::vector<MeshletGroupRange> groups;
+        std::vector<Meshlet> meshlets = meshManager_->copyMeshletsAround(centerColumn, uploadColumnRadius_, &groups);
         recordTimingNs(
             TimingStage::StreamCopyMeshlets,
             static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
@@ -354,31 +641,21 @@ void VoxelStreamingSystem::streamingThreadMain() {
         );
 
         const auto prepareStart = std::chrono::steady_clock::now();
-        PreparedMeshUploadData prepared = prepareMeshUploadData(meshlets);
+        PreparedMeshUploadData prepared = prepareMeshUploadData(meshlets, groups, centerColumn);
         recordTimingNs(
             TimingStage::StreamPrepareUpload,
             static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
                 std::chrono::steady_clock::now() - prepareStart
             ).count())
         );
+        streamMeshletsRejected_.fetch_add(prepared.rejectedMeshletCount, std::memory_order_relaxed);
 
         {
             std::lock_guard<std::mutex> lock(streamingMutex_);
             if (streamingStopRequested_) {
                 return;
             }
-            pendingMeshUpload_ = StreamingMeshUpload{
-                std::move(prepared.metadata),
-                std::move(prepared.quadData),
-                std::move(prepared.meshletAabbsGpu),
-                std::move(prepared.meshletBounds),
-                prepared.totalMeshletCount,
-                prepared.totalQuadCount,
-                prepared.requiredMeshletCapacity,
-                prepared.requiredQuadCapacity,
-                currentRevision,
-                centerColumn
-            };
+            pendingMeshUpload_ = makeStreamingMeshUpload(std::move(prepared), currentRevision, centerColumn);
         }
 
         streamerLastPreparedRevision_ = currentRevision;
@@ -418,6 +695,7 @@ VoxelStreamingSystem::TimingRawTotals VoxelStreamingSystem::captureTimingRawTota
     totals.streamSkipUnchanged = streamSkipUnchanged_.load(std::memory_order_relaxed);
     totals.streamSkipThrottle = streamSkipThrottle_.load(std::memory_order_relaxed);
     totals.streamSnapshotsPrepared = streamSnapshotsPrepared_.load(std::memory_order_relaxed);
+    totals.streamMeshletsRejected = streamMeshletsRejected_.load(std::memory_order_relaxed);
     return totals;
 }
 
@@ -498,6 +776,8 @@ RuntimeTimingSnapshot VoxelStreamingSystem::getRuntimeTimingSnapshot() {
                 currentTotals.streamSkipThrottle - lastTimingRawTotals_.streamSkipThrottle;
             snapshot.streamSnapshotsPrepared =
                 currentTotals.streamSnapshotsPrepared - lastTimingRawTotals_.streamSnapshotsPrepared;
+            snapshot.streamMeshletsRejected =
+                currentTotals.streamMeshletsRejected - lastTimingRawTotals_.streamMeshletsRejected;
 
             lastTimingSampleTime_ = now;
             lastTimingRawTotals_ = currentTotals;
@@ -20,14 +20,121 @@ BlockMaterial airBlock() {
     return kAir;
 }
 
-int32_t distanceSqToCenter(const ColumnCoord& coord, const ColumnCoord& center) {
+int64_t distanceSqToCenter(const ColumnCoord& coord, const ColumnCoord& center) {
     const int64_t dx = static_cast<int64_t>(coord.v.x) - static_cast<int64_t>(center.v.x);
     const int64_t dy = static_cast<int64_t>(coord.v.y) - static_cast<int64_t>(center.v.y);
-    const int64_t distanceSq = (dx * dx) + (dy * dy);
-    if (distanceSq > static_cast<int64_t>(std::numeric_limits<int32_t>::max())) {
-        return std::numeric_limits<int32_t>::max();
+    return (dx * dx) + (dy * dy);
+}
+
+// Half-width of row dy of a disc of the given radius, or -1 when the row misses it.
+int32_t discRowHalfWidth(int32_t radius, int32_t dy) {
+    if (radius < 0 || std::abs(dy) > radius) {
+        return -1;
+    }
+    const int64_t remaining = static_cast<int64_t>(radius) * radius - static_cast<int64_t>(dy) * dy;
+    int64_t halfWidth = static_cast<int64_t>(std::sqrt(static_cast<double>(remaining)));
+    while ((halfWidth + 1) * (halfWidth + 1) <= remaining) {
+        ++halfWidth;
+    }
+    while (halfWidth * halfWidth > remaining) {
+        --halfWidth;
+    }
+    return static_cast<int32_t>(halfWidth);
+}
+
+void appendColumnsInDisc(const ColumnCoord& center, int32_t radius, std::vector<ColumnCoord>& outColumns) {
+    for (int32_t dy = -radius; dy <= radius; ++dy) {
+        const int32_t halfWidth = discRowHalfWidth(radius, dy);
+        for (int32_t dx = -halfWidth; dx <= halfWidth; ++dx) {
+            outColumns.push_back(ColumnCoord{center.v.x + dx, center.v.y + dy});
+        }
+    }
+}
+
+// Columns inside the new disc but outside the previous one, walked as row spans.
+void appendColumnsEnteringWindow(const ColumnCoord& previousCenter,
+                                 const ColumnCoord& newCenter,
+                                 int32_t radius,
+                                 std::vector<ColumnCoord>& outColumns) {
+    for (int32_t y = newCenter.v.y - radius; y <= newCenter.v.y + radius; ++y) {
+        const int32_t halfWidth = discRowHalfWidth(radius, y - newCenter.v.y);
+        const int32_t previousHalfWidth = discRowHalfWidth(radius, y - previousCenter.v.y);
+        const int32_t previousMinX = previousCenter.v.x - previousHalfWidth;
+        const int32_t previousMaxX = previousCenter.v.x + previousHalfWidth;
+
+        for (int32_t x = newCenter.v.x - halfWidth; x <= newCenter.v.x + halfWidth; ++x) {
+            if (previousHalfWidth >= 0 && x >= previousMinX && x <= previousMaxX) {
+                x = previousMaxX;
+                continue;
+            }
+            outColumns.push_back(ColumnCoord{x, y});
+        }
     }
-    return static_cast<int32_t>(distanceSq);
+}
+
+constexpr int32_t kWorldHeightBlocks = static_cast<int32_t>(Column::HEIGHT) * cfg::CHUNK_SIZE;
+
+// Descends the chunk's occupancy hierarchy from `cell` at `level`, appending solid blocks
+// inside [localMin, localMax]. Returns true once outHits holds maxHits entries.
+bool appendSolidBlocksInBox(const Chunk& chunk,
+                            const glm::ivec3& chunkOrigin,
+                            const glm::ivec3& localMin,
+                            const glm::ivec3& localMax,
+                            uint8_t level,
+                            const glm::ivec3& cell,
+                            std::vector<BlockQueryHit>& outHits,
+                            std::size_t maxHits) {
+    if (!chunk.isOccupied(
+            static_cast<uint8_t>(cell.x),
+            static_cast<uint8_t>(cell.y),
+            static_cast<uint8_t>(cell.z),
+            level)) {
+        return false;
+    }
+
+    if (level <= chunk.minResidentMip()) {
+        const BlockMaterial block = chunk.getBlock(
+            static_cast<uint8_t>(cell.x),
+            static_cast<uint8_t>(cell.y),
+            static_cast<uint8_t>(cell.z),
+            level
+        );
+        const int32_t size = 1 << level;
+        const glm::ivec3 blockMin = glm::max(cell * size, localMin);
+        const glm::ivec3 blockMax = glm::min(cell * size + (size - 1), localMax);
+        for (int32_t z = blockMin.z; z <= blockMax.z; ++z) {
+            for (int32_t y = blockMin.y; y <= blockMax.y; ++y) {
+                for (int32_t x = blockMin.x; x <= blockMax.x; ++x) {
+                    outHits.push_back(BlockQueryHit{BlockCoord{chunkOrigin + glm::ivec3{x, y, z}}, block});
+                    if (outHits.size() >= maxHits) {
+                        return true;
+                    }
+                }
+            }
+        }
+        return false;
+    }
+
+    const uint8_t childLevel = static_cast<uint8_t>(level - 1);
+    const int32_t childSize = 1 << childLevel;
+    for (int32_t dz = 0; dz < 2; ++dz) {
+        for (int32_t dy = 0; dy < 2; ++dy) {
+            for (int32_t dx = 0; dx < 2; ++dx) {
+                const glm::ivec3 childCell = cell * 2 + glm::ivec3{dx, dy, dz};
+                const glm::ivec3 childMin = childCell * childSize;
+                const glm::ivec3 childMax = childMin + (childSize - 1);
+                if (glm::any(glm::greaterThan(childMin, localMax)) ||
+                    glm::any(glm::lessThan(childMax, localMin))) {
+                    continue;
+                }
+                if (appendSolidBlocksInBox(
+                        chunk, chunkOrigin, localMin, localMax, childLevel, childCell, outHits, maxHits)) {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
 }
 }  // namespace
 
@@ -94,7 +201,9 @@ void WorldSection::copySamples(std::vector<Sample>& outSamples) const {
                     origin_.v.y + y,
                     origin_.v.z + z
                 };
-                sample.known = world_.tryGetBlockLocked(coord, sample.block, mipLevel_);
+                const BlockLookupResult lookup = world_.tryGetBlockLocked(coord, sample.block, mipLevel_);
+                sample.known = lookup != BlockLookupResult::Unknown;
+                sample.resident = lookup == BlockLookupResult::Resident;
                 outSamples[index] = sample;
             }
         }
@@ -106,7 +215,8 @@ World::World()
 
 World::World(Config config)
     : config_(std::move(config)),
-      jobs_(config_.jobConfig) {
+      jobs_(config_.jobConfig),
+      columnEvents_(config_.columnEventCapacity) {
     const std::size_t configuredMaxInFlight = config_.maxInFlightColumnJobs;
     const std::size_t workerCount = std::max<std::size_t>(std::size_t{1}, jobs_.worker_count());
     const std::size_t autoMaxInFlight = workerCount * 2;
@@ -114,6 +224,20 @@ World::World(Config config)
         std::size_t{1},
         (configuredMaxInFlight > 0) ? configuredMaxInFlight : autoMaxInFlight
     );
+
+    std::vector<int32_t>& mipRadii = config_.mipGenerationRadii;
+    for (int32_t& radius : mipRadii) {
+        radius = std::max(0, radius);
+    }
+    std::sort(mipRadii.begin(), mipRadii.end());
+    if (mipRadii.size() > Chunk::MAX_MIP_LEVEL) {
+        mipRadii.resize(Chunk::MAX_MIP_LEVEL);
+    }
+
+    Observer primary;
+    primary.columnLoadRadius = std::max(0, config_.columnLoadRadius);
+    primary.policy = StreamingPolicy(config_.streamingPolicy);
+    observers_.emplace(kPrimaryStreamingObserver, std::move(primary));
 }
 
 World::~World() {
@@ -137,6 +261,10 @@ bool World::tryGetBlock(const BlockCoord& coord, BlockMaterial& outBlock) const
 }
 
 bool World::tryGetBlock(const BlockCoord& coord, BlockMaterial& outBlock, uint8_t mipLevel) const {
+    return lookupBlock(coord, outBlock, mipLevel) != BlockLookupResult::Unknown;
+}
+
+BlockLookupResult World::lookupBlock(const BlockCoord& coord, BlockMaterial& outBlock, uint8_t mipLevel) const {
     std::shared_lock<std::shared_mutex> lock(worldMutex_);
     return tryGetBlockLocked(coord, outBlock, mipLevel);
 }
@@ -146,6 +274,18 @@ bool World::isColumnGenerated(const ColumnCoord& coord) const {
     return isColumnGeneratedLocked(coord);
 }
 
+bool World::isColumnRangeGenerated(const ColumnCoord& minCorner, const ColumnCoord& maxCorner) const {
+    std::shared_lock<std::shared_mutex> lock(worldMutex_);
+    for (int32_t y = minCorner.v.y; y <= maxCorner.v.y; ++y) {
+        for (int32_t x = minCorner.v.x; x <= maxCorner.v.x; ++x) {
+            if (!isColumnGeneratedLocked(ColumnCoord{x, y})) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 bool World::tryGetColumnEmptyChunkMask(const ColumnCoord& coord, uint32_t& outMask) const {
     std::shared_lock<std::shared_mutex> lock(worldMutex_);
     if (!isColumnGeneratedLocked(coord)) {
@@ -169,27 +309,51 @@ bool World::tryGetColumnEmptyChunkMask(const ColumnCoord& coord, uint32_t& outMa
     return true;
 }
 
-uint64_t World::generationRevision() const {
-    return generationRevision_.load(std::memory_order_acquire);
+bool World::tryGetColumnChunkMasks(const ColumnCoord& coord, uint32_t& outEmptyMask, uint32_t& outFullMask) const {
+    std::shared_lock<std::shared_mutex> lock(worldMutex_);
+    const Column* column = findGeneratedColumnLocked(coord);
+    if (column == nullptr) {
+        outEmptyMask = 0u;
+        outFullMask = 0u;
+        return false;
+    }
+
+    outEmptyMask = column->getEmptyChunkMask();
+    outFullMask = column->getFullChunkMask();
+    return true;
 }
 
-uint64_t World::copyGeneratedColumnsSince(uint64_t afterRevision,
-                                          std::vector<ColumnCoord>& outColumns,
-                                          std::size_t maxCount) const {
+bool World::tryGetColumnSurface(const ColumnCoord& coord, ColumnSurfaceInfo& outSurface) const {
     std::shared_lock<std::shared_mutex> lock(worldMutex_);
-    const uint64_t currentRevision = static_cast<uint64_t>(generatedColumnHistory_.size());
-    const uint64_t clampedRevision = std::min(afterRevision, currentRevision);
-    const size_t startIndex = static_cast<size_t>(clampedRevision);
-    const size_t available = generatedColumnHistory_.size() - startIndex;
-    const size_t count = std::min(maxCount, available);
+    const Column* column = findGeneratedColumnLocked(coord);
+    if (column == nullptr) {
+        return false;
+    }
 
-    outColumns.clear();
-    outColumns.reserve(count);
-    for (size_t i = 0; i < count; ++i) {
-        outColumns.push_back(generatedColumnHistory_[startIndex + i]);
+    outSurface.topSolidZ = column->surfaceHeights();
+    outSurface.emptyChunkMask = column->getEmptyChunkMask();
+    outSurface.fullChunkMask = column->getFullChunkMask();
+    outSurface.minSolidZ = column->minSolidZ();
+    outSurface.maxSolidZ = column->maxSolidZ();
+    return true;
+}
+
+bool World::tryGetSurfaceHeight(int32_t worldX, int32_t worldY, int32_t& outZ) const {
+    const BlockCoord block{worldX, worldY, 0};
+    const glm::ivec3 local = block_local_in_chunk(block);
+
+    std::shared_lock<std::shared_mutex> lock(worldMutex_);
+    const Column* column = findGeneratedColumnLocked(chunk_to_column(block_to_chunk(block)));
+    if (column == nullptr) {
+        outZ = Column::kNoSolidZ;
+        return false;
     }
+    outZ = column->surfaceHeight(static_cast<uint8_t>(local.x), static_cast<uint8_t>(local.y));
+    return true;
+}
 
-    return clampedRevision + static_cast<uint64_t>(count);
+uint64_t World::generationRevision() const {
+    return generationRevision_.load(std::memory_order_acquire);
 }
 
 void World::copyGeneratedColumns(std::vector<ColumnCoord>& outColumns) const {
@@ -202,16 +366,16 @@ void World::copyGeneratedColumns(std::vector<ColumnCoord>& outColumns) const {
     std::sort(outColumns.begin(), outColumns.end());
 }
 
-bool World::tryGetBlockLocked(const BlockCoord& coord,
-                              BlockMaterial& outBlock,
-                              uint8_t mipLevel) const {
+BlockLookupResult World::tryGetBlockLocked(const BlockCoord& coord,
+                                           BlockMaterial& outBlock,
+                                           uint8_t mipLevel) const {
     const uint8_t clampedMip = std::min<uint8_t>(mipLevel, Chunk::MAX_MIP_LEVEL);
     const int32_t chunkSizeAtMip = static_cast<int32_t>(Chunk::mipSize(clampedMip));
     const int32_t worldHeightAtMip = cfg::COLUMN_HEIGHT_BLOCKS >> clampedMip;
 
     if (coord.v.z < 0 || coord.v.z >= worldHeightAtMip) {
         outBlock = airBlock();
-        return false;
+        return BlockLookupResult::Unknown;
     }
 
     const ChunkCoord chunkCoord{
@@ -221,7 +385,7 @@ bool World::tryGetBlockLocked(const BlockCoord& coord,
     };
     if (chunkCoord.v.z < 0 || chunkCoord.v.z >= cfg::COLUMN_HEIGHT) {
         outBlock = airBlock();
-        return false;
+        return BlockLookupResult::Unknown;
     }
 
     const ColumnCoord columnCoord = chunk_to_column(chunkCoord);
@@ -231,13 +395,13 @@ bool World::tryGetBlockLocked(const BlockCoord& coord,
     // Treat those columns as unknown so meshing can apply boundary policy.
     if (generatedColumns_.find(columnCoord) == generatedColumns_.end()) {
         outBlock = airBlock();
-        return false;
+        return BlockLookupResult::Unknown;
     }
 
     const auto regionIt = regions_.find(regionCoord);
     if (regionIt == regions_.end() || regionIt->second == nullptr) {
         outBlock = airBlock();
-        return false;
+        return BlockLookupResult::Unknown;
     }
 
     const glm::ivec2 localColumn = column_local_in_region(columnCoord);
@@ -251,13 +415,323 @@ bool World::tryGetBlockLocked(const BlockCoord& coord,
         static_cast<uint8_t>(localColumn.y)
     );
 
-    outBlock = column.getChunk(static_cast<uint8_t>(chunkCoord.v.z)).getBlock(
+    const Chunk& chunk = column.getChunk(static_cast<uint8_t>(chunkCoord.v.z));
+    outBlock = chunk.getBlock(
         static_cast<uint8_t>(localBlock.x),
         static_cast<uint8_t>(localBlock.y),
         static_cast<uint8_t>(localBlock.z),
         clampedMip
     );
-    return true;
+    return chunk.isMipResident(clampedMip) ? BlockLookupResult::Resident : BlockLookupResult::NotResident;
+}
+
+std::size_t World::applyEdits(std::span<const BlockEdit> edits) {
+    if (edits.empty() || shuttingDown_.load(std::memory_order_acquire)) {
+        return 0;
+    }
+
+    struct KeyedEdit {
+        ChunkCoord chunk{};
+        LocalBlockEdit local{};
+    };
+
+    // Sorting groups each chunk's edits together so its mips are rebuilt once per batch.
+    std::vector<KeyedEdit> keyed;
+    keyed.reserve(edits.size());
+    for (const BlockEdit& edit : edits) {
+        const glm::ivec3 local = block_local_in_chunk(edit.coord);
+        keyed.push_back(KeyedEdit{
+            block_to_chunk(edit.coord),
+            LocalBlockEdit{
+                static_cast<uint8_t>(local.x),
+                static_cast<uint8_t>(local.y),
+                static_cast<uint8_t>(local.z),
+                edit.block
+            }
+        });
+    }
+    std::stable_sort(keyed.begin(), keyed.end(), [](const KeyedEdit& a, const KeyedEdit& b) {
+        if (a.chunk.v.x != b.chunk.v.x) {
+            return a.chunk.v.x < b.chunk.v.x;
+        }
+        if (a.chunk.v.y != b.chunk.v.y) {
+            return a.chunk.v.y < b.chunk.v.y;
+        }
+        return a.chunk.v.z < b.chunk.v.z;
+    });
+
+    std::size_t totalChanged = 0;
+    std::vector<LocalBlockEdit> chunkEdits;
+    std::unique_lock<std::shared_mutex> lock(worldMutex_);
+
+    ColumnCoord pendingColumn{};
+    uint8_t pendingBorderMask = 0;
+    uint32_t pendingChunkZMask = 0;
+    bool pendingChanged = false;
+    bool hasPendingColumn = false;
+    auto flushColumn = [&]() {
+        if (hasPendingColumn && pendingChanged) {
+            editedColumns_.insert(pendingColumn);
+            columnEvents_.publish(ColumnEvent{
+                pendingColumn,
+                ColumnEventType::Edited,
+                pendingBorderMask,
+                pendingChunkZMask
+            });
+            generationRevision_.fetch_add(1, std::memory_order_release);
+        }
+        hasPendingColumn = false;
+        pendingChanged = false;
+        pendingBorderMask = 0;
+        pendingChunkZMask = 0;
+    };
+
+    constexpr uint8_t kLastLocal = static_cast<uint8_t>(cfg::CHUNK_SIZE - 1);
+    for (size_t begin = 0; begin < keyed.size();) {
+        const ChunkCoord chunk = keyed[begin].chunk;
+        size_t end = begin + 1;
+        while (end < keyed.size() && keyed[end].chunk == chunk) {
+            ++end;
+        }
+
+        const ColumnCoord columnCoord = chunk_to_column(chunk);
+        if (!hasPendingColumn || !(columnCoord == pendingColumn)) {
+            flushColumn();
+            pendingColumn = columnCoord;
+            hasPendingColumn = true;
+        }
+
+        Column* column = nullptr;
+        if (chunk.v.z >= 0 && chunk.v.z < static_cast<int32_t>(Column::HEIGHT) &&
+            isColumnGeneratedLocked(columnCoord) &&
+            partialColumnMips_.find(columnCoord) == partialColumnMips_.end()) {
+            column = findColumnLocked(columnCoord);
+        }
+        if (column == nullptr) {
+            begin = end;
+            continue;
+        }
+
+        chunkEdits.clear();
+        uint8_t borderMask = 0;
+        for (size_t i = begin; i < end; ++i) {
+            const LocalBlockEdit& local = keyed[i].local;
+            chunkEdits.push_back(local);
+            borderMask |= (local.x == 0) ? kColumnBorderMinusX : uint8_t{0};
+            borderMask |= (local.x == kLastLocal) ? kColumnBorderPlusX : uint8_t{0};
+            borderMask |= (local.y == 0) ? kColumnBorderMinusY : uint8_t{0};
+            borderMask |= (local.y == kLastLocal) ? kColumnBorderPlusY : uint8_t{0};
+        }
+
+        const std::size_t changed = column->applyChunkEdits(
+            static_cast<uint8_t>(chunk.v.z),
+            chunkEdits.data(),
+            chunkEdits.size()
+        );
+        if (changed > 0) {
+            totalChanged += changed;
+            pendingChanged = true;
+            pendingBorderMask |= borderMask;
+            pendingChunkZMask |= uint32_t{1} << chunk.v.z;
+        }
+        begin = end;
+    }
+    flushColumn();
+
+    return totalChanged;
+}
+
+RaycastHit World::raycast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance) const {
+    std::shared_lock<std::shared_mutex> lock(worldMutex_);
+    return raycastLocked(RaycastQuery{origin, direction, maxDistance});
+}
+
+void World::raycast(std::span<const RaycastQuery> queries, std::span<RaycastHit> outHits) const {
+    const std::size_t count = std::min(queries.size(), outHits.size());
+    std::shared_lock<std::shared_mutex> lock(worldMutex_);
+    for (std::size_t i = 0; i < count; ++i) {
+        outHits[i] = raycastLocked(queries[i]);
+    }
+}
+
+RaycastHit World::raycastLocked(const RaycastQuery& query) const {
+    RaycastHit result;
+    const float directionLength = glm::length(query.direction);
+    if (!std::isfinite(directionLength) || directionLength <= 1e-6f ||
+        !std::isfinite(query.maxDistance) || query.maxDistance < 0.0f ||
+        !std::isfinite(query.origin.x) || !std::isfinite(query.origin.y) || !std::isfinite(query.origin.z)) {
+        return result;
+    }
+
+    const glm::vec3 direction = query.direction / directionLength;
+    glm::ivec3 step{0, 0, 0};
+    glm::vec3 inverseDirection{0.0f, 0.0f, 0.0f};
+    for (int axis = 0; axis < 3; ++axis) {
+        if (direction[axis] > 0.0f) {
+            step[axis] = 1;
+        } else if (direction[axis] < 0.0f) {
+            step[axis] = -1;
+        }
+        inverseDirection[axis] = (step[axis] != 0) ? 1.0f / direction[axis] : 0.0f;
+    }
+
+    glm::ivec3 cell = glm::ivec3(glm::floor(query.origin));
+    glm::ivec3 normal{0, 0, 0};
+    float t = 0.0f;
+
+    // Consecutive steps mostly stay in one column; skip the two hash lookups for those.
+    ColumnCoord cachedCoord{};
+    const Column* cachedColumn = nullptr;
+    bool hasCachedColumn = false;
+
+    while (t <= query.maxDistance) {
+        if ((cell.z < 0 && step.z <= 0) || (cell.z >= kWorldHeightBlocks && step.z >= 0)) {
+            break;
+        }
+
+        const ChunkCoord chunkCoord = block_to_chunk(BlockCoord{cell});
+        const ColumnCoord columnCoord = chunk_to_column(chunkCoord);
+        if (!hasCachedColumn || !(columnCoord == cachedCoord)) {
+            cachedCoord = columnCoord;
+            cachedColumn = findGeneratedColumnLocked(columnCoord);
+            hasCachedColumn = true;
+        }
+
+        // Log2 of the aligned empty cell to skip; starts at a whole chunk.
+        int32_t skipLevel = Chunk::MAX_MIP_LEVEL;
+        if (cachedColumn != nullptr && cell.z >= 0 && cell.z < kWorldHeightBlocks &&
+            (cachedColumn->getEmptyChunkMask() & (1u << chunkCoord.v.z)) == 0u) {
+            const Chunk& chunk = cachedColumn->getChunk(static_cast<uint8_t>(chunkCoord.v.z));
+            const glm::ivec3 local = block_local_in_chunk(BlockCoord{cell});
+            const uint8_t baseMip = chunk.minResidentMip();
+
+            skipLevel = -1;
+            for (int32_t level = Chunk::MAX_MIP_LEVEL; level >= static_cast<int32_t>(baseMip); --level) {
+                if (!chunk.isOccupied(
+                        static_cast<uint8_t>(local.x >> level),
+                        static_cast<uint8_t>(local.y >> level),
+                        static_cast<uint8_t>(local.z >> level),
+                        static_cast<uint8_t>(level))) {
+                    skipLevel = level;
+                    break;
+                }
+            }
+
+            if (skipLevel < 0) {
+                result.hit = true;
+                result.block = BlockCoord{cell};
+                result.normal = normal;
+                result.distance = t;
+                result.mipLevel = baseMip;
+                result.material = chunk.getBlock(
+                    static_cast<uint8_t>(local.x >> baseMip),
+                    static_cast<uint8_t>(local.y >> baseMip),
+                    static_cast<uint8_t>(local.z >> baseMip),
+                    baseMip
+                );
+                return result;
+            }
+        }
+
+        // Leave the aligned empty cell through whichever face the ray reaches first.
+        const int32_t cellSize = 1 << skipLevel;
+        glm::ivec3 cellMin;
+        for (int axis = 0; axis < 3; ++axis) {
+            cellMin[axis] = floor_div(cell[axis], cellSize) * cellSize;
+        }
+
+        int exitAxis = -1;
+        float exitT = std::numeric_limits<float>::infinity();
+        for (int axis = 0; axis < 3; ++axis) {
+            if (step[axis] == 0) {
+                continue;
+            }
+            const int32_t boundary = (step[axis] > 0) ? cellMin[axis] + cellSize : cellMin[axis];
+            const float axisT = (static_cast<float>(boundary) - query.origin[axis]) * inverseDirection[axis];
+            if (axisT < exitT) {
+                exitT = axisT;
+                exitAxis = axis;
+            }
+        }
+        if (exitAxis < 0 || exitT > query.maxDistance) {
+            break;
+        }
+
+        t = std::max(t, exitT);
+        const glm::vec3 position = query.origin + direction * t;
+        for (int axis = 0; axis < 3; ++axis) {
+            if (axis == exitAxis) {
+                cell[axis] = (step[axis] > 0) ? cellMin[axis] + cellSize : cellMin[axis] - 1;
+                continue;
+            }
+            // Still inside the cell's slab on the other axes; clamp away float drift.
+            cell[axis] = std::clamp(
+                static_cast<int32_t>(std::floor(position[axis])),
+                cellMin[axis],
+                cellMin[axis] + cellSize - 1
+            );
+        }
+        normal = glm::ivec3{0, 0, 0};
+        normal[exitAxis] = -step[exitAxis];
+    }
+
+    return result;
+}
+
+std::size_t World::queryBox(const BlockCoord& minCorner,
+                            const BlockCoord& maxCorner,
+                            std::vector<BlockQueryHit>& outHits,
+                            std::size_t maxHits) const {
+    if (maxHits == 0) {
+        return 0;
+    }
+
+    glm::ivec3 boxMin = glm::min(minCorner.v, maxCorner.v);
+    glm::ivec3 boxMax = glm::max(minCorner.v, maxCorner.v);
+    boxMin.z = std::max(boxMin.z, 0);
+    boxMax.z = std::min(boxMax.z, kWorldHeightBlocks - 1);
+    if (boxMin.z > boxMax.z) {
+        return 0;
+    }
+
+    const std::size_t startSize = outHits.size();
+    const std::size_t hitLimit = (maxHits > std::numeric_limits<std::size_t>::max() - startSize)
+        ? std::numeric_limits<std::size_t>::max()
+        : startSize + maxHits;
+    const ChunkCoord minChunk = block_to_chunk(BlockCoord{boxMin});
+    const ChunkCoord maxChunk = block_to_chunk(BlockCoord{boxMax});
+
+    std::shared_lock<std::shared_mutex> lock(worldMutex_);
+    for (int32_t cy = minChunk.v.y; cy <= maxChunk.v.y; ++cy) {
+        for (int32_t cx = minChunk.v.x; cx <= maxChunk.v.x; ++cx) {
+            const Column* column = findGeneratedColumnLocked(ColumnCoord{cx, cy});
+            if (column == nullptr) {
+                continue;
+            }
+            const uint32_t emptyMask = column->getEmptyChunkMask();
+            for (int32_t cz = minChunk.v.z; cz <= maxChunk.v.z; ++cz) {
+                if ((emptyMask & (1u << cz)) != 0u) {
+                    continue;
+                }
+
+                const glm::ivec3 chunkOrigin = glm::ivec3{cx, cy, cz} * cfg::CHUNK_SIZE;
+                const glm::ivec3 localMin = glm::max(boxMin - chunkOrigin, glm::ivec3{0});
+                const glm::ivec3 localMax = glm::min(boxMax - chunkOrigin, glm::ivec3{cfg::CHUNK_SIZE - 1});
+                if (appendSolidBlocksInBox(
+                        column->getChunk(static_cast<uint8_t>(cz)),
+                        chunkOrigin,
+                        localMin,
+                        localMax,
+                        Chunk::MAX_MIP_LEVEL,
+                        glm::ivec3{0, 0, 0},
+                        outHits,
+                        hitLimit)) {
+                    return outHits.size() - startSize;
+                }
+            }
+        }
+    }
+    return outHits.size() - startSize;
 }
 
 WorldSection World::createSection(const BlockCoord& origin, const glm::ivec3& extent) const {
@@ -271,110 +745,223 @@ WorldSection World::createSection(const BlockCoord& origin,
 }
 
 void World::updatePlayerPosition(const glm::vec3& playerWorldPosition) {
+    updateObserver(kPrimaryStreamingObserver, playerWorldPosition);
+}
+
+void World::updateView(const StreamingView& view) {
+    updateObserverView(kPrimaryStreamingObserver, view);
+}
+
+StreamingObserverId World::registerObserver(int32_t columnLoadRadius) {
+    std::unique_lock<std::shared_mutex> lock(worldMutex_);
+    const StreamingObserverId id = nextObserverId_++;
+    Observer observer;
+    observer.columnLoadRadius = std::max(0, columnLoadRadius);
+    observer.policy = StreamingPolicy(config_.streamingPolicy);
+    observers_.emplace(id, std::move(observer));
+    return id;
+}
+
+void World::removeObserver(StreamingObserverId id) {
+    if (id == kPrimaryStreamingObserver) {
+        return;
+    }
+
+    std::vector<ScheduledColumnJob> jobsToSchedule;
+    {
+        std::unique_lock<std::shared_mutex> lock(worldMutex_);
+        const auto it = observers_.find(id);
+        if (it == observers_.end()) {
+            return;
+        }
+        const Observer removed = std::move(it->second);
+        observers_.erase(it);
+        if (!removed.hasCenter) {
+            return;
+        }
+
+        // Fine mips it alone was holding go back to whatever the remaining observers need.
+        if (!config_.mipGenerationRadii.empty()) {
+            const int32_t hysteresis = std::max(0, config_.mipReleaseHysteresis);
+            const int32_t releaseRadius = std::min(removed.columnLoadRadius + hysteresis,
+                                                   config_.mipGenerationRadii.back() + hysteresis);
+            std::vector<ColumnCoord> columns;
+            appendColumnsInDisc(removed.center, releaseRadius, columns);
+            releaseFineMipsInColumnsLocked(columns);
+        }
+
+        ++queueCenterVersion_;
+        pruneQueuedColumnsOutsideActiveWindowLocked();
+        rescoreQueuedColumnsLocked();
+        collectColumnJobsToScheduleLocked(jobsToSchedule);
+    }
+    dispatchScheduledColumnJobs(std::move(jobsToSchedule));
+}
+
+void World::updateObserver(StreamingObserverId id, const glm::vec3& worldPosition) {
     if (shuttingDown_.load(std::memory_order_acquire)) {
         return;
     }
 
-    const BlockCoord playerBlock{
-        static_cast<int32_t>(std::floor(playerWorldPosition.x)),
-        static_cast<int32_t>(std::floor(playerWorldPosition.y)),
-        static_cast<int32_t>(std::floor(playerWorldPosition.z))
+    const BlockCoord observerBlock{
+        static_cast<int32_t>(std::floor(worldPosition.x)),
+        static_cast<int32_t>(std::floor(worldPosition.y)),
+        static_cast<int32_t>(std::floor(worldPosition.z))
     };
-    const ColumnCoord centerColumn = chunk_to_column(block_to_chunk(playerBlock));
+    const ColumnCoord centerColumn = chunk_to_column(block_to_chunk(observerBlock));
 
     ColumnCoord previousCenter{};
     bool hadPreviousCenter = false;
+    int32_t radius = 0;
 
     // Fast path for unchanged center without taking the write lock. Worker mesh jobs
     // hold shared locks frequently; avoiding a per-frame writer lock reduces stalls.
     {
         std::shared_lock<std::shared_mutex> lock(worldMutex_);
-        if (hasLastScheduledCenter_ && centerColumn == lastScheduledCenter_) {
+        const auto it = observers_.find(id);
+        if (it == observers_.end() || (it->second.hasCenter && centerColumn == it->second.center)) {
             return;
         }
     }
 
     {
         std::unique_lock<std::shared_mutex> lock(worldMutex_);
-        if (hasLastScheduledCenter_ && centerColumn == lastScheduledCenter_) {
+        const auto it = observers_.find(id);
+        if (it == observers_.end() || (it->second.hasCenter && centerColumn == it->second.center)) {
             return;
         }
 
-        hadPreviousCenter = hasLastScheduledCenter_;
-        previousCenter = lastScheduledCenter_;
-        lastScheduledCenter_ = centerColumn;
-        hasLastScheduledCenter_ = true;
+        Observer& observer = it->second;
+        hadPreviousCenter = observer.hasCenter;
+        previousCenter = observer.center;
+        radius = observer.columnLoadRadius;
+        observer.center = centerColumn;
+        observer.hasCenter = true;
         ++queueCenterVersion_;
+        if (observer.policy.hasView()) {
+            // Direction and velocity only change through updateObserverView; keep the position current.
+            StreamingView view = observer.policy.view();
+            view.position = worldPosition;
+            observer.policy.setView(view);
+        }
     }
 
     if (!hadPreviousCenter) {
-        scheduleColumnsAround(centerColumn);
+        scheduleColumnsAround(centerColumn, radius);
         return;
     }
 
-    scheduleColumnsDelta(previousCenter, centerColumn);
+    scheduleColumnsDelta(previousCenter, centerColumn, radius);
+    releaseColumnsLeavingMipRings(previousCenter, centerColumn);
 }
 
-void World::scheduleColumnsAround(const ColumnCoord& centerColumn) {
-    const int32_t radius = std::max(0, config_.columnLoadRadius);
-    const int32_t diameter = (radius * 2) + 1;
-    std::vector<ColumnCoord> columns;
-    columns.reserve(static_cast<size_t>(diameter * diameter));
+void World::updateObserverView(StreamingObserverId id, const StreamingView& view) {
+    if (shuttingDown_.load(std::memory_order_acquire)) {
+        return;
+    }
 
-    for (int32_t dy = -radius; dy <= radius; ++dy) {
-        for (int32_t dx = -radius; dx <= radius; ++dx) {
-            columns.push_back(ColumnCoord{
-                centerColumn.v.x + dx,
-                centerColumn.v.y + dy
-            });
+    {
+        std::shared_lock<std::shared_mutex> lock(worldMutex_);
+        const auto it = observers_.find(id);
+        if (it == observers_.end() || !it->second.policy.differsSignificantly(view)) {
+            return;
         }
     }
 
-    enqueueColumnGenerationBatch(columns);
+    std::unique_lock<std::shared_mutex> lock(worldMutex_);
+    const auto it = observers_.find(id);
+    if (it == observers_.end()) {
+        return;
+    }
+    it->second.policy.setView(view);
+    rescoreQueuedColumnsLocked();
 }
 
-void World::scheduleColumnsDelta(const ColumnCoord& previousCenter, const ColumnCoord& newCenter) {
-    const int32_t radius = std::max(0, config_.columnLoadRadius);
-    const int32_t previousMinX = previousCenter.v.x - radius;
-    const int32_t previousMaxX = previousCenter.v.x + radius;
-    const int32_t previousMinY = previousCenter.v.y - radius;
-    const int32_t previousMaxY = previousCenter.v.y + radius;
+void World::scheduleColumnsAround(const ColumnCoord& centerColumn, int32_t radius) {
+    radius = std::max(0, radius);
+    const int32_t diameter = (radius * 2) + 1;
+    std::vector<ColumnCoord> columns;
+    columns.reserve(static_cast<size_t>(diameter) * static_cast<size_t>(diameter));
+    appendColumnsInDisc(centerColumn, radius, columns);
 
-    const int32_t newMinX = newCenter.v.x - radius;
-    const int32_t newMaxX = newCenter.v.x + radius;
-    const int32_t newMinY = newCenter.v.y - radius;
-    const int32_t newMaxY = newCenter.v.y + radius;
+    enqueueColumnGenerationBatch(columns);
+}
 
-    const bool noOverlap =
-        newMaxX < previousMinX || newMinX > previousMaxX ||
-        newMaxY < previousMinY || newMinY > previousMaxY;
+void World::scheduleColumnsDelta(const ColumnCoord& previousCenter, const ColumnCoord& newCenter, int32_t radius) {
+    radius = std::max(0, radius);
+    const int32_t shiftX = std::abs(newCenter.v.x - previousCenter.v.x);
+    const int32_t shiftY = std::abs(newCenter.v.y - previousCenter.v.y);
+
+    const bool noOverlap = shiftX > (radius * 2) || shiftY > (radius * 2);
     if (noOverlap) {
-        scheduleColumnsAround(newCenter);
+        scheduleColumnsAround(newCenter, radius);
         return;
     }
 
     std::vector<ColumnCoord> columnsToSchedule;
     columnsToSchedule.reserve(static_cast<size_t>((radius * 8) + 4));
+    appendColumnsEnteringWindow(previousCenter, newCenter, radius, columnsToSchedule);
 
-    for (int32_t y = newMinY; y <= newMaxY; ++y) {
-        for (int32_t x = newMinX; x <= newMaxX; ++x) {
-            if (x >= previousMinX && x <= previousMaxX &&
-                y >= previousMinY && y <= previousMaxY) {
-                continue;
-            }
-
-            columnsToSchedule.push_back(ColumnCoord{x, y});
+    // Partial columns crossing into a finer mip ring are re-queued for an upgrade.
+    for (const int32_t mipRadius : config_.mipGenerationRadii) {
+        if (mipRadius < radius) {
+            appendColumnsEnteringWindow(previousCenter, newCenter, mipRadius, columnsToSchedule);
         }
     }
 
     enqueueColumnGenerationBatch(columnsToSchedule);
 }
 
+void World::releaseColumnsLeavingMipRings(const ColumnCoord& previousCenter, const ColumnCoord& newCenter) {
+    if (config_.mipGenerationRadii.empty()) {
+        return;
+    }
+
+    const int32_t hysteresis = std::max(0, config_.mipReleaseHysteresis);
+    std::vector<ColumnCoord> leavingColumns;
+    for (const int32_t mipRadius : config_.mipGenerationRadii) {
+        // Swapping the centers yields the columns that left this ring.
+        appendColumnsEnteringWindow(newCenter, previousCenter, mipRadius + hysteresis, leavingColumns);
+    }
+
+    std::unique_lock<std::shared_mutex> lock(worldMutex_);
+    releaseFineMipsInColumnsLocked(leavingColumns);
+}
+
+void World::releaseFineMipsInColumnsLocked(const std::vector<ColumnCoord>& coords) {
+    for (const ColumnCoord& coord : coords) {
+        if (!isColumnGeneratedLocked(coord)) {
+            continue;
+        }
+        Column* column = findColumnLocked(coord);
+        if (column != nullptr) {
+            releaseFineMipsLocked(coord, *column);
+        }
+    }
+}
+
+void World::releaseFineMipsLocked(const ColumnCoord& coord, Column& column) {
+    // Mip 0 is the only copy of the edits; a coarse column would be regenerated without them.
+    if (editedColumns_.find(coord) != editedColumns_.end()) {
+        return;
+    }
+    const uint8_t releaseMip = requiredMipForColumnLocked(coord, std::max(0, config_.mipReleaseHysteresis));
+    const auto partialIt = partialColumnMips_.find(coord);
+    const uint8_t residentMip = (partialIt != partialColumnMips_.end()) ? partialIt->second : 0u;
+    if (releaseMip <= residentMip) {
+        return;
+    }
+
+    column.releaseMipsBelow(releaseMip);
+    partialColumnMips_[coord] = releaseMip;
+    columnEvents_.publish(ColumnEvent{coord, ColumnEventType::Evicted});
+}
+
 void World::enqueueColumnGenerationLocked(const ColumnCoord& coord) {
     if (!isWithinActiveWindowLocked(coord, 0)) {
         return;
     }
-    if (isColumnGeneratedLocked(coord)) {
+    if (!columnNeedsGenerationLocked(coord)) {
         return;
     }
     if (pendingColumnJobs_.find(coord) != pendingColumnJobs_.end()) {
@@ -384,15 +971,70 @@ void World::enqueueColumnGenerationLocked(const ColumnCoord& coord) {
         return;
     }
     queuedColumnJobs_.insert(coord);
-    const int32_t distanceSq = hasLastScheduledCenter_
-        ? distanceSqToCenter(coord, lastScheduledCenter_)
-        : 0;
-    queuedColumnHeap_.push(QueuedColumnEntry{
+    pushQueuedColumnLocked(coord);
+}
+
+void World::pushQueuedColumnLocked(const ColumnCoord& coord) {
+    queuedColumnHeap_.push_back(QueuedColumnEntry{
         coord,
-        distanceSq,
+        queueScoreLocked(coord),
         queueCenterVersion_,
         queueSequence_++
     });
+    std::push_heap(queuedColumnHeap_.begin(), queuedColumnHeap_.end(), QueuedColumnEntryCompare{});
+}
+
+void World::popQueuedColumnLocked() {
+    std::pop_heap(queuedColumnHeap_.begin(), queuedColumnHeap_.end(), QueuedColumnEntryCompare{});
+    queuedColumnHeap_.pop_back();
+}
+
+void World::rescoreQueuedColumnsLocked() {
+    // A turn can move buried entries to the front, so lazy per-top rescoring is not enough here.
+    for (QueuedColumnEntry& entry : queuedColumnHeap_) {
+        entry.score = queueScoreLocked(entry.coord);
+        entry.centerVersion = queueCenterVersion_;
+    }
+    std::make_heap(queuedColumnHeap_.begin(), queuedColumnHeap_.end(), QueuedColumnEntryCompare{});
+}
+
+int32_t World::queueScoreLocked(const ColumnCoord& coord) const {
+    // Observers whose window holds the column rank it; the rest only matter as a fallback.
+    int64_t bestInside = std::numeric_limits<int64_t>::max();
+    int64_t bestOverall = std::numeric_limits<int64_t>::max();
+    for (const auto& [id, observer] : observers_) {
+        if (!observer.hasCenter) {
+            continue;
+        }
+        const int64_t score = observerScore(observer, coord);
+        bestOverall = std::min(bestOverall, score);
+        if (isWithinObserverWindow(observer, coord, 0)) {
+            bestInside = std::min(bestInside, score);
+        }
+    }
+
+    int64_t score = (bestInside != std::numeric_limits<int64_t>::max()) ? bestInside : bestOverall;
+    if (score == std::numeric_limits<int64_t>::max()) {
+        score = 0;
+    }
+    return static_cast<int32_t>(std::min<int64_t>(score, std::numeric_limits<int32_t>::max()));
+}
+
+int64_t World::observerScore(const Observer& observer, const ColumnCoord& coord) {
+    if (!observer.policy.hasView()) {
+        return distanceSqToCenter(coord, observer.center);
+    }
+
+    const float columnBlocks = static_cast<float>(cfg::CHUNK_SIZE);
+    const glm::vec2 columnCenter{
+        (static_cast<float>(coord.v.x) + 0.5f) * columnBlocks,
+        (static_cast<float>(coord.v.y) + 0.5f) * columnBlocks
+    };
+    const float distanceColumns = observer.policy.effectiveDistanceBlocks(columnCenter) / columnBlocks;
+    return static_cast<int64_t>(std::min(
+        static_cast<double>(distanceColumns) * static_cast<double>(distanceColumns),
+        static_cast<double>(std::numeric_limits<int32_t>::max())
+    ));
 }
 
 void World::enqueueColumnGenerationBatch(const std::vector<ColumnCoord>& coords) {
@@ -412,32 +1054,27 @@ void World::pruneQueuedColumnsOutsideActiveWindowLocked() {
     constexpr size_t kPruneBudget = 256;
     size_t processed = 0;
     while (processed < kPruneBudget && !queuedColumnHeap_.empty()) {
-        const QueuedColumnEntry top = queuedColumnHeap_.top();
+        const QueuedColumnEntry top = queuedColumnHeap_.front();
 
         auto queuedIt = queuedColumnJobs_.find(top.coord);
         if (queuedIt == queuedColumnJobs_.end()) {
-            queuedColumnHeap_.pop();
+            popQueuedColumnLocked();
             ++processed;
             continue;
         }
 
         if (!isWithinActiveWindowLocked(top.coord, 0) ||
-            isColumnGeneratedLocked(top.coord) ||
+            !columnNeedsGenerationLocked(top.coord) ||
             pendingColumnJobs_.find(top.coord) != pendingColumnJobs_.end()) {
             queuedColumnJobs_.erase(queuedIt);
-            queuedColumnHeap_.pop();
+            popQueuedColumnLocked();
             ++processed;
             continue;
         }
 
         if (top.centerVersion != queueCenterVersion_) {
-            queuedColumnHeap_.pop();
-            queuedColumnHeap_.push(QueuedColumnEntry{
-                top.coord,
-                hasLastScheduledCenter_ ? distanceSqToCenter(top.coord, lastScheduledCenter_) : 0,
-                queueCenterVersion_,
-                queueSequence_++
-            });
+            popQueuedColumnLocked();
+            pushQueuedColumnLocked(top.coord);
             ++processed;
             continue;
         }
@@ -448,8 +1085,8 @@ void World::pruneQueuedColumnsOutsideActiveWindowLocked() {
 
 void World::collectColumnJobsToScheduleLocked(std::vector<ScheduledColumnJob>& outJobs) {
     while (pendingColumnJobs_.size() < maxInFlightColumnJobs_ && !queuedColumnHeap_.empty()) {
-        const QueuedColumnEntry top = queuedColumnHeap_.top();
-        queuedColumnHeap_.pop();
+        const QueuedColumnEntry top = queuedColumnHeap_.front();
+        popQueuedColumnLocked();
 
         auto queuedIt = queuedColumnJobs_.find(top.coord);
         if (queuedIt == queuedColumnJobs_.end()) {
@@ -457,19 +1094,14 @@ void World::collectColumnJobsToScheduleLocked(std::vector<ScheduledColumnJob>& o
         }
 
         if (!isWithinActiveWindowLocked(top.coord, 0) ||
-            isColumnGeneratedLocked(top.coord) ||
+            !columnNeedsGenerationLocked(top.coord) ||
             pendingColumnJobs_.find(top.coord) != pendingColumnJobs_.end()) {
             queuedColumnJobs_.erase(queuedIt);
             continue;
         }
 
         if (top.centerVersion != queueCenterVersion_) {
-            queuedColumnHeap_.push(QueuedColumnEntry{
-                top.coord,
-                hasLastScheduledCenter_ ? distanceSqToCenter(top.coord, lastScheduledCenter_) : 0,
-                queueCenterVersion_,
-                queueSequence_++
-            });
+            pushQueuedColumnLocked(top.coord);
             continue;
         }
 
@@ -477,7 +1109,8 @@ void World::collectColumnJobsToScheduleLocked(std::vector<ScheduledColumnJob>& o
         pendingColumnJobs_.insert(top.coord);
         outJobs.push_back(ScheduledColumnJob{
             top.coord,
-            priorityFromDistanceSq(top.distanceSq)
+            priorityFromScore(top.score),
+            requiredMipForColumnLocked(top.coord)
         });
     }
 }
@@ -485,10 +1118,11 @@ void World::collectColumnJobsToScheduleLocked(std::vector<ScheduledColumnJob>& o
 void World::dispatchScheduledColumnJobs(std::vector<ScheduledColumnJob>&& jobsToSchedule) {
     for (const ScheduledColumnJob& scheduled : jobsToSchedule) {
         const ColumnCoord coord = scheduled.coord;
+        const uint8_t minMip = scheduled.minMip;
         try {
             jobs_.schedule(
                 scheduled.priority,
-                [this, coord]() -> ColumnGenerationResult {
+                [this, coord, minMip]() -> ColumnGenerationResult {
                     {
                         std::shared_lock<std::shared_mutex> lock(worldMutex_);
                         if (!isWithinActiveWindowLocked(coord, 0)) {
@@ -505,7 +1139,9 @@ void World::dispatchScheduledColumnJobs(std::vector<ScheduledColumnJob>&& jobsTo
 
                     const ChunkCoord columnBaseChunk = column_local_to_chunk(coord, 0);
                     const BlockCoord columnOrigin = chunk_to_block_origin(columnBaseChunk);
-                    generator.generateColumn(columnOrigin.v, generatedColumn);
+                    generator.generateColumn(columnOrigin.v, generatedColumn, minMip);
+                    // Rebuilt here, off the world lock, whatever path the generator took.
+                    generatedColumn.rebuildSurfaceMetadata();
 
                     return ColumnGenerationResult{
                         coord,
@@ -542,17 +1178,9 @@ void World::dispatchScheduledColumnJobs(std::vector<ScheduledColumnJob>&& jobsTo
                 pendingColumnJobs_.erase(coord);
                 if (!shuttingDown_.load(std::memory_order_acquire) &&
                     isWithinActiveWindowLocked(coord, 0) &&
-                    !isColumnGeneratedLocked(coord)) {
+                    columnNeedsGenerationLocked(coord)) {
                     queuedColumnJobs_.insert(coord);
-                    const int32_t distanceSq = hasLastScheduledCenter_
-                        ? distanceSqToCenter(coord, lastScheduledCenter_)
-                        : 0;
-                    queuedColumnHeap_.push(QueuedColumnEntry{
-                        coord,
-                        distanceSq,
-                        queueCenterVersion_,
-                        queueSequence_++
-                    });
+                    pushQueuedColumnLocked(coord);
                 }
             }
         }
@@ -584,8 +1212,22 @@ void World::onColumnGenerated(const ColumnCoord& coord, Column&& column) {
         return;
     }
 
-    // Keep occupancy metadata coherent even if a generator path bypasses Column::setBlock.
-    column.rebuildEmptyChunkMask();
+    // The camera may have moved away while the job ran.
+    const uint8_t releaseMip = requiredMipForColumnLocked(coord, std::max(0, config_.mipReleaseHysteresis));
+    if (column.minResidentMip() < releaseMip) {
+        column.releaseMipsBelow(releaseMip);
+    }
+
+    const uint8_t residentMip = column.minResidentMip();
+    const bool alreadyGenerated = isColumnGeneratedLocked(coord);
+    if (alreadyGenerated) {
+        // Never replace a column with a coarser copy than the one already resident.
+        const auto partialIt = partialColumnMips_.find(coord);
+        const uint8_t currentMip = (partialIt != partialColumnMips_.end()) ? partialIt->second : 0u;
+        if (residentMip >= currentMip) {
+            return;
+        }
+    }
 
     Region* region = getOrCreateRegionLocked(column_to_region(coord));
     if (region == nullptr) {
@@ -598,11 +1240,16 @@ void World::onColumnGenerated(const ColumnCoord& coord, Column&& column) {
         static_cast<uint8_t>(localColumn.y)
     ) = std::move(column);
 
-    const auto insertedResult = generatedColumns_.insert(coord);
-    if (insertedResult.second) {
-        generatedColumnHistory_.push_back(coord);
-        generationRevision_.fetch_add(1, std::memory_order_release);
+    if (residentMip > 0) {
+        partialColumnMips_[coord] = residentMip;
+    } else {
+        partialColumnMips_.erase(coord);
     }
+
+    // Upgrades are published again so meshing picks up the finer data.
+    generatedColumns_.insert(coord);
+    columnEvents_.publish(ColumnEvent{coord, ColumnEventType::Generated});
+    generationRevision_.fetch_add(1, std::memory_order_release);
 }
 
 bool World::hasPendingJobs() const {
@@ -614,15 +1261,108 @@ bool World::isColumnGeneratedLocked(const ColumnCoord& coord) const {
     return generatedColumns_.find(coord) != generatedColumns_.end();
 }
 
-bool World::isWithinActiveWindowLocked(const ColumnCoord& coord, int32_t extraRadius) const {
-    if (!hasLastScheduledCenter_) {
+bool World::columnNeedsGenerationLocked(const ColumnCoord& coord) const {
+    if (!isColumnGeneratedLocked(coord)) {
         return true;
     }
 
-    const int32_t radius = std::max(0, config_.columnLoadRadius + extraRadius);
-    const int32_t dx = std::abs(coord.v.x - lastScheduledCenter_.v.x);
-    const int32_t dy = std::abs(coord.v.y - lastScheduledCenter_.v.y);
-    return dx <= radius && dy <= radius;
+    const auto partialIt = partialColumnMips_.find(coord);
+    if (partialIt == partialColumnMips_.end()) {
+        return false;
+    }
+    return partialIt->second > requiredMipForColumnLocked(coord);
+}
+
+uint8_t World::requiredMipForColumnLocked(const ColumnCoord& coord, int32_t extraRadius) const {
+    const std::vector<int32_t>& mipRadii = config_.mipGenerationRadii;
+    if (mipRadii.empty()) {
+        return 0u;
+    }
+
+    // The finest mip any observer asks for wins.
+    const uint8_t coarsestMip = static_cast<uint8_t>(std::min<size_t>(mipRadii.size(), Chunk::MAX_MIP_LEVEL));
+    uint8_t requiredMip = coarsestMip;
+    bool anyCenter = false;
+    for (const auto& [id, observer] : observers_) {
+        if (!observer.hasCenter) {
+            continue;
+        }
+        anyCenter = true;
+        requiredMip = std::min(requiredMip, requiredMipForObserver(observer, coord, extraRadius));
+        if (requiredMip == 0u) {
+            break;
+        }
+    }
+    return anyCenter ? requiredMip : 0u;
+}
+
+uint8_t World::requiredMipForObserver(const Observer& observer,
+                                      const ColumnCoord& coord,
+                                      int32_t extraRadius) const {
+    const std::vector<int32_t>& mipRadii = config_.mipGenerationRadii;
+    const uint8_t coarsestMip = static_cast<uint8_t>(std::min<size_t>(mipRadii.size(), Chunk::MAX_MIP_LEVEL));
+    // A small observer never pulls fine mips in past its own window.
+    if (!isWithinObserverWindow(observer, coord, extraRadius)) {
+        return coarsestMip;
+    }
+
+    const int64_t distanceSq = distanceSqToCenter(coord, observer.center);
+    for (size_t mip = 0; mip < mipRadii.size(); ++mip) {
+        const int64_t radius = std::max<int64_t>(0, static_cast<int64_t>(mipRadii[mip]) + extraRadius);
+        if (distanceSq <= radius * radius) {
+            return static_cast<uint8_t>(mip);
+        }
+    }
+    return coarsestMip;
+}
+
+bool World::isWithinActiveWindowLocked(const ColumnCoord& coord, int32_t extraRadius) const {
+    bool anyCenter = false;
+    for (const auto& [id, observer] : observers_) {
+        if (!observer.hasCenter) {
+            continue;
+        }
+        anyCenter = true;
+        if (isWithinObserverWindow(observer, coord, extraRadius)) {
+            return true;
+        }
+    }
+    return !anyCenter;
+}
+
+bool World::isWithinObserverWindow(const Observer& observer, const ColumnCoord& coord, int32_t extraRadius) {
+    const int64_t radius = std::max(0, observer.columnLoadRadius + extraRadius);
+    return distanceSqToCenter(coord, observer.center) <= radius * radius;
+}
+
+Column* World::findColumnLocked(const ColumnCoord& coord) {
+    const auto regionIt = regions_.find(column_to_region(coord));
+    if (regionIt == regions_.end() || regionIt->second == nullptr) {
+        return nullptr;
+    }
+
+    const glm::ivec2 localColumn = column_local_in_region(coord);
+    return &regionIt->second->getColumn(
+        static_cast<uint8_t>(localColumn.x),
+        static_cast<uint8_t>(localColumn.y)
+    );
+}
+
+const Column* World::findGeneratedColumnLocked(const ColumnCoord& coord) const {
+    if (!isColumnGeneratedLocked(coord)) {
+        return nullptr;
+    }
+
+    const auto regionIt = regions_.find(column_to_region(coord));
+    if (regionIt == regions_.end() || regionIt->second == nullptr) {
+        return nullptr;
+    }
+
+    const glm::ivec2 localColumn = column_local_in_region(coord);
+    return &regionIt->second->getColumn(
+        static_cast<uint8_t>(localColumn.x),
+        static_cast<uint8_t>(localColumn.y)
+    );
 }
 
 Region* World::getOrCreateRegionLocked(const RegionCoord& coord) {
@@ -639,14 +1379,14 @@ Region* World::getOrCreateRegionLocked(const RegionCoord& coord) {
     return insertedIt->second.get();
 }
 
-jobsystem::Priority World::priorityFromDistanceSq(int32_t distanceSq) {
-    if (distanceSq <= 0) {
+jobsystem::Priority World::priorityFromScore(int32_t score) {
+    if (score <= 0) {
         return jobsystem::Priority::Critical;
     }
-    if (distanceSq <= 2) {
+    if (score <= 2) {
         return jobsystem::Priority::High;
     }
-    if (distanceSq <= 8) {
+    if (score <= 8) {
         return jobsystem::Priority::Normal;
     }
     return jobsystem::Priority::Low;
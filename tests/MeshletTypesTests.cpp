@@ -0,0 +1,317 @@
+#include "solum_engine/render/MeshletTypes.h"
+
+#include <array>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+int failures = 0;
+
+void expect(bool condition, const std::string& what) {
+    if (!condition) {
+        std::cerr << "FAILED: " << what << std::endl;
+        ++failures;
+    }
+}
+
+// One layer of quads at local z (or x, y) = 3 spanning voxels 1..5 on the other axes.
+MeshletAabb singleLayerAabb(uint32_t faceDirection) {
+    MeshletDescriptor meshlet;
+    meshlet.origin = glm::ivec3(16, -32, 48);
+    meshlet.faceDirection = faceDirection;
+    meshlet.quadCount = 1;
+    meshlet.boundsMin = glm::uvec3(1u);
+    meshlet.boundsMax = glm::uvec3(5u);
+    const glm::length_t axis = static_cast<glm::length_t>(faceDirection / 2u);
+    meshlet.boundsMin[axis] = 3u;
+    meshlet.boundsMax[axis] = 3u;
+    return meshletDescriptorAabb(meshlet);
+}
+
+void testBackfacing() {
+    for (uint32_t face = 0; face < 6u; ++face) {
+        const MeshletAabb aabb = singleLayerAabb(face);
+        const glm::length_t axis = static_cast<glm::length_t>(face / 2u);
+        const bool positive = (face % 2u) == 0u;
+        const float plane = positive ? aabb.minCorner[axis] : aabb.maxCorner[axis];
+        expect(aabb.minCorner[axis] == aabb.maxCorner[axis], "single layer collapses onto its face plane");
+
+        glm::vec3 camera = 0.5f * (aabb.minCorner + aabb.maxCorner);
+        const std::string label = "face " + std::to_string(face) + ": ";
+
+        camera[axis] = plane + (positive ? 10.0f : -10.0f);
+        expect(!isMeshletBackfacing(face, aabb, camera), label + "camera in front is not culled");
+
+        camera[axis] = plane + (positive ? -10.0f : 10.0f);
+        expect(isMeshletBackfacing(face, aabb, camera), label + "camera behind is culled");
+
+        // Edge-on quads cover no pixels.
+        camera[axis] = plane;
+        expect(isMeshletBackfacing(face, aabb, camera), label + "camera on the plane is culled");
+    }
+
+    const MeshletAabb aabb = singleLayerAabb(0u);
+    expect(!isMeshletBackfacing(6u, aabb, glm::vec3(-100.0f)), "unknown face direction is never culled");
+}
+
+bool sameQuad(const MeshletQuad& a, const MeshletQuad& b) {
+    return a.packedLocalOffset == b.packedLocalOffset && a.aoData == b.aoData && a.paletteIndex == b.paletteIndex;
+}
+
+void testQuadRoundTrip() {
+    constexpr uint32_t kAoMax = (1u << MESHLET_QUAD_AO_BITS) - 1u;
+    constexpr uint32_t kPaletteMax = (1u << MESHLET_QUAD_PALETTE_BITS) - 1u;
+
+    const MeshletQuad lowest;
+    expect(packMeshletQuad(lowest) == 0u, "zero quad packs to zero");
+    expect(sameQuad(unpackMeshletQuad(packMeshletQuad(lowest)), lowest), "zero quad round-trips");
+
+    MeshletQuad highest;
+    highest.packedLocalOffset = packMeshletLocalOffset(31u, 31u, 31u);
+    highest.aoData = static_cast<uint16_t>(kAoMax);
+    highest.paletteIndex = kPaletteMax;
+    expect(sameQuad(unpackMeshletQuad(packMeshletQuad(highest)), highest), "full quad round-trips");
+    expect(unpackMeshletLocalOffset(highest.packedLocalOffset) == glm::uvec3(31u), "local offset max round-trips");
+
+    // Each field at its maximum alone must not bleed into its neighbours.
+    MeshletQuad offsetOnly;
+    offsetOnly.packedLocalOffset = highest.packedLocalOffset;
+    MeshletQuad aoOnly;
+    aoOnly.aoData = highest.aoData;
+    MeshletQuad paletteOnly;
+    paletteOnly.paletteIndex = highest.paletteIndex;
+    expect(sameQuad(unpackMeshletQuad(packMeshletQuad(offsetOnly)), offsetOnly), "local offset alone round-trips");
+    expect(sameQuad(unpackMeshletQuad(packMeshletQuad(aoOnly)), aoOnly), "AO alone round-trips");
+    expect(sameQuad(unpackMeshletQuad(packMeshletQuad(paletteOnly)), paletteOnly), "palette index alone round-trips");
+
+    MeshletQuad oversized;
+    oversized.aoData = 0xFFFFu;
+    oversized.paletteIndex = kPaletteMax + 1u;
+    const MeshletQuad masked = unpackMeshletQuad(packMeshletQuad(oversized));
+    expect(masked.aoData == kAoMax && masked.paletteIndex == 0u && masked.packedLocalOffset == 0u,
+           "oversized fields are masked to their own bits");
+}
+
+// Quad words then palette; checks that every quad resolves to its material.
+void expectMeshletMaterials(const Meshlet& meshlet, uint32_t paletteSize, const std::string& what) {
+    std::vector<uint32_t> words{0xDEADBEEFu};
+    const uint32_t written = appendMeshletQuadData(meshlet, words);
+    const uint32_t quadCount = std::min(meshlet.quadCount, MESHLET_QUAD_CAPACITY);
+    expect(written == quadCount * MESHLET_QUAD_DATA_WORD_STRIDE + meshletPaletteWordCount(paletteSize),
+           what + ": word count");
+    expect(written <= MESHLET_MAX_DATA_WORDS, what + ": fits the per-meshlet word budget");
+    expect(words.size() == 1u + written && words.front() == 0xDEADBEEFu, what + ": appends after existing words");
+    if (words.size() != 1u + written) {
+        return;
+    }
+
+    const uint32_t* meshletWords = words.data() + 1;
+    for (uint32_t i = 0; i < quadCount; ++i) {
+        const MeshletQuad quad = unpackMeshletQuad(meshletWords[i * MESHLET_QUAD_DATA_WORD_STRIDE]);
+        const std::string label = what + ": quad " + std::to_string(i);
+        expect(quad.packedLocalOffset == meshlet.packedQuadLocalOffsets[i], label + " local offset");
+        expect(quad.aoData == meshlet.quadAoData[i], label + " AO");
+        expect(quad.paletteIndex < paletteSize, label + " palette index in range");
+        expect(meshletPaletteMaterial(meshletWords, quadCount, quad.paletteIndex) == meshlet.quadMaterialIds[i],
+               label + " material");
+    }
+}
+
+void testMeshletPalette() {
+    Meshlet repeated;
+    repeated.quadCount = 5u;
+    const std::array<uint16_t, 5> repeatedMaterials{7u, 9u, 7u, 7u, 0xFFFFu};
+    for (uint32_t i = 0; i < repeated.quadCount; ++i) {
+        repeated.packedQuadLocalOffsets[i] = packMeshletLocalOffset(i, 31u - i, i * 3u);
+        repeated.quadMaterialIds[i] = repeatedMaterials[i];
+        repeated.quadAoData[i] = static_cast<uint16_t>(i * 100u);
+    }
+    expectMeshletMaterials(repeated, 3u, "repeated materials");
+
+    // An odd palette leaves the high half of its last word empty.
+    std::vector<uint32_t> words;
+    appendMeshletQuadData(repeated, words);
+    expect(words.back() == 0xFFFFu, "odd palette pads its last word with zero");
+
+    // Every quad with its own material fills the palette to its 128-entry limit.
+    Meshlet distinct;
+    distinct.quadCount = MESHLET_QUAD_CAPACITY;
+    for (uint32_t i = 0; i < distinct.quadCount; ++i) {
+        distinct.packedQuadLocalOffsets[i] = packMeshletLocalOffset(i % 32u, (i / 32u) * 7u, 31u);
+        distinct.quadMaterialIds[i] = static_cast<uint16_t>(0xFFFFu - i * 3u);
+        distinct.quadAoData[i] = static_cast<uint16_t>((1u << MESHLET_QUAD_AO_BITS) - 1u - i);
+    }
+    expectMeshletMaterials(distinct, MESHLET_QUAD_CAPACITY, "one material per quad");
+
+    // Quads past the capacity are ignored rather than written past the meshlet's words.
+    Meshlet overfull = distinct;
+    overfull.quadCount = MESHLET_QUAD_CAPACITY + 1u;
+    expectMeshletMaterials(overfull, MESHLET_QUAD_CAPACITY, "quad count past capacity");
+
+    Meshlet single;
+    single.quadCount = 1u;
+    expectMeshletMaterials(single, 1u, "single quad");
+}
+
+bool sameDescriptor(const MeshletDescriptor& a, const MeshletDescriptor& b) {
+    return a.origin == b.origin && a.faceDirection == b.faceDirection && a.quadCount == b.quadCount &&
+           a.voxelScale == b.voxelScale && a.dataOffset == b.dataOffset && a.ordinal == b.ordinal &&
+           a.boundsMin == b.boundsMin && a.boundsMax == b.boundsMax;
+}
+
+void expectDescriptorRoundTrip(const MeshletDescriptor& meshlet, const glm::ivec3& base, const std::string& what) {
+    MeshletDescriptorGPU encoded;
+    if (!encodeMeshletDescriptor(meshlet, base, encoded)) {
+        expect(false, what + " encodes");
+        return;
+    }
+    expect(sameDescriptor(decodeMeshletDescriptor(encoded, base), meshlet), what + " round-trips");
+}
+
+void expectDescriptorRejected(const MeshletDescriptor& meshlet, const glm::ivec3& base, const std::string& what) {
+    MeshletDescriptorGPU encoded;
+    expect(!encodeMeshletDescriptor(meshlet, base, encoded), what + " is rejected");
+}
+
+void testDescriptorRoundTrip() {
+    constexpr int32_t kXYLimit = 1 << (MESHLET_DESCRIPTOR_ORIGIN_XY_BITS - 1u);
+    constexpr int32_t kZLimit = 1 << (MESHLET_DESCRIPTOR_ORIGIN_Z_BITS - 1u);
+    constexpr uint32_t kBoundsMax = (1u << MESHLET_DESCRIPTOR_BOUNDS_BITS) - 1u;
+    const glm::ivec3 base(1024, -2048, 320);
+
+    MeshletDescriptor lowest;
+    lowest.origin = base - glm::ivec3(kXYLimit, kXYLimit, kZLimit);
+    lowest.faceDirection = 0u;
+    lowest.quadCount = 1u;
+    lowest.voxelScale = 1u;
+    lowest.dataOffset = 0u;
+    lowest.ordinal = 0u;
+    expectDescriptorRoundTrip(lowest, base, "all fields at their minimum");
+
+    MeshletDescriptor highest;
+    highest.origin = base + glm::ivec3(kXYLimit - 1, kXYLimit - 1, kZLimit - 1);
+    highest.faceDirection = 5u;
+    highest.quadCount = MESHLET_QUAD_CAPACITY;
+    highest.voxelScale = 1u << ((1u << MESHLET_DESCRIPTOR_SCALE_BITS) - 1u);
+    highest.dataOffset = 0xFFFFFFFFu;
+    highest.ordinal = (1u << MESHLET_DESCRIPTOR_ORDINAL_BITS) - 1u;
+    highest.boundsMin = glm::uvec3(kBoundsMax);
+    highest.boundsMax = glm::uvec3(kBoundsMax);
+    expectDescriptorRoundTrip(highest, base, "all fields at their maximum");
+
+    // Distinct values per axis catch swapped bound fields.
+    MeshletDescriptor mixed = lowest;
+    mixed.origin = base + glm::ivec3(-kXYLimit, kXYLimit - 1, 0);
+    mixed.boundsMin = glm::uvec3(0u, 7u, 30u);
+    mixed.boundsMax = glm::uvec3(kBoundsMax, 7u, kBoundsMax);
+    expectDescriptorRoundTrip(mixed, base, "mixed origin and bounds");
+
+    for (uint32_t face = 0; face < 6u; ++face) {
+        MeshletDescriptor meshlet = highest;
+        meshlet.faceDirection = face;
+        expectDescriptorRoundTrip(meshlet, base, "face " + std::to_string(face));
+    }
+    for (uint32_t scale = 1u; scale <= 128u; scale <<= 1u) {
+        MeshletDescriptor meshlet = lowest;
+        meshlet.voxelScale = scale;
+        expectDescriptorRoundTrip(meshlet, base, "voxel scale " + std::to_string(scale));
+    }
+
+    // Only the low ordinal bits are kept.
+    MeshletDescriptor wrapped = lowest;
+    wrapped.ordinal = (1u << MESHLET_DESCRIPTOR_ORDINAL_BITS) + 3u;
+    MeshletDescriptorGPU encoded;
+    expect(encodeMeshletDescriptor(wrapped, base, encoded), "large ordinal encodes");
+    expect(decodeMeshletDescriptor(encoded, base).ordinal == 3u, "large ordinal keeps its low bits");
+    expect(meshletDescriptorQuadCount(encoded) == 1u, "quad count read without a full decode");
+
+    const std::array<glm::ivec3, 6> outOfRange{
+        glm::ivec3(-kXYLimit - 1, 0, 0), glm::ivec3(kXYLimit, 0, 0),
+        glm::ivec3(0, -kXYLimit - 1, 0), glm::ivec3(0, kXYLimit, 0),
+        glm::ivec3(0, 0, -kZLimit - 1), glm::ivec3(0, 0, kZLimit),
+    };
+    for (const glm::ivec3& offset : outOfRange) {
+        MeshletDescriptor meshlet = lowest;
+        meshlet.origin = base + offset;
+        expectDescriptorRejected(meshlet, base, "origin offset " + std::to_string(offset.x) + "," +
+                                 std::to_string(offset.y) + "," + std::to_string(offset.z));
+    }
+
+    MeshletDescriptor meshlet = lowest;
+    meshlet.faceDirection = 6u;
+    expectDescriptorRejected(meshlet, base, "face 6");
+
+    meshlet = lowest;
+    meshlet.quadCount = 0u;
+    expectDescriptorRejected(meshlet, base, "zero quads");
+    meshlet.quadCount = MESHLET_QUAD_CAPACITY + 1u;
+    expectDescriptorRejected(meshlet, base, "quad count past capacity");
+
+    meshlet = lowest;
+    meshlet.voxelScale = 0u;
+    expectDescriptorRejected(meshlet, base, "voxel scale 0");
+    meshlet.voxelScale = 3u;
+    expectDescriptorRejected(meshlet, base, "non power of two voxel scale");
+    meshlet.voxelScale = 256u;
+    expectDescriptorRejected(meshlet, base, "voxel scale past the scale bits");
+
+    meshlet = lowest;
+    meshlet.boundsMin = glm::uvec3(0u, 5u, 0u);
+    meshlet.boundsMax = glm::uvec3(0u, 4u, 0u);
+    expectDescriptorRejected(meshlet, base, "bounds min above max");
+    meshlet.boundsMin = glm::uvec3(0u);
+    meshlet.boundsMax = glm::uvec3(0u, 0u, kBoundsMax + 1u);
+    expectDescriptorRejected(meshlet, base, "bounds past the bound bits");
+}
+
+MeshletDescriptorGPU descriptorWithQuads(uint32_t quadCount) {
+    MeshletDescriptor meshlet;
+    meshlet.quadCount = quadCount;
+    MeshletDescriptorGPU descriptor;
+    expect(encodeMeshletDescriptor(meshlet, glm::ivec3(0), descriptor), "test descriptor encodes");
+    return descriptor;
+}
+
+void testDrawChunkCompaction() {
+    const std::vector<MeshletDescriptorGPU> metadata{
+        descriptorWithQuads(1u),
+        descriptorWithQuads(5u),
+        descriptorWithQuads(4u),
+        descriptorWithQuads(MESHLET_QUAD_CAPACITY),
+    };
+
+    // Entries are (meshlet << 5) | chunk; a 5-quad meshlet needs two 4-quad chunks.
+    std::vector<uint32_t> chunks;
+    const uint32_t allCount = appendMeshletDrawChunks(metadata, nullptr, 3u, chunks);
+    expect(allCount == 4u, "first three meshlets compact to 4 chunks");
+    expect(chunks == std::vector<uint32_t>{0u, 32u, 33u, 64u}, "chunk entries of the first three meshlets");
+
+    chunks.clear();
+    appendMeshletDrawChunks(metadata, nullptr, 4u, chunks);
+    expect(chunks.size() == 4u + MESHLET_QUAD_CAPACITY / MESHLET_DRAW_CHUNK_QUADS, "full meshlet emits every chunk");
+    expect(chunks.back() == ((3u << 5u) | 31u), "last chunk of a full meshlet");
+
+    // A visible list picks meshlets out of order and skips indices past the metadata.
+    const std::array<uint32_t, 3> visible{2u, 7u, 1u};
+    chunks.assign(1u, 0xFFFFFFFFu);
+    const uint32_t visibleCount = appendMeshletDrawChunks(metadata, visible.data(), 3u, chunks);
+    expect(visibleCount == 4u, "count includes entries already in the list");
+    expect(chunks == std::vector<uint32_t>{0xFFFFFFFFu, 64u, 32u, 33u}, "visible list entries in list order");
+}
+}  // namespace
+
+int main() {
+    testBackfacing();
+    testDescriptorRoundTrip();
+    testQuadRoundTrip();
+    testMeshletPalette();
+    testDrawChunkCompaction();
+
+    if (failures != 0) {
+        std::cerr << failures << " check(s) failed" << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}